@@ -1,11 +1,21 @@
 #include "Chip8.hpp"
 
+#include "Chip8BlockCache.hpp"
+#include "Chip8Compiled.hpp"
+#include "Chip8Debugger.hpp"
+#include "Chip8InputLog.hpp"
+#include "Chip8Instructions.hpp"
+#include "Chip8Profiler.hpp"
+#include "Chip8Rewind.hpp"
+
 #include <algorithm>
+#include <bit>
 #include <cassert>
 #include <cstdlib>
 #include <cstring>
 #include <sstream>
 #include <stdexcept>
+#include <utility>
 
 
 Chip8Error::Chip8Error(const std::string& what_arg)
@@ -13,178 +23,260 @@ Chip8Error::Chip8Error(const std::string& what_arg)
 {}
 
 
-constexpr uint8_t Chip8::instr_a(uint16_t instruction)
+namespace
 {
-	return (instruction & 0xf000U) >> 12;
-}
+	// Bits of the flags byte of a savestate payload.
+	enum : uint8_t
+	{
+		F_SOUNDING		= 0x01,
+		F_CRASHED		= 0x02,
+		F_PROGRAMMED	= 0x04,
+		F_CAN_DRAW		= 0x08,
+		F_KEY_WAIT		= 0x10,
+		F_HIRES			= 0x20,
+	};
+
+
+	/**
+	 * @brief Stores value at out as little endian and advances out past it.
+	 */
+	template <typename T>
+	inline void put(uint8_t*& out, T value)
+	{
+		uint64_t bits {static_cast<uint64_t>(value)};
+		for (size_t i = 0; i < sizeof(T); ++i)
+			*out++ = static_cast<uint8_t>(bits >> 8 * i);
+	}
 
 
-constexpr uint8_t Chip8::instr_b(uint16_t instruction)
-{
-	return (instruction & 0x0f00U) >> 8;
-}
+	/**
+	 * @return The little endian value at in, advancing in past it.
+	 */
+	template <typename T>
+	inline T get(const uint8_t*& in)
+	{
+		uint64_t value {0};
+		for (size_t i = 0; i < sizeof(T); ++i)
+			value |= static_cast<uint64_t>(*in++) << 8 * i;
+		return static_cast<T>(value);
+	}
 
 
-constexpr uint8_t Chip8::instr_c(uint16_t instruction)
-{
-	return (instruction & 0x00f0U) >> 4;
-}
+	/**
+	 * @return The CRC-32 lookup table for each value of a byte.
+	 */
+	constexpr std::array<uint32_t, 256> build_crc_table()
+	{
+		std::array<uint32_t, 256> table {};
+		for (uint32_t i = 0; i < 256; ++i)
+		{
+			uint32_t crc {i};
+			for (int bit = 0; bit < 8; ++bit)
+				crc = (crc >> 1) ^ (0xedb88320U & -(crc & 1));
+			table[i] = crc;
+		}
+		return table;
+	}
 
 
-constexpr uint8_t Chip8::instr_d(uint16_t instruction)
-{
-	return instruction & 0x000fU;
-}
+	constexpr std::array<uint32_t, 256> crc_table {build_crc_table()};
 
 
-constexpr uint16_t Chip8::instr_addr(uint16_t instruction)
-{
-	return instruction & 0x0fffU;
-}
+	/**
+	 * @return The CRC-32 (as used by zlib) of the passed bytes.
+	 */
+	uint32_t crc32(const uint8_t* data, size_t size)
+	{
+		uint32_t crc {0xffffffffU};
+		for (size_t i = 0; i < size; ++i)
+			crc = (crc >> 8) ^ crc_table[(crc ^ data[i]) & 0xff];
+		return ~crc;
+	}
 
 
-constexpr uint8_t Chip8::instr_imm(uint16_t instruction)
-{
-	return instruction & 0x00ffU;
+	/**
+	 * @return hash with the little endian bytes of value folded into it by
+	 * 64 bit FNV-1a.
+	 */
+	template <typename T>
+	inline uint64_t fnv1a(uint64_t hash, T value)
+	{
+		uint64_t bits {static_cast<uint64_t>(value)};
+		for (size_t i = 0; i < sizeof(T); ++i)
+			hash = (hash ^ (bits >> 8 * i & 0xff)) * 0x100000001b3;
+		return hash;
+	}
 }
 
 
 std::ostream& operator<<(std::ostream& os, Chip8& st)
 {
-	st._access_lock.lock();
+	std::array<std::byte, Chip8::_Max_State_Size> buffer;
+	size_t size {st.save_state(buffer)};
 	std::ios_base::iostate prev_state = os.exceptions();
 	os.exceptions(std::istream::failbit);
 	try
 	{
-		os.write(reinterpret_cast<char*>(&st._pc), sizeof(st._pc));
-		os.write(reinterpret_cast<char*>(&st._sp), sizeof(st._sp));
-		os.write(reinterpret_cast<char*>(&st._index), sizeof(st._index));
-		os.write(reinterpret_cast<char*>(&st._delay), sizeof(st._delay));
-		os.write(reinterpret_cast<char*>(&st._sound), sizeof(st._sound));
-		os.write(reinterpret_cast<char*>(&st._sounding), sizeof(st._sounding));
-		os.write(reinterpret_cast<char*>(&st._crashed), sizeof(st._crashed));
-		os.write(reinterpret_cast<char*>(&st._programmed), sizeof(st._programmed));
-		os.write(reinterpret_cast<char*>(&st._can_draw), sizeof(st._can_draw));
-		bool key_wait = st._key_wait;
-		os.write(reinterpret_cast<char*>(&key_wait), sizeof(key_wait));
-		os.write(reinterpret_cast<char*>(&st._time_budget), sizeof(st._time_budget));
-		os.write(reinterpret_cast<char*>(&st._timer), sizeof(st._timer));
-		os.write(reinterpret_cast<char*>(&st._gprf), sizeof(st._gprf));
-		os.write(reinterpret_cast<char*>(&st._mem), sizeof(st._mem));
-		os.write(reinterpret_cast<char*>(&st._screen), sizeof(st._screen));
+		os.write(reinterpret_cast<char*>(buffer.data()), size);
 	}
 	catch (std::ios_base::failure& e)
 	{
 		os.exceptions(prev_state);
-		st._access_lock.unlock();
 		throw e;
 	}
 	os.exceptions(prev_state);
-	st._access_lock.unlock();
 	return os;
 }
 
 
 std::istream& operator>>(std::istream& is, Chip8& st)
 {
-	st._access_lock.lock();
+	std::array<std::byte, Chip8::_Max_State_Size> buffer;
 	std::ios_base::iostate prev_state = is.exceptions();
 	is.exceptions(std::istream::eofbit | std::istream::failbit);
 	try
 	{
-		is.read(reinterpret_cast<char*>(&st._pc), sizeof(st._pc));
-		is.read(reinterpret_cast<char*>(&st._sp), sizeof(st._sp));
-		is.read(reinterpret_cast<char*>(&st._index), sizeof(st._index));
-		is.read(reinterpret_cast<char*>(&st._delay), sizeof(st._delay));
-		is.read(reinterpret_cast<char*>(&st._sound), sizeof(st._sound));
-		is.read(reinterpret_cast<char*>(&st._sounding), sizeof(st._sounding));
-		is.read(reinterpret_cast<char*>(&st._crashed), sizeof(st._crashed));
-		is.read(reinterpret_cast<char*>(&st._programmed), sizeof(st._programmed));
-		is.read(reinterpret_cast<char*>(&st._can_draw), sizeof(st._can_draw));
-		bool key_wait {0};
-		is.read(reinterpret_cast<char*>(&key_wait), sizeof(key_wait));
-		st._key_wait.store(key_wait);
-		is.read(reinterpret_cast<char*>(&st._time_budget), sizeof(st._time_budget));
-		is.read(reinterpret_cast<char*>(&st._timer), sizeof(st._timer));
-		is.read(reinterpret_cast<char*>(&st._gprf), sizeof(st._gprf));
-		is.read(reinterpret_cast<char*>(&st._mem), sizeof(st._mem));
-		is.read(reinterpret_cast<char*>(&st._screen), sizeof(st._screen));
+		// The header gives the size of the rest of the state.
+		is.read(reinterpret_cast<char*>(buffer.data()),
+			Chip8::_State_Header_Size);
+		const uint8_t* size_field {
+			reinterpret_cast<const uint8_t*>(buffer.data()) + 8};
+		uint32_t payload {get<uint32_t>(size_field)};
+		if (payload > buffer.size() - Chip8::_State_Header_Size)
+			throw std::ios_base::failure("Savestate is too large.");
+		is.read(reinterpret_cast<char*>(buffer.data())
+			+ Chip8::_State_Header_Size, payload);
+		st.load_state(std::span<const std::byte>(buffer.data(),
+			Chip8::_State_Header_Size + payload));
 	}
 	catch (std::ios_base::failure& e)
 	{
-		st.clear_state();
 		is.exceptions(prev_state);
-		st._access_lock.unlock();
 		throw e;
 	}
+	catch (std::invalid_argument& e)
+	{
+		is.exceptions(prev_state);
+		throw std::ios_base::failure(e.what());
+	}
 	is.exceptions(prev_state);
-	st._access_lock.unlock();
 	return is;
 }
 
 
-// Instructions with leading half bytes of 1, 2, A, and B.
-const std::map<uint8_t, Chip8::_InstrFunc> Chip8::_INSTRUCTIONS1 // kNNN
+// Ordered as the _Handler enumeration.
+template <typename Policy, Chip8::Platform P>
+constinit const Chip8::_HandlerTable Chip8::_HANDLER_TABLE
 {
-	{0x1, in_jump},
-	{0x2, in_call},
-	{0xa, in_loadi},
-	{0xb, in_jumpi},
+	in_invalid,
+	in_clr,			in_rts<Policy>,	in_jump,		in_call<Policy>,
+	in_ske,			in_skne,		in_skre,		in_load,
+	in_add,			in_move,		in_or<P>,		in_and<P>,
+	in_xor<P>,		in_addr,		in_sub,			in_shr<P>,
+	in_suba,		in_shl<P>,		in_skrne,		in_loadi,
+	in_jumpi<P>,	in_rand,		in_draw<Policy, P>,	in_skpr,
+	in_skup,		in_moved,		in_keyd,		in_loadd,
+	in_loads,		in_addi,		in_ldspr,		in_bcd<Policy>,
+	in_stor<Policy, P>,	in_read<Policy, P>,
+	quirks(P).hires ? in_scd : in_invalid,
+	quirks(P).bitplanes ? in_scu : in_invalid,
+	quirks(P).hires ? in_scr : in_invalid,
+	quirks(P).hires ? in_scl : in_invalid,
+	quirks(P).hires ? in_low : in_invalid,
+	quirks(P).hires ? in_high : in_invalid,
+	quirks(P).bitplanes ? in_plane : in_invalid,
+	quirks(P).hires ? in_ldbig : in_invalid,
 };
 
 
+template <typename Key, size_t N>
+std::map<Key, Chip8::_InstrFunc> Chip8::build_instructions(
+	const std::pair<Key, uint8_t> (&forms)[N])
+{
+	std::map<Key, _InstrFunc> instructions;
+	for (const auto& [key, handler] : forms)
+		instructions[key] = _HANDLER_TABLE<_Strict, Platform::chip8>[handler];
+	return instructions;
+}
+
+
+// Instructions with leading half bytes of 1, 2, A, and B. These and the
+// tables below list the strict instructions of the original Chip-8.
+const std::map<uint8_t, Chip8::_InstrFunc> Chip8::_INSTRUCTIONS1 // kNNN
+	{build_instructions(_FORMS1)};
+
+
 // Instructions with leading half bytes of 3, 4, 6, 7, and C.
 const std::map<uint8_t, Chip8::_InstrFunc> Chip8::_INSTRUCTIONS2 // kXNN
-{
-	{0x3, in_ske},
-	{0x4, in_skne},
-	{0x6, in_load},
-	{0x7, in_add},
-	{0xc, in_rand},
-};
+	{build_instructions(_FORMS2)};
 
 
 // Instructions with leading half bytes of 5, 8, and 9.
 const std::map<uint8_t, Chip8::_InstrFunc> Chip8::_INSTRUCTIONS3 // kXYk
-{
-	{0x50, in_skre},
-	{0x80, in_move},
-	{0x81, in_or},
-	{0x82, in_and},
-	{0x83, in_xor},
-	{0x84, in_addr},
-	{0x85, in_sub},
-	{0x86, in_shr},
-	{0x87, in_suba},
-	{0x8e, in_shl},
-	{0x90, in_skrne},
-};
+	{build_instructions(_FORMS3)};
 
 
 // Instructions with leading half bytes of E and F.
 const std::map<uint16_t, Chip8::_InstrFunc> Chip8::_INSTRUCTIONS4 // kXkk
+	{build_instructions(_FORMS4)};
+
+
+constexpr std::array<uint8_t, 0x10000> Chip8::build_decode_table()
 {
-	{0x0ea1, in_skup},
-	{0x0e9e, in_skpr},
-	{0x0f33, in_bcd},
-	{0x0f15, in_loadd},
-	{0x0f55, in_stor},
-	{0x0f65, in_read},
-	{0x0f07, in_moved},
-	{0x0f18, in_loads},
-	{0x0f29, in_ldspr},
-	{0x0f0a, in_keyd},
-	{0x0f1e, in_addi},
-};
+	std::array<uint8_t, 0x10000> table {}; // Everything starts as H_INVALID.
+	table[0x00e0] = H_CLR;
+	table[0x00ee] = H_RTS;
+	for (uint32_t i {0}; i < 0x1000; ++i) table[0xd000 | i] = H_DRAW; // DXYN
+
+	// The instructions of SUPER-CHIP and XO-CHIP, which are invalid on the
+	// platforms without them.
+	for (uint32_t n {1}; n < 0x10; ++n)
+	{
+		table[0x00c0 | n] = H_SCD;
+		table[0x00d0 | n] = H_SCU;
+	}
+	table[0x00fb] = H_SCR;
+	table[0x00fc] = H_SCL;
+	table[0x00fe] = H_LOW;
+	table[0x00ff] = H_HIGH;
+	for (uint32_t x {0}; x < 0x10; ++x) table[0xf030 | x << 8] = H_LDBIG;
+	for (uint32_t n {0}; n < 4; ++n) table[0xf001 | n << 8] = H_PLANE;
+
+	// Forms kNNN and kXNN are decoded by their leading half byte alone.
+	for (const auto& [a, handler] : _FORMS1)
+		for (uint32_t i {0}; i < 0x1000; ++i) table[(a << 12) | i] = handler;
+	for (const auto& [a, handler] : _FORMS2)
+		for (uint32_t i {0}; i < 0x1000; ++i) table[(a << 12) | i] = handler;
+
+	// Form kXYk is decoded by its leading and trailing half bytes.
+	for (const auto& [key, handler] : _FORMS3)
+		for (uint32_t xy {0}; xy < 0x100; ++xy)
+			table[((key & 0xf0U) << 8) | (xy << 4) | (key & 0x0fU)] = handler;
+
+	// Form kXkk is decoded by its leading half byte and trailing byte.
+	for (const auto& [key, handler] : _FORMS4)
+		for (uint32_t x {0}; x < 0x10; ++x)
+			table[((key & 0xf00U) << 4) | (x << 8) | (key & 0xffU)] = handler;
+
+	return table;
+}
+
+
+constinit const std::array<uint8_t, 0x10000> Chip8::_DECODE_TABLE
+	{build_decode_table()};
 
 
 Chip8::Chip8(Chip8Keyboard* key, Chip8Display* disp, Chip8Sound* snd)
 	: _keyboard(key), _display(disp), _speaker(snd)
 {
 	_display->_vm = this;
+	_speaker->_vm = this;
 }
 
 
+Chip8::~Chip8() = default;
+
+
 void Chip8::clear_state()
 {
 	_pc = _Prog_Start;
@@ -197,542 +289,965 @@ void Chip8::clear_state()
 	_programmed = false;
 	_can_draw = true;
 	_key_wait = false;
-	_time_budget = _TimeType();
-	_timer = _TimeType();
+	_loop_hint = false;
+	_time_budget = 0;
+	_timer = 0;
+	_rng = seed_random(_seed);
+	_cycle = 0;
 	memset(&_gprf,   0, sizeof(_gprf)   );
 	memset(&_mem,    0, sizeof(_mem)    );
-	memset(&_screen, 0, sizeof(_screen) );
+	_written_pages = UINT16_MAX;
+	_screen = Chip8Screen();
+	_plane_mask = 1;
+	if (_block_cache) _block_cache->clear();
+	if (_compiled) _compiled->attach(*this);
+	_dirty_rows = UINT64_MAX;
+	publish_screen();
 }
 
 
-void Chip8::load_program(std::string& program)
+void Chip8::load_program(const std::string& program)
+{
+	load_program(std::span<const uint8_t>(
+		reinterpret_cast<const uint8_t*>(program.data()), program.size()));
+}
+
+
+void Chip8::load_program(std::span<const uint8_t> program)
 {
 	// Verify the program isn't odd or too large.
 	if (program.size() > _Max_Prog_Size)
 		throw std::invalid_argument("Program is too large.");
 	
-	_access_lock.lock();
 	clear_state();
-	// Load the font.
+	// Load the fonts.
 	memcpy(&_mem[_font_off], _font, sizeof(_font));
+	if (quirks(_platform).hires)
+		memcpy(&_mem[_big_font_off], _big_font, sizeof(_big_font));
 	// Copy the program into memory.
-	memcpy(&_mem[_Prog_Start], (void*) program.data(), program.length());
+	memcpy(&_mem[_Prog_Start], program.data(), program.size());
 	_programmed = true;
-	_access_lock.unlock();
+	if (_compiled) _compiled->attach(*this);
+	if (_rewind) _rewind->clear();
 }
 
 
-Chip8::_InstrFunc Chip8::get_instr_func(uint16_t instruction)
+size_t Chip8::save_state(std::span<std::byte> buffer)
 {
-	// Grab the halfwords of the instruction.
-	uint8_t a = instr_a(instruction);
-	uint8_t b = instr_b(instruction);
-	uint8_t c = instr_c(instruction);
-	uint8_t d = instr_d(instruction);
-	_InstrFunc func;
-	
-	try // Use the instruction to determine which map to search.
+	std::array<uint8_t, _Max_State_Size> state;
+	size_t size {write_state(state.data())};
+
+	if (buffer.size() < size)
+		throw std::length_error("Savestate does not fit in the buffer.");
+	memcpy(buffer.data(), state.data(), size);
+	return size;
+}
+
+
+size_t Chip8::load_state(std::span<const std::byte> buffer)
+{
+	return read_state(reinterpret_cast<const uint8_t*>(buffer.data()),
+		buffer.size());
+}
+
+
+size_t Chip8::write_state(uint8_t* out)
+{
+	size_t payload {encode_state(out + _State_Header_Size)};
+	uint32_t crc {crc32(out + _State_Header_Size, payload)};
+	memcpy(out, _State_Magic, sizeof(_State_Magic));
+	out += sizeof(_State_Magic);
+	put<uint16_t>(out, _State_Version);
+	put<uint16_t>(out, 0);
+	put<uint32_t>(out, payload);
+	put<uint32_t>(out, crc);
+	return _State_Header_Size + payload;
+}
+
+
+size_t Chip8::read_state(const uint8_t* in, size_t size)
+{
+	if (size < _State_Header_Size
+		|| memcmp(in, _State_Magic, sizeof(_State_Magic)) != 0)
+		throw std::invalid_argument("Not a savestate.");
+	in += sizeof(_State_Magic);
+	if (get<uint16_t>(in) != _State_Version)
+		throw std::invalid_argument("Unsupported savestate version.");
+	if (get<uint16_t>(in) != 0)
+		throw std::invalid_argument("Unsupported savestate flags.");
+	uint32_t payload {get<uint32_t>(in)};
+	uint32_t crc {get<uint32_t>(in)};
+	if (payload > size - _State_Header_Size)
+		throw std::invalid_argument("Savestate is truncated.");
+	if (crc32(in, payload) != crc)
+		throw std::invalid_argument("Savestate is corrupt.");
+	decode_state(in, payload);
+	return _State_Header_Size + payload;
+}
+
+
+size_t Chip8::encode_state(uint8_t* out, bool sparse)
+{
+	uint8_t* start {out};
+	uint16_t pages {UINT16_MAX};
+	for (uint16_t p = 0; sparse && p < _mem.size() / _State_Page_Size; ++p)
+	{
+		const uint8_t* page {&_mem[p * _State_Page_Size]};
+		if (page[0] == 0 && memcmp(page, page + 1, _State_Page_Size - 1) == 0)
+			pages &= ~(1 << p);
+	}
+	// Screen pages are each side of each plane in turn.
+	std::array<const std::array<uint64_t, Chip8Screen::rows>*, 4> sides {
+		&_screen.plane[0].left, &_screen.plane[0].right,
+		&_screen.plane[1].left, &_screen.plane[1].right};
+	uint8_t screen_pages {0};
+	for (size_t p = 0; p < sides.size(); ++p)
+		if (!sparse || std::any_of(sides[p]->begin(), sides[p]->end(),
+			[](uint64_t row) { return row != 0; }))
+			screen_pages |= 1 << p;
+	uint8_t flags = (_sounding ? F_SOUNDING : 0) | (_crashed ? F_CRASHED : 0)
+		| (_programmed ? F_PROGRAMMED : 0) | (_can_draw ? F_CAN_DRAW : 0)
+		| (_key_wait ? F_KEY_WAIT : 0) | (_screen.hires ? F_HIRES : 0);
+
+	put<uint16_t>(out, _pc);
+	put<uint16_t>(out, _sp);
+	put<uint16_t>(out, _index);
+	put<uint8_t>(out, _delay);
+	put<uint8_t>(out, _sound);
+	put<uint8_t>(out, flags);
+	put<uint8_t>(out, _plane_mask);
+	put<uint16_t>(out, pages);
+	put<uint8_t>(out, screen_pages);
+	put<uint8_t>(out, static_cast<uint8_t>(_platform));
+	put<uint32_t>(out, _freq);
+	put<int64_t>(out, _time_budget);
+	put<int64_t>(out, _timer);
+	memcpy(out, _gprf.data(), sizeof(_gprf));
+	out += sizeof(_gprf);
+	put<uint64_t>(out, _rng);
+	put<uint64_t>(out, _cycle);
+	assert(out - start == _State_Fixed_Size);
+	for (uint16_t p = 0; p < _mem.size() / _State_Page_Size; ++p)
 	{
-		switch (a)
+		if (!(pages & 1 << p)) continue;
+		memcpy(out, &_mem[p * _State_Page_Size], _State_Page_Size);
+		out += _State_Page_Size;
+	}
+	for (size_t p = 0; p < sides.size(); ++p)
+	{
+		if (!(screen_pages & 1 << p)) continue;
+		for (uint64_t row : *sides[p]) put<uint64_t>(out, row);
+	}
+	return out - start;
+}
+
+
+void Chip8::decode_state(const uint8_t* in, size_t size)
+{
+	// Check the payload before any of the state is overwritten.
+	if (size < _State_Fixed_Size)
+		throw std::invalid_argument("Savestate is truncated.");
+	uint8_t flags {in[8]};
+	uint8_t plane_mask {in[9]};
+	uint16_t pages {static_cast<uint16_t>(in[10] | in[11] << 8)};
+	uint8_t screen_pages {in[12]};
+	uint8_t platform {in[13]};
+	uint32_t freq {static_cast<uint32_t>(in[14] | in[15] << 8 | in[16] << 16
+		| static_cast<uint32_t>(in[17]) << 24)};
+	constexpr size_t screen_page_size {_State_Screen_Size / 4};
+	if (flags & ~(F_SOUNDING | F_CRASHED | F_PROGRAMMED | F_CAN_DRAW
+		| F_KEY_WAIT | F_HIRES))
+		throw std::invalid_argument("Savestate has unknown flags.");
+	if (plane_mask > 3 || screen_pages > 15)
+		throw std::invalid_argument("Savestate has an invalid screen.");
+	if (platform > static_cast<uint8_t>(Platform::xochip))
+		throw std::invalid_argument("Savestate has an unknown platform.");
+	if (freq == 0 || freq > max_frequency)
+		throw std::invalid_argument("Savestate has an invalid frequency.");
+	if (size != _State_Fixed_Size
+		+ static_cast<size_t>(std::popcount(pages)) * _State_Page_Size
+		+ static_cast<size_t>(std::popcount(screen_pages)) * screen_page_size)
+		throw std::invalid_argument("Savestate has the wrong size.");
+
+	_pc = get<uint16_t>(in);
+	_sp = get<uint16_t>(in);
+	_index = get<uint16_t>(in);
+	_delay = get<uint8_t>(in);
+	_sound = get<uint8_t>(in);
+	// Flags, plane mask, page masks, platform, and frequency have already
+	// been read.
+	in += 10;
+	_sounding = flags & F_SOUNDING;
+	_crashed = flags & F_CRASHED;
+	_programmed = flags & F_PROGRAMMED;
+	_can_draw = flags & F_CAN_DRAW;
+	_key_wait = flags & F_KEY_WAIT;
+	_screen.hires = flags & F_HIRES;
+	_plane_mask = plane_mask;
+	_platform = static_cast<Platform>(platform);
+	// The timing is kept in units of the frequency it was saved at.
+	_time_budget = rescale(get<int64_t>(in), _freq, freq);
+	_timer = rescale(get<int64_t>(in), _freq, freq);
+	memcpy(_gprf.data(), in, sizeof(_gprf));
+	in += sizeof(_gprf);
+	_rng = get<uint64_t>(in);
+	_cycle = get<uint64_t>(in);
+	for (uint16_t p = 0; p < _mem.size() / _State_Page_Size; ++p)
+	{
+		uint8_t* page {&_mem[p * _State_Page_Size]};
+		if (!(pages & 1 << p)) memset(page, 0, _State_Page_Size);
+		else
 		{
-			case 0x0: // Leading half byte 0.
-				if (instruction == 0x00E0) func = in_clr;
-				else if (instruction == 0x00EE) func = in_rts;
-				else throw std::out_of_range("");
-				break;
-
-			case 0xD: // DXYN
-				func = in_draw;
-				break;
-
-			// Leading half bytes 1, 2, A, and B.
-			case 0X1:	case 0x2:	case 0xA:	case 0xB:
-				func = _INSTRUCTIONS1.at(a);
-				break;
-
-			// Leading half bytes 3, 4, 6, 7, and C.
-			case 0x3:	case 0x4:	case 0x6:	case 0x7:	case 0xC:
-				func = _INSTRUCTIONS2.at(a);
-				break;
-
-			case 0xE:	case 0xF: // Leading half bytes E and F.
-				func = _INSTRUCTIONS4.at(((uint16_t) a << 8) + (c << 4) + d);
-				break;
-				
-			default: // Leading half bytes 5, 8, and 9.
-				func = _INSTRUCTIONS3.at((a << 4) + d);
-				break;
+			memcpy(page, in, _State_Page_Size);
+			in += _State_Page_Size;
 		}
-
-	// Catch and rethrow invalid instruction accesses.
 	}
-	catch (std::out_of_range& e)
+	std::array<std::array<uint64_t, Chip8Screen::rows>*, 4> sides {
+		&_screen.plane[0].left, &_screen.plane[0].right,
+		&_screen.plane[1].left, &_screen.plane[1].right};
+	for (size_t p = 0; p < sides.size(); ++p)
+		for (uint64_t& row : *sides[p])
+			row = screen_pages & 1 << p ? get<uint64_t>(in) : 0;
+	_written_pages = UINT16_MAX;
+
+	if (_block_cache) _block_cache->clear();
+	if (_compiled) _compiled->attach(*this);
+	_dirty_rows = UINT64_MAX;
+	publish_screen();
+}
+
+
+const Chip8::_HandlerTable& Chip8::handler_table(Access access,
+	Platform platform)
+{
+	bool fast {access == Access::fast};
+	switch (platform)
 	{
-		std::stringstream msg;
-		msg << "Invalid Chip-8 instruction: "
-			<< std::uppercase << std::hex << instruction;
-		throw Chip8Error(msg.str());
+		case Platform::chip48:
+			return fast ? _HANDLER_TABLE<_Fast, Platform::chip48>
+				: _HANDLER_TABLE<_Strict, Platform::chip48>;
+		case Platform::schip:
+			return fast ? _HANDLER_TABLE<_Fast, Platform::schip>
+				: _HANDLER_TABLE<_Strict, Platform::schip>;
+		case Platform::xochip:
+			return fast ? _HANDLER_TABLE<_Fast, Platform::xochip>
+				: _HANDLER_TABLE<_Strict, Platform::xochip>;
+		default:
+			return fast ? _HANDLER_TABLE<_Fast, Platform::chip8>
+				: _HANDLER_TABLE<_Strict, Platform::chip8>;
 	}
-	return func;
 }
 
 
 void Chip8::execute_batch(_TimeType elapsed_time)
 {
 	if (_crashed) throw Chip8Error("VM has already crashed.");
+	if (_debugger && _debugger->stopped()) return;
 
-	_access_lock.lock();
-	_TimeType cycle_period {_billion / _freq};
-	_time_budget += elapsed_time;
-	_TimeType cycles {_time_budget / cycle_period.count()};
+#ifdef CHIP8_INSTRUMENT
+	auto start {std::chrono::steady_clock::now()};
+#endif
+	// Whole seconds are converted apart, so the product can't overflow.
+	_time_budget += elapsed_time.count() % _billion * _freq;
+	int64_t cycles {elapsed_time.count() / _billion * _freq
+		+ _time_budget / _billion};
+	_time_budget %= _billion;
 
 	try
 	{
-		for (int64_t i {0}; i < cycles.count(); ++i)
+		// The policy and platform are chosen once per batch so each cycle runs
+		// unbranched, and only a debugger's batches check for it.
+		if (_debugger)
 		{
-			execute_cycle(cycle_period);
-			_time_budget -= cycle_period;
+			if (_access == Access::fast) execute_platform<_Debug<_Fast>>(cycles);
+			else execute_platform<_Debug<_Strict>>(cycles);
 		}
+		else if (_access == Access::fast) execute_platform<_Fast>(cycles);
+		else execute_platform<_Strict>(cycles);
 	}
 	catch (Chip8Error& e)
 	{
-		_access_lock.unlock();
+		publish_screen(); // Show the screen as it was at the crash.
+#ifdef CHIP8_INSTRUMENT
+		publish_stats(start, elapsed_time);
+#endif
 		_crashed = true;
 		throw e;
 	}
 	
-	_access_lock.unlock();
+#ifdef CHIP8_INSTRUMENT
+	publish_stats(start, elapsed_time);
+#endif
 }
 
 
-void Chip8::execute_cycle(_TimeType cycle_time)
+template <typename Policy>
+void Chip8::execute_platform(int64_t cycles)
 {
-	static constexpr _TimeType timer_period {_billion / 60U};
-	// Keep track of elapsed time to update the timers.
-	_timer += cycle_time;
-	// If the 60Hz timer has cycled, update the timers and reset it.
-	if (_timer >= timer_period)
+	switch (_platform)
 	{
-		long long timer_pulses {_timer.count() / timer_period.count()};
-		_timer %= timer_period;
-		if (_delay != 0) _delay -= timer_pulses;
-		if (_sound != 0) _sound -= timer_pulses;
-		_can_draw = true;
+		case Platform::chip48:
+			execute_cycles<Policy, Platform::chip48>(cycles);
+			break;
+		case Platform::schip:
+			execute_cycles<Policy, Platform::schip>(cycles);
+			break;
+		case Platform::xochip:
+			execute_cycles<Policy, Platform::xochip>(cycles);
+			break;
+		default:
+			execute_cycles<Policy, Platform::chip8>(cycles);
+			break;
 	}
-	else _can_draw = false;
-
-	if (_key_wait) return;
+}
 
-	// Grab and execute the next instruction.
-	if (_pc < _Prog_Start || _pc > _mem.size())
-		throw Chip8Error("PC is outside of the program range.");
 
-	// The above check avoids the exception of get_hword(_pc) here.
-	uint16_t instruction = get_hword(_pc);
-	_InstrFunc instr_func = get_instr_func(instruction);
-	try { instr_func(*this, instruction); }
-	catch (std::out_of_range& e)
+template <typename Policy, Chip8::Platform P>
+void Chip8::execute_cycles(int64_t cycles)
+{
+	while (cycles > 0)
 	{
-		std::stringstream msg;
-		msg	<< "Memory access violation: "
-			<< e.what();
-		throw Chip8Error(msg.str());
+		if (_input_log) _input_log->replay(*this);
+		// Cycles before the one that next ticks the timers, and before any
+		// input is due. Each cycle brings the tick _timer_freq closer.
+		int64_t run {(_freq - _timer - 1) / _timer_freq};
+		run = std::min(run, cycles);
+		if (_input_log)
+		{
+			uint64_t due {_input_log->next_cycle()};
+			if (due - _cycle < static_cast<uint64_t>(run))
+				run = static_cast<int64_t>(due - _cycle);
+		}
+		if (run > 0)
+		{
+			execute_run<Policy, P>(run);
+			// The rest of the batch is dropped once the debugger stops it.
+			if constexpr (Policy::debug)
+			{
+				if (_debugger->stopped()) return;
+			}
+			cycles -= run;
+			continue;
+		}
+
+		if constexpr (Policy::debug)
+		{
+			if (_debugger->check(*this)) return;
+		}
+		tick();
+		execute_cycle<Policy, P>();
+		update_sound();
+		++_cycle;
+		--cycles;
+		// Frames are recorded once the cycle that ended them completes.
+		if (_rewind) _rewind->capture(*this);
 	}
+}
 
-	// Set the sound output to reflect the value of the timer.
-	if (_sounding && _sound == 0)
+
+template <typename Policy, Chip8::Platform P>
+void Chip8::execute_run(int64_t cycles)
+{
+	_can_draw = false;
+	uint64_t start {_cycle};
+	uint64_t end {_cycle + cycles};
+	try
 	{
-		_speaker->stop_sound();
-		_sounding = false;
+		// The profiler and debugger see every cycle, so only the interpreter
+		// runs them.
+		if (!Policy::debug && _compiled && !_profiler)
+			execute_compiled<Policy, P>(end);
+		else if (!Policy::debug && _block_cache && !_profiler)
+			execute_blocks<Policy, P>(end);
+		else while (_cycle < end)
+		{
+			if constexpr (Policy::debug)
+			{
+				if (_debugger->check(*this)) break;
+			}
+			if (_key_wait || _loop_hint) [[unlikely]]
+			{
+				if (skip_idle(static_cast<int64_t>(end - _cycle))) continue;
+			}
+			execute_cycle<Policy, P>();
+			++_cycle;
+		}
 	}
-	else if (!_sounding && _sound >= 2)
+	catch (Chip8Error& e)
 	{
-		_speaker->start_sound();
-		_sounding = true;
+		// The time of the cycle that crashed has still passed.
+		_timer += (static_cast<int64_t>(_cycle - start) + 1) * _timer_freq;
+		throw e;
 	}
-
-	// Increment _pc if the instruction was not a jump, call, or wait.
-	if (instr_func != in_jump && instr_func != in_jumpi
-		&& instr_func != in_call && instr_func != in_keyd) _pc += 2;
+	_timer += static_cast<int64_t>(_cycle - start) * _timer_freq;
 }
 
 
-uint16_t Chip8::frequency()
+template <typename Policy, Chip8::Platform P>
+void Chip8::execute_blocks(uint64_t end)
 {
-	return _freq;
+	while (_cycle < end)
+	{
+		if (_key_wait || _loop_hint) [[unlikely]]
+		{
+			if (skip_idle(static_cast<int64_t>(end - _cycle))) continue;
+		}
+		// Waiting for a key, and PCs the interpreter has to reject, are left
+		// to it.
+		if (_key_wait || _pc < _Prog_Start || _pc >= _mem.size() - 1)
+			[[unlikely]]
+		{
+			execute_cycle<Policy, P>();
+			++_cycle;
+			continue;
+		}
+
+		// A block longer than the run has left is finished in the next.
+		const Chip8BlockCache::Block& block {_block_cache->find(*this)};
+		const Chip8BlockCache::Op* ops {block.ops.data()};
+		size_t count {static_cast<size_t>(std::min<uint64_t>(
+			block.ops.size(), end - _cycle))};
+		for (size_t i {0}; i < count; ++i)
+		{
+			// Copied out as the last instruction may discard the block.
+			Chip8BlockCache::Op op {ops[i]};
+#ifdef CHIP8_INSTRUMENT
+			++_stats.executed[op.handler];
+#endif
+			op.func(*this, op.instr);
+			if (op.advance) _pc += 2;
+			++_cycle;
+		}
+	}
 }
 
 
-void Chip8::frequency(uint16_t value)
+template <typename Policy, Chip8::Platform P>
+void Chip8::execute_compiled(uint64_t end)
 {
-	_access_lock.lock();
-	_freq = value;
-	_access_lock.unlock();
+	while (_cycle < end)
+	{
+		if (_key_wait || _loop_hint) [[unlikely]]
+		{
+			if (skip_idle(static_cast<int64_t>(end - _cycle))) continue;
+		}
+		// Blocks run whole, so one longer than the run has left is
+		// interpreted an instruction at a time.
+		const Chip8Compiled::Block* block {_compiled->find(_pc)};
+		if (block != nullptr && block->ops <= end - _cycle)
+			Chip8Compiled::run<Policy>(*this, *block);
+		else
+		{
+			execute_cycle<Policy, P>();
+			++_cycle;
+		}
+	}
 }
 
 
-bool Chip8::is_crashed()
+Chip8::Idle Chip8::idle()
 {
-	return _crashed;
+	if (_key_wait)
+		return _delay == 0 && _sound == 0 ? Idle::key : Idle::timer;
+	// The sound must also have caught up with its timer, as each cycle of the
+	// loop would otherwise start or stop it.
+	bool sound_settled {_sounding ? _sound != 0 : _sound < 2};
+	if (sound_settled && delay_loop()) return Idle::timer;
+	return Idle::none;
 }
 
 
-bool Chip8::is_sounding()
+bool Chip8::delay_loop()
 {
-	return _sounding;
+	if (_pc < _Prog_Start || _pc > _mem.size() - 6) return false;
+	uint16_t read {static_cast<uint16_t>(_mem[_pc] << 8 | _mem[_pc + 1])};
+	uint16_t skip {static_cast<uint16_t>(_mem[_pc + 2] << 8 | _mem[_pc + 3])};
+	uint16_t jump {static_cast<uint16_t>(_mem[_pc + 4] << 8 | _mem[_pc + 5])};
+	// Without a tick the delay timer keeps its value, as does every pass.
+	return (read & 0xf0ff) == 0xf007
+		&& (skip & 0xff00) == (0x3000 | (read & 0x0f00))
+		&& instr_imm(skip) != _delay && jump == (0x1000 | _pc);
 }
 
-bool Chip8::is_programmed()
+
+int64_t Chip8::skip_idle(int64_t cycles)
 {
-	return _programmed;
+	_loop_hint = false;
+	// The profiler samples every cycle, and breakpoints may be passed.
+	if (_profiler || _debugger) return 0;
+	Idle idle {this->idle()};
+	if (idle == Idle::none) return 0;
+
+	// A delay loop is only skipped by whole passes, which end where they
+	// started.
+	int64_t skipped {_key_wait ? cycles : cycles - cycles % 3};
+	if (skipped == 0) return 0;
+	if (!_key_wait) _gprf[_mem[_pc] & 0xf] = _delay;
+#ifdef CHIP8_INSTRUMENT
+	if (_key_wait) _stats.key_wait_cycles += skipped;
+	else
+	{
+		_stats.executed[H_MOVED] += skipped / 3;
+		_stats.executed[H_SKE] += skipped / 3;
+		_stats.executed[H_JUMP] += skipped / 3;
+	}
+	_stats.skipped_cycles += skipped;
+#endif
+	_cycle += skipped;
+	_skipped += skipped;
+	return skipped;
 }
 
 
-uint16_t Chip8::get_hword(uint16_t addr)
+template <typename Policy, Chip8::Platform P>
+inline void Chip8::execute_cycle()
 {
-	if (addr < 0 || addr >= _mem.size())
-		throw std::out_of_range("Invalid Chip-8 VM memory location.");
-	uint16_t hword {static_cast<uint16_t>(_mem.at(addr) << 8)};
-	hword += _mem.at(addr + 1);
-	return hword;
+	// Waiting for a key counts as time spent in FX0A.
+	if (_profiler) _profiler->sample(_pc);
+	if (_key_wait)
+	{
+#ifdef CHIP8_INSTRUMENT
+		++_stats.key_wait_cycles;
+#endif
+		return;
+	}
+
+	// Grab and execute the next instruction, which must lie within memory.
+	if (_pc < _Prog_Start || _pc >= _mem.size() - 1) [[unlikely]]
+	{
+		if (_pc < _Prog_Start || _pc > _mem.size())
+			throw Chip8Error("PC is outside of the program range.");
+		throw Chip8Error("Invalid Chip-8 VM memory location.");
+	}
+
+	// The above check keeps the whole instruction within memory.
+	uint16_t instruction {static_cast<uint16_t>(_mem[_pc] << 8 | _mem[_pc + 1])};
+	uint8_t handler {_DECODE_TABLE[instruction]};
+	_InstrFunc instr_func {_HANDLER_TABLE<Policy, P>[handler]};
+	// Increment _pc if the instruction was not a jump, call, or wait.
+	bool advance {handler != H_JUMP && handler != H_JUMPI
+		&& handler != H_CALL && handler != H_KEYD};
+#ifdef CHIP8_INSTRUMENT
+	++_stats.executed[handler];
+#endif
+
+	instr_func(*this, instruction);
+	if (advance) _pc += 2;
 }
 
 
-void Chip8::set_hword(uint16_t addr, uint16_t hword)
+void Chip8::tick()
 {
-	if (addr < 0 || addr >= _mem.size())
-		throw std::out_of_range("Invalid Chip-8 VM memory location.");
-	_mem.at(addr) = static_cast<uint8_t>(hword >> 8);
-	_mem.at(addr + 1) = static_cast<uint8_t>(hword & 0xffU);
+	// Frequencies below 60Hz tick more than once in a cycle.
+	_timer += _timer_freq;
+	int64_t timer_pulses {_timer / _freq};
+	_timer %= _freq;
+	// Timers stop at 0 rather than wrapping when several pulses pass at once.
+	_delay -= std::min<int64_t>(_delay, timer_pulses);
+	_sound -= std::min<int64_t>(_sound, timer_pulses);
+	_ticks += timer_pulses;
+	_can_draw = true;
+	// The tick ends a frame.
+	publish_screen();
+#ifdef CHIP8_INSTRUMENT
+	++_stats.frames;
+#endif
 }
 
 
-void Chip8::key_pressed(uint8_t key)
+void Chip8::update_sound()
 {
-	assert(key <= 0xf);
-	if (!_key_wait) return;
-
-	uint16_t instruction {0};
-	try { instruction = get_hword(_pc); }
-	catch(const std::exception& e)
-	{ throw Chip8Error(e.what()); }
-	_gprf[instr_b(instruction)] = key;
-	_pc += 2;
-	_pressed_key = key;
+	if (_sounding && _sound == 0)
+	{
+		_speaker->stop_sound();
+		_sounding = false;
+	}
+	else if (!_sounding && _sound >= 2)
+	{
+		_speaker->start_sound();
+		_sounding = true;
+	}
 }
 
 
-void Chip8::key_released(uint8_t key)
+uint32_t Chip8::frequency()
 {
-	assert(key <= 0xf);
-	if (key != _pressed_key) return;
-	_key_wait = false;
-	_pressed_key = _no_key;
+	return _freq;
 }
 
 
-uint64_t* Chip8::get_screen_buf()
+void Chip8::frequency(uint32_t value)
 {
-	return &_screen[0];
+	if (value == 0 || value > max_frequency)
+		throw std::invalid_argument("Invalid frequency.");
+	_time_budget = rescale(_time_budget, value, _freq);
+	_timer = rescale(_timer, value, _freq);
+	_freq = value;
 }
 
 
-// Instruction Implementing Methods ============================================
-void Chip8::in_sys(Chip8& vm, uint16_t instr) // 0NNN
+int64_t Chip8::rescale(int64_t value, uint32_t to, uint32_t from)
 {
-	// Originally called machine code instruction, does nothing here.
+	// The remainder is below from, so its product fits.
+	return value / from * to + value % from * to / from;
 }
 
 
-void Chip8::in_clr(Chip8& vm, uint16_t instr) // 00E0
+Chip8::Engine Chip8::engine()
 {
-	memset(&vm._screen, 0, sizeof(vm._screen));
-	vm._display->mark();
+	if (_block_cache) return Engine::block_cache;
+	return _compiled ? Engine::compiled : Engine::interpreter;
 }
 
 
-void Chip8::in_rts(Chip8& vm, uint16_t instr) // 00EE
+void Chip8::engine(Engine value)
 {
-	if (vm._sp <= 1) throw Chip8Error("VM call stack underflow.");
-	vm._sp -= 2;
-	vm._pc = vm.get_hword(vm._sp);
+	if (value == Engine::block_cache)
+	{
+		if (!_block_cache) _block_cache = std::make_unique<Chip8BlockCache>();
+	}
+	else _block_cache.reset();
+
+	if (value == Engine::compiled)
+	{
+		if (!_compiled)
+		{
+			_compiled = std::make_unique<Chip8Compiled>();
+			_compiled->attach(*this);
+		}
+	}
+	else _compiled.reset();
 }
 
 
-void Chip8::in_jump(Chip8& vm, uint16_t instr) // 1NNN
+Chip8::Access Chip8::access()
 {
-	vm._pc = instr_addr(instr);
+	return _access;
 }
 
 
-void Chip8::in_call(Chip8& vm, uint16_t instr) // 2NNN
+void Chip8::access(Access value)
 {
-	if (vm._sp >= _font_off - 1) throw Chip8Error("VM call stack overflow.");
-	vm.set_hword(vm._sp, vm._pc);
-	vm._sp += 2;
-	vm._pc = instr_addr(instr);
+	_access = value;
+	// Cached blocks hold the instruction implementations of the old policy.
+	if (_block_cache) _block_cache->clear();
 }
 
 
-void Chip8::in_ske(Chip8& vm, uint16_t instr) // 3XNN
+Chip8::Platform Chip8::platform()
 {
-	if (vm._gprf[instr_b(instr)] == instr_imm(instr)) vm._pc += 2;
+	return _platform;
 }
 
 
-void Chip8::in_skne(Chip8& vm, uint16_t instr) // 4XNN
+void Chip8::platform(Platform value)
 {
-	if (vm._gprf[instr_b(instr)] != instr_imm(instr)) vm._pc += 2;
+	// The big font is only in memory on platforms with the hires instructions,
+	// whether the program was loaded before or after the platform was set.
+	if (_programmed && quirks(value).hires != quirks(_platform).hires)
+	{
+		if (quirks(value).hires)
+			memcpy(&_mem[_big_font_off], _big_font, sizeof(_big_font));
+		else memset(&_mem[_big_font_off], 0, sizeof(_big_font));
+		mark_written(_big_font_off, sizeof(_big_font));
+	}
+	_platform = value;
+	// Cached blocks hold the instruction implementations of the old platform.
+	if (_block_cache) _block_cache->clear();
+	if (_compiled) _compiled->attach(*this);
 }
 
 
-void Chip8::in_skre(Chip8& vm, uint16_t instr) // 5XY0
+Chip8::Platform Chip8::detect_platform(std::span<const uint8_t> program)
 {
-	if (vm._gprf[instr_b(instr)] == vm._gprf[instr_c(instr)]) vm._pc += 2;
+	Platform found {Platform::chip8};
+	for (size_t i {0}; i + 1 < program.size(); i += 2)
+	{
+		uint16_t instr {
+			static_cast<uint16_t>(program[i] << 8 | program[i + 1])};
+		// 00DN and selecting the second plane with FN01 only exist on
+		// XO-CHIP.
+		if (((instr & 0xfff0) == 0x00d0 && instr != 0x00d0)
+			|| instr == 0xf101 || instr == 0xf201 || instr == 0xf301)
+			return Platform::xochip;
+		// 00CN, 00FB to 00FF, FX75, and FX85 only exist on SUPER-CHIP and
+		// later. FX30 does too, but is too common in sprite data to go by.
+		if (((instr & 0xfff0) == 0x00c0 && instr != 0x00c0)
+			|| (instr >= 0x00fb && instr <= 0x00ff)
+			|| (instr & 0xf0ff) == 0xf075 || (instr & 0xf0ff) == 0xf085)
+			found = Platform::schip;
+	}
+	return found;
 }
 
 
-void Chip8::in_load(Chip8& vm, uint16_t instr) // 6XNN
+void Chip8::rewind(Chip8Rewind* history)
 {
-	vm._gprf[instr_b(instr)] = instr_imm(instr);
+	_rewind = history;
 }
 
 
-void Chip8::in_add(Chip8& vm, uint16_t instr) // 7XNN
+void Chip8::input_log(Chip8InputLog* log)
 {
-	vm._gprf[instr_b(instr)] += instr_imm(instr);
+	_input_log = log;
 }
 
 
-void Chip8::in_move(Chip8& vm, uint16_t instr)
-{ // 8XY0
-	vm._gprf[instr_b(instr)] = vm._gprf[instr_c(instr)];
+void Chip8::profiler(Chip8Profiler* profiler)
+{
+	_profiler = profiler;
 }
 
 
-void Chip8::in_or(Chip8& vm, uint16_t instr) // 8XY1
+void Chip8::debugger(Chip8Debugger* debugger)
 {
-	vm._gprf[instr_b(instr)]
-		= vm._gprf[instr_b(instr)] | vm._gprf[instr_c(instr)];
-	vm._gprf[0xf] = 0x00; // Quirk of the original Chip-8.
+	_debugger = debugger;
 }
 
 
-void Chip8::in_and(Chip8& vm, uint16_t instr) // 8XY2
+uint64_t Chip8::seed()
 {
-	vm._gprf[instr_b(instr)]
-		= vm._gprf[instr_b(instr)] & vm._gprf[instr_c(instr)];
-	vm._gprf[0xf] = 0x00; // Quirk of the original Chip-8.
+	return _seed;
 }
 
 
-void Chip8::in_xor(Chip8& vm, uint16_t instr) // 8XY3
+void Chip8::seed(uint64_t value)
 {
-	vm._gprf[instr_b(instr)]
-		= vm._gprf[instr_b(instr)] ^ vm._gprf[instr_c(instr)];
-	vm._gprf[0xf] = 0x00; // Quirk of the original Chip-8.
+	_seed = value;
+	_rng = seed_random(value);
 }
 
 
-void Chip8::in_addr(Chip8& vm, uint16_t instr) // 8XY4
+uint64_t Chip8::cycles()
 {
-	uint8_t b {vm._gprf[instr_b(instr)]};
-	uint8_t c {vm._gprf[instr_c(instr)]};
-	uint8_t sum {static_cast<uint8_t>(b + c)};
-	vm._gprf[instr_b(instr)] = sum;
+	return _cycle;
+}
+
 
-	if (sum < b) vm._gprf[0xf] = 0x01;
-	else vm._gprf[0xf] = 0x00;
+Chip8::_TimeType Chip8::cycles_duration(uint64_t cycles)
+{
+	// Whole seconds are converted apart, so the product can't overflow. The
+	// rest is rounded up to reach the last cycle.
+	int64_t rest {static_cast<int64_t>(cycles % _freq) * _billion
+		- _time_budget};
+	int64_t rest_ns {rest > 0 ? (rest + _freq - 1) / _freq : -(-rest / _freq)};
+	return _TimeType(std::max<int64_t>(0,
+		static_cast<int64_t>(cycles / _freq) * _billion + rest_ns));
 }
 
 
-void Chip8::in_sub(Chip8& vm, uint16_t instr) // 8XY5
+uint64_t Chip8::ticks()
 {
-	uint8_t b {vm._gprf[instr_b(instr)]};
-	uint8_t c {vm._gprf[instr_c(instr)]};
-	uint8_t difference {static_cast<uint8_t>(b - c)};
-	vm._gprf[instr_b(instr)] = difference;
+	return _ticks;
+}
 
-	if (difference > b) vm._gprf[0xf] = 0x00;
-	else vm._gprf[0xf] = 0x01;
+
+uint64_t Chip8::skipped_cycles()
+{
+	return _skipped;
 }
 
 
-void Chip8::in_shr(Chip8& vm, uint16_t instr) // 8XY6
+bool Chip8::is_crashed()
 {
-	uint8_t opY {vm._gprf[instr_c(instr)]};
-	vm._gprf[instr_b(instr)] = opY >> 1;
-	vm._gprf[0xf] = opY & 0x01;
+	return _crashed;
 }
 
 
-void Chip8::in_suba(Chip8& vm, uint16_t instr) // 8XY7
+bool Chip8::is_sounding()
 {
-	uint8_t b {vm._gprf[instr_b(instr)]};
-	uint8_t c {vm._gprf[instr_c(instr)]};
-	uint8_t difference {static_cast<uint8_t>(c - b)};
-	vm._gprf[instr_b(instr)] = difference;
+	return _sounding;
+}
 
-	if (difference > c) vm._gprf[0xf] = 0x00;
-	else vm._gprf[0xf] = 0x01;
+bool Chip8::is_programmed()
+{
+	return _programmed;
 }
 
 
-void Chip8::in_shl(Chip8& vm, uint16_t instr) // 8XYE
+uint16_t Chip8::get_hword(uint16_t addr)
 {
-	uint8_t opY {vm._gprf[instr_c(instr)]};
-	vm._gprf[instr_b(instr)] = opY << 1;
-	vm._gprf[0xf] = (opY & 0x80) >> 7;
+	if (addr < 0 || addr >= _mem.size())
+		throw std::out_of_range("Invalid Chip-8 VM memory location.");
+	uint16_t hword {static_cast<uint16_t>(_mem.at(addr) << 8)};
+	hword += _mem.at(addr + 1);
+	return hword;
 }
 
 
-void Chip8::in_skrne(Chip8& vm, uint16_t instr)
-{ // 9XY0
-	if (vm._gprf[instr_b(instr)] != vm._gprf[instr_c(instr)]) vm._pc += 2;
+void Chip8::set_hword(uint16_t addr, uint16_t hword)
+{
+	if (addr < 0 || addr >= _mem.size())
+		throw std::out_of_range("Invalid Chip-8 VM memory location.");
+	_mem.at(addr) = static_cast<uint8_t>(hword >> 8);
+	_mem.at(addr + 1) = static_cast<uint8_t>(hword & 0xffU);
+	mark_written(addr, 2);
 }
 
 
-void Chip8::in_loadi(Chip8& vm, uint16_t instr) // ANNN
+void Chip8::key_pressed(uint8_t key)
 {
-	vm._index = instr_addr(instr);
+	assert(key <= 0xf);
+	_keypad.fetch_or(static_cast<uint16_t>(1U << key),
+		std::memory_order_relaxed);
+	if (!_input_log || _input_log->record_key(*this, true, key))
+		press_key(key);
 }
 
 
-void Chip8::in_jumpi(Chip8& vm, uint16_t instr) // BNNN
+void Chip8::key_released(uint8_t key)
 {
-	vm._pc = vm._gprf[0x0] + instr_addr(instr);
+	assert(key <= 0xf);
+	_keypad.fetch_and(static_cast<uint16_t>(~(1U << key)),
+		std::memory_order_relaxed);
+	if (!_input_log || _input_log->record_key(*this, false, key))
+		release_key(key);
 }
 
 
-void Chip8::in_rand(Chip8& vm, uint16_t instr) // CXNN
+uint16_t Chip8::keypad() const
 {
-	vm._gprf[instr_b(instr)] = (rand() % 256) & instr_imm(instr);
+	return _keypad.load(std::memory_order_relaxed);
 }
 
 
-void Chip8::in_draw(Chip8& vm, uint16_t instr) // DXYN
+void Chip8::keypad(uint16_t keys)
 {
-	// Only draw just after a "screen refresh" (prevented V-tearing originally).
-	if (!vm._can_draw)
-	{
-		vm._pc -= 2;
-		return;
-	}
+	_keypad.store(keys, std::memory_order_relaxed);
+}
 
-	vm._gprf[0xf] = 0x00; // Assume no overwrite for now.
-	// Grab the sprite coordinates, number of lines to draw, and the x shift.
-	uint8_t xpos { vm._gprf[instr_b(instr)] % 64U };
- 	uint8_t ypos { vm._gprf[instr_c(instr)] % 32U };
-	int y_max { std::min(static_cast<int>(instr_d(instr)), 32 - ypos) };
-	int x_shift {56 - xpos};
 
-	// Iterate over each line of the sprite.
-	for (uint8_t y {0}; y < y_max; ++y)
-	{
-		// Grab the row from the sprite.
-		uint64_t spr_line {static_cast<uint64_t>(vm._mem.at(vm._index + y))};
-		// Shift the sprite row left or right.
-		if (x_shift >= 0) spr_line = spr_line << x_shift;
-		else spr_line = spr_line >> (-1 * x_shift);
-		// Determine the new screen line.
-		uint64_t new_line {vm._screen.at(ypos + y) ^ spr_line};
-		// Set the flag if an overrite happened.
-		if (vm._screen.at(ypos + y) & spr_line) vm._gprf[0xf] = 0x01;
-		// Update the screen memory with the new line.
-		vm._screen.at(ypos + y) = new_line;
-	}
-	vm._display->mark();
+void Chip8::press_key(uint8_t key)
+{
+	if (!_key_wait) return;
+
+	uint16_t instruction {0};
+	try { instruction = get_hword(_pc); }
+	catch(const std::exception& e)
+	{ throw Chip8Error(e.what()); }
+	_gprf[instr_b(instruction)] = key;
+	_pc += 2;
+	_pressed_key = key;
 }
 
 
-void Chip8::in_skpr(Chip8& vm, uint16_t instr) // EX9E
+void Chip8::release_key(uint8_t key)
 {
-	if (vm._keyboard->test_key(vm._gprf[instr_b(instr)])) vm._pc += 2;
+	if (key != _pressed_key) return;
+	_key_wait = false;
+	_pressed_key = _no_key;
 }
 
 
-void Chip8::in_skup(Chip8& vm, uint16_t instr) // EXA1
+bool Chip8::test_key(uint8_t key)
 {
-	if (!vm._keyboard->test_key(vm._gprf[instr_b(instr)])) vm._pc += 2;
+	if (_input_log) [[unlikely]] return _input_log->test_key(*this, key);
+	return poll_key(key);
 }
 
 
-void Chip8::in_moved(Chip8& vm, uint16_t instr) // FX07
+bool Chip8::poll_key(uint8_t key)
 {
-	vm._gprf[instr_b(instr)] = vm._delay;
+	if (_keyboard) [[unlikely]] return _keyboard->test_key(key);
+	// Keys that don't exist are never held down.
+	return key <= 0xf
+		&& (_keypad.load(std::memory_order_relaxed) >> key & 1U) != 0;
 }
 
 
-void Chip8::in_keyd(Chip8& vm, uint16_t instr) // FX0A
+uint64_t Chip8::seed_random(uint64_t seed)
 {
-	vm._key_wait = true;
+	uint64_t state {0};
+	next_random(state);
+	state += seed;
+	next_random(state);
+	return state;
 }
 
 
-void Chip8::in_loadd(Chip8& vm, uint16_t instr) // FX15
+uint8_t Chip8::next_random(uint64_t& state)
 {
-	vm._delay = vm._gprf[instr_b(instr)];
+	uint64_t old {state};
+	state = old * 6364136223846793005ULL + 1442695040888963407ULL;
+	uint32_t shifted {static_cast<uint32_t>(((old >> 18) ^ old) >> 27)};
+	uint32_t rot {static_cast<uint32_t>(old >> 59)};
+	return static_cast<uint8_t>(std::rotr(shifted, rot) >> 24);
 }
 
 
-void Chip8::in_loads(Chip8& vm, uint16_t instr) // FX18
+uint64_t* Chip8::get_screen_buf()
 {
-	vm._sound = vm._gprf[instr_b(instr)];
+	return _screen.plane[0].left.data();
 }
 
 
-void Chip8::in_addi(Chip8& vm, uint16_t instr) // FX1E
+const Chip8Screen& Chip8::get_screen()
 {
-	vm._index += vm._gprf[instr_b(instr)];
+	return _screen;
 }
 
 
-void Chip8::in_ldspr(Chip8& vm, uint16_t instr) // FX29
+uint64_t Chip8::fingerprint()
 {
-	vm._index = _font_off + vm._gprf[instr_b(instr)] * 5;
+	uint64_t hash {0xcbf29ce484222325};
+	for (const Chip8Screen::Plane& plane : _screen.plane)
+	{
+		for (uint64_t row : plane.left) hash = fnv1a(hash, row);
+		for (uint64_t row : plane.right) hash = fnv1a(hash, row);
+	}
+	hash = fnv1a(hash, _screen.hires);
+	for (uint8_t reg : _gprf) hash = fnv1a(hash, reg);
+	hash = fnv1a(hash, _index);
+	hash = fnv1a(hash, _pc);
+	hash = fnv1a(hash, _sp);
+	hash = fnv1a(hash, _delay);
+	return fnv1a(hash, _sound);
 }
 
 
-// Employs the Double Dabble algorithm.
-void Chip8::in_bcd(Chip8& vm, uint16_t instr) // FX33
+const Chip8Stats& Chip8::stats()
 {
-	static constexpr uint32_t hundreds = 0xf0000U;
-	static constexpr uint32_t tens = 0xf000U;
-	static constexpr uint32_t ones = 0xf00U;
+#ifdef CHIP8_INSTRUMENT
+	return _stats_out.latest();
+#else
+	static const Chip8Stats none;
+	return none;
+#endif
+}
 
-	// Grab the initial value from the register.
-	uint32_t scratch {vm._gprf[instr_b(instr)]};
 
-	for (size_t i {0}; i < 7; ++i)
-	{
-		scratch = scratch << 1; // Shift in each bit of the value.
-		// Add 3 to each digit if greater than 4.
-		if ((scratch & hundreds) > 0x40000)
-			scratch += 0x30000;
-		if ((scratch & tens) > 0x4000)
-			scratch += 0x3000;
-		if ((scratch & ones) > 0x400)
-			scratch += 0x300;
-	}
-	
-	scratch = scratch << 1; // Make the last shift.
+const Chip8FrameBuffer::Frame& Chip8::latest_frame()
+{
+	return _frames.latest();
+}
 
-	// Store each digit in memory.
-	vm._mem.at(vm._index) = (scratch & hundreds) >> 16;
-	vm._mem.at(vm._index + 1) = (scratch & tens) >> 12;
-	vm._mem.at(vm._index + 2) = (scratch & ones) >> 8;
+
+uint64_t Chip8::frame_sequence()
+{
+	return _frames.sequence();
 }
 
 
-void Chip8::in_stor(Chip8& vm, uint16_t instr) // FX55
+void Chip8::publish_screen()
 {
-	for (uint8_t i {0}; i <= instr_b(instr); ++i)
-		vm._mem.at(vm._index ++) = vm._gprf[i];
+	if (_dirty_rows == 0) return;
+	_frames.publish(_screen, _dirty_rows);
+	_dirty_rows = 0;
 }
 
 
-void Chip8::in_read(Chip8& vm, uint16_t instr) // FX65
+#ifdef CHIP8_INSTRUMENT
+void Chip8::publish_stats(std::chrono::steady_clock::time_point start,
+	_TimeType budget)
 {
-	for (uint8_t i {0}; i <= instr_b(instr); ++i)
-		vm._gprf[i] = vm._mem.at(vm._index ++);
+	uint64_t wall {static_cast<uint64_t>(_TimeType(
+		std::chrono::steady_clock::now() - start).count())};
+	++_stats.batches;
+	_stats.batch_ns += wall;
+	_stats.budget_ns += budget.count();
+	_stats.last_batch_ns = wall;
+	_stats.last_budget_ns = budget.count();
+	_stats.max_batch_ns = std::max(_stats.max_batch_ns, wall);
+	_stats_out.publish(_stats);
 }
+#endif
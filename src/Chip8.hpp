@@ -1,15 +1,21 @@
 #pragma once
 
+#include "Chip8FrameBuffer.hpp"
 #include "Chip8Observers.hpp"
+#include "Chip8Screen.hpp"
+#include "Chip8Stats.hpp"
 #include <array>
 #include <atomic>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <map>
-#include <mutex>
+#include <memory>
 #include <iostream>
+#include <span>
 #include <string>
 #include <thread>
+#include <utility>
 
 
 /**
@@ -21,9 +27,36 @@ struct Chip8Error : public std::runtime_error
 };
 
 
+// Forward declaration of the optional basic block cache engine.
+class Chip8BlockCache;
+// Forward declaration of the optional ahead of time compiled engine.
+class Chip8Compiled;
+// Forward declaration of the generator of ahead of time compiled code.
+class Chip8Recompiler;
+// The code Chip8Recompiler generates for the program of each hash.
+template <uint64_t Hash> struct Chip8CompiledRom;
+// Forward declaration of the optional rewind history.
+class Chip8Rewind;
+// Forward declaration of the optional input recorder.
+class Chip8InputLog;
+// Forward declaration of the optional guest profiler.
+class Chip8Profiler;
+// Forward declaration of the optional debugger.
+class Chip8Debugger;
+// Forward declaration of the pool of forked VMs.
+class Chip8Pool;
+
+
 /**
  * @brief Asynchronous Chip-8 virtual machine. Only compatible with the original
- * Chip-8 language.
+ * Chip-8 language, though it can be run with the quirks of the platforms that
+ * followed (see Platform).
+ *
+ * A VM takes no locks, so must only be used by one thread at a time, with the
+ * exception of keypad(), latest_frame(), frame_sequence(), and stats(), which
+ * may be called from any other thread while it runs. A host that runs it on a
+ * thread of its own has that thread make every other call, such as by passing
+ * it commands through a Chip8Queue.
  */
 class Chip8
 {
@@ -32,6 +65,117 @@ public:
 	typedef std::chrono::nanoseconds _TimeType;
 	// The number of nanoseconds in a second.
 	static constexpr long long _billion {1000000000U};
+	// Frequency the delay and sound timers count down at, in Hz.
+	static constexpr uint32_t _timer_freq {60};
+	// Highest instruction cycle frequency a VM runs at, in Hz.
+	static constexpr uint32_t max_frequency {1000000000U};
+
+	/**
+	 * @brief Strategies available for executing Chip-8 instructions.
+	 */
+	enum class Engine
+	{
+		interpreter,	// Fetch and decode every instruction as it executes.
+		block_cache,	// Execute pre-decoded basic blocks of memory.
+		compiled,		// Execute basic blocks compiled ahead of time for the
+						// program by Chip8Recompiler, where there are any.
+	};
+
+	/**
+	 * @brief Ways for instructions to access memory at I or the stack pointer.
+	 */
+	enum class Access
+	{
+		strict,	// Crash the VM on any access outside its memory.
+		fast,	// Wrap addresses to 12 bits, as the hardware does, unchecked.
+	};
+
+	/**
+	 * @brief Platforms whose quirks programs are written to depend on.
+	 */
+	enum class Platform
+	{
+		chip8,	// The original COSMAC VIP interpreter.
+		chip48,	// CHIP-48, for the HP-48 calculators.
+		schip,	// SUPER-CHIP 1.1, which followed CHIP-48.
+		xochip,	// XO-CHIP, which extends SUPER-CHIP with a second bitplane.
+	};
+
+	/**
+	 * @brief What a VM is waiting on while its program does nothing that needs
+	 * executing cycle by cycle.
+	 */
+	enum class Idle
+	{
+		none,	// Running its program.
+		key,	// In FX0A with both timers stopped, so only a key press can
+				// change anything.
+		timer,	// In FX0A or in a loop polling the delay timer, so nothing
+				// changes before the next 60Hz timer tick.
+	};
+
+	/**
+	 * @brief How far FX55 and FX65 move I.
+	 */
+	enum class Increment : uint8_t
+	{
+		past,	// Just past the last byte accessed, to I + X + 1.
+		last,	// To the last byte accessed, I + X.
+		none,	// I is left as it was.
+	};
+
+	/**
+	 * @brief The behaviour of a platform where it differs from the others.
+	 */
+	struct Quirks
+	{
+		bool vf_reset;				// 8XY1, 8XY2, and 8XY3 clear vF.
+		bool shift_vy;				// 8XY6 and 8XYE shift vY, not vX.
+		Increment index_increment;	// How far FX55 and FX65 move I.
+		bool display_wait;			// DXYN waits for the 60Hz timer.
+		bool jump_vx;				// BNNN adds vX (X of NNN), not v0.
+		bool hires;					// Has 00CN, 00FB/C/E/F, DXY0, FX30.
+		bool bitplanes;				// Has 00DN and FN01.
+	};
+
+	/**
+	 * @param platform A platform.
+	 * @return The quirks of the platform.
+	 */
+	static constexpr Quirks quirks(Platform platform)
+	{
+		switch (platform)
+		{
+			case Platform::chip48:
+				return {.vf_reset = false, .shift_vy = false,
+					.index_increment = Increment::last, .display_wait = false,
+					.jump_vx = true, .hires = false, .bitplanes = false};
+			case Platform::schip:
+				return {.vf_reset = false, .shift_vy = false,
+					.index_increment = Increment::none, .display_wait = false,
+					.jump_vx = true, .hires = true, .bitplanes = false};
+			case Platform::xochip:
+				return {.vf_reset = false, .shift_vy = true,
+					.index_increment = Increment::past, .display_wait = false,
+					.jump_vx = false, .hires = true, .bitplanes = true};
+			default:
+				return {.vf_reset = true, .shift_vy = true,
+					.index_increment = Increment::past, .display_wait = true,
+					.jump_vx = false, .hires = false, .bitplanes = false};
+		}
+	}
+
+	/**
+	 * @brief Guesses the platform a program was written for. Only SUPER-CHIP
+	 * and XO-CHIP have instructions of their own to tell them by, so any
+	 * program that uses them is taken to be for the newest platform whose
+	 * instructions it uses, and any other for the original Chip-8. Data that
+	 * happens to look like one of them can mislead it.
+	 * 
+	 * @param program The bytes of the program.
+	 * @return The platform to run the program with.
+	 */
+	static Platform detect_platform(std::span<const uint8_t> program);
 
 protected:
 	uint16_t	_pc {0};					// Program counter.
@@ -44,11 +188,20 @@ protected:
 	bool		_programmed {false};		// Set if a program is loaded.
 	bool		_can_draw {true};			// Set just after a "screen refesth".
 	std::atomic<bool> _key_wait {false};	// Set if in_keyd is waiting.
-	_TimeType	_time_budget {0};			// Time available to execute cycles.
-	_TimeType	_timer {0};					// Duration remaining for timers.
+	bool		_loop_hint {false};			// Set by a jump back 2 instructions.
+	int64_t		_time_budget {0};			// Time carried to the next batch, in
+											// billionths of a cycle.
+	int64_t		_timer {0};					// Time since the last timer tick, in
+											// 1 / (60 * _freq) seconds.
+	uint64_t	_rng {0};					// Random number generator state.
+	uint64_t	_cycle {0};					// Cycles executed since loading.
+	uint64_t	_ticks {0};					// Timer ticks since construction.
+	uint64_t	_skipped {0};				// Idle cycles fast forwarded
+											// through since construction.
 	std::array<uint8_t, 16>		_gprf;		// General purpose register file.
 	std::array<uint8_t, 4096>	_mem;		// VM memory.
-	std::array<uint64_t, 32>	_screen;	// Screen memory (1 dword = 1 row).
+	Chip8Screen	_screen;					// Screen memory.
+	uint8_t		_plane_mask {1};			// Bitplanes drawn on, from FN01.
 
 public:
 	// First address of the program space in Chip-8 memory.
@@ -61,7 +214,8 @@ public:
 	 * state restored before start() can be called.
 	 * 
 	 * @param key A reference to the keyboard input delegate to be used by this
-	 * VM.
+	 * VM, or nullptr to test keys against the keypad set by key_pressed(),
+	 * key_released(), and keypad(), which needs no virtual call or locking.
 	 * @param disp A reference to the display output delegate to be used by this
 	 * VM.
 	 * @param snd A reference to the sound output delegate to be used by this
@@ -69,6 +223,11 @@ public:
 	 */
 	Chip8(Chip8Keyboard* key, Chip8Display* disp, Chip8Sound* snd);
 
+	/**
+	 * @brief Destroy the Chip8.
+	 */
+	~Chip8();
+
 	/**
 	 * @brief Initializes the VM's state to be empty (unprogrammed).
 	 */
@@ -78,17 +237,26 @@ public:
 	 * @brief Loads in the passed program and initializes the VM to run from its
 	 * start.
 	 * 
-	 * Blocks if any blocking operating is being used by another thread.
-	 * 
 	 * @param program A string that contains the program to be loaded. The
 	 * contents of the steam are assumed to be in "compiled" Chip-8 byte code,
 	 * each instruction being two bytes with nothing in between each.
 	 * @throws std::invalid_argument if the loaded program is too large.
 	 */
-	void load_program(std::string& program);
+	void load_program(const std::string& program);
 
 	/**
-	 * @brief Stream insertion operator override.
+	 * @brief Loads in the passed program and initializes the VM to run from its
+	 * start, copying it straight from wherever it is held, such as a mapped
+	 * file (see Chip8MappedFile and Chip8RomPack).
+	 * 
+	 * @param program The bytes of the program, as for the string overload.
+	 * @throws std::invalid_argument if the loaded program is too large.
+	 */
+	void load_program(std::span<const uint8_t> program);
+
+	/**
+	 * @brief Stream insertion operator override. Writes the state exactly as
+	 * save_state() does, in a single write.
 	 * 
 	 * @param os The output stream to write to.
 	 * @param st The instance of Chip8 whose state will be output.
@@ -98,16 +266,51 @@ public:
 	friend std::ostream& operator<<(std::ostream& os, Chip8& st);
 
 	/**
-	 * @brief Stream extraction operator override.
+	 * @brief Stream extraction operator override. Reads a state written by
+	 * operator<<() or save_state().
 	 * 
 	 * @param is The input stream to read from.
 	 * @param st The instance of Chip8 whose state will be overwritten.
 	 * @return std::istream& The input stread read from.
 	 * @throws std::ios_base::failure if the end of the stream is encountered
-	 * early or an error occurs while reading.
+	 * early, an error occurs while reading, or the state read is invalid.
 	 */
 	friend std::istream& operator>>(std::istream& is, Chip8& st);
 
+	// Largest number of bytes save_state() can write.
+	static constexpr size_t _Max_State_Size {16 + 66 + 4096 + 2048};
+
+	/**
+	 * @brief Writes the VM's state to memory in the savestate format, which is
+	 * the same on every host.
+	 * 
+	 * A state is a 16 byte header followed by its payload, all little endian.
+	 * The header holds the magic "CH8S", the format version (u16), reserved
+	 * flags (u16), the payload size (u32), and the CRC-32 of the payload
+	 * (u32). The payload is the registers and timers, the platform, the
+	 * frequency the timing was kept at, the random number generator, the cycle count, and
+	 * masks of the 256 byte pages of memory
+	 * and of screen memory that are not all zero, followed by just those
+	 * pages of memory and then of the screen.
+	 * 
+	 * @param buffer Where to write the state. Up to _Max_State_Size bytes are
+	 * needed.
+	 * @return The number of bytes written.
+	 * @throws std::length_error if the state does not fit in the buffer.
+	 */
+	size_t save_state(std::span<std::byte> buffer);
+
+	/**
+	 * @brief Overwrites the VM's state, along with its platform, with one
+	 * written by save_state().
+	 * 
+	 * @param buffer The state, which may be followed by other data.
+	 * @return The number of bytes of the buffer the state took up.
+	 * @throws std::invalid_argument if the buffer does not start with a valid
+	 * state, in which case the VM's state is left unchanged.
+	 */
+	size_t load_state(std::span<const std::byte> buffer);
+
 	/**
 	 * @return true if the VM crashed; false otherwise.
 	 */
@@ -126,7 +329,19 @@ public:
 	/**
 	 * @brief Run the emulator for the specified duration.
 	 * 
-	 * Blocks if any blocking operating is being used by another thread.
+	 * Time is converted into whole cycles exactly, with any fraction of a
+	 * cycle carried to the next batch, and the timers tick on exactly the
+	 * cycles that cross a 60th of a second, so no frequency drifts against
+	 * the timers or real time however the batches are split.
+	 * 
+	 * Cycles spent idle until the next timer tick, in FX0A or in a loop that
+	 * does nothing but poll the delay timer (FX07, 3XNN, 1NNN back to the
+	 * FX07), are fast forwarded through rather than executed one by one, with
+	 * exactly the same results. Nothing is skipped while a profiler or
+	 * debugger is set.
+	 * 
+	 * A VM stopped by its debugger executes nothing, and emulated time doesn't
+	 * pass for it.
 	 * 
 	 * @param elapsed_time The number of miliseconds to run the emulation
 	 * forward.
@@ -134,23 +349,166 @@ public:
 	 */
 	void execute_batch(_TimeType elapsed_time);
 
+	/**
+	 * @return What the VM is waiting on as of the end of the last batch. A VM
+	 * that is Idle::key can do nothing until a key is pressed and released,
+	 * so a host can stop executing batches for it until then. Emulated time
+	 * doesn't pass while stopped, which only changes how many cycles pass
+	 * before the key press, so the host should restart any schedule it keeps
+	 * afterward.
+	 */
+	Idle idle();
+
 	/**
 	 * @return The current emulation instruction cycle frequency in Hz. 
 	 */
-	uint16_t frequency();
+	uint32_t frequency();
 
 	/**
-	 * @brief Set the emulation instruction cycle frequency.
-	 * 
-	 * Blocks if any blocking operating is being used by another thread.
+	 * @brief Set the emulation instruction cycle frequency. Time already
+	 * towards the next cycle and the next timer tick is kept.
 	 * 
 	 * @param value The new frequency in Hz.
+	 * @throws std::invalid_argument if the frequency is 0 or above
+	 * max_frequency.
+	 */
+	void frequency(uint32_t value);
+
+	/**
+	 * @return The value the random number generator is seeded with.
 	 */
-	void frequency(uint16_t value);
+	uint64_t seed();
+
+	/**
+	 * @brief Seed the VM's random number generator, which CXNN draws from. It
+	 * is reseeded with the same value whenever a program is loaded, so every
+	 * run of a program sees the same numbers.
+	 * 
+	 * @param value The new seed.
+	 */
+	void seed(uint64_t value);
+
+	/**
+	 * @return The number of instruction cycles executed since the program was
+	 * loaded.
+	 */
+	uint64_t cycles();
+
+	/**
+	 * @brief Converts a number of cycles into time at the current frequency,
+	 * allowing for the fraction of a cycle already carried.
+	 * 
+	 * @param cycles The number of cycles.
+	 * @return The shortest duration execute_batch() can be passed to execute
+	 * exactly that many cycles.
+	 */
+	_TimeType cycles_duration(uint64_t cycles);
+
+	/**
+	 * @return The number of 60Hz timer ticks executed since the VM was
+	 * constructed. Unlike cycles(), it is not part of the VM's state, so only
+	 * ever counts up.
+	 */
+	uint64_t ticks();
+
+	/**
+	 * @return The number of idle cycles fast forwarded through rather than
+	 * executed since the VM was constructed, which are counted in cycles()
+	 * along with those executed. Like ticks(), it only ever counts up.
+	 */
+	uint64_t skipped_cycles();
+
+	/**
+	 * @return The engine used to execute instructions.
+	 */
+	Engine engine();
+
+	/**
+	 * @brief Set the engine used to execute instructions. Every engine
+	 * produces identical results; the block cache is faster for programs that
+	 * do not modify their own code, and compiled code faster still for the
+	 * programs it was generated for. Programs without any are interpreted.
+	 * 
+	 * @param value The new execution engine.
+	 */
+	void engine(Engine value);
+
+	/**
+	 * @return How instructions access memory.
+	 */
+	Access access();
+
+	/**
+	 * @brief Set how instructions access memory. Strict access, the default,
+	 * checks every address and crashes the VM with a Chip8Error on any outside
+	 * memory; fast access masks every address to 12 bits and never checks.
+	 * Programs that keep within memory run identically either way. Both are
+	 * built from the same instruction implementations, and Chip8Lanes behaves
+	 * as strict access does.
+	 * 
+	 * @param value The new way to access memory.
+	 */
+	void access(Access value);
+
+	/**
+	 * @return The platform whose quirks instructions are executed with.
+	 */
+	Platform platform();
+
+	/**
+	 * @brief Set the platform whose quirks instructions are executed with,
+	 * the original Chip-8 by default. Chip8Lanes only ever executes them as
+	 * the original does. The big font is only in memory on platforms with the
+	 * hires instructions, so setting the platform after loading a program
+	 * copies it in or clears it; set it before loading to avoid doing so.
+	 * 
+	 * @param value The new platform.
+	 */
+	void platform(Platform value);
+
+	/**
+	 * @brief Set the rewind history that records the VM's state at the end of
+	 * every frame (at each 60Hz timer tick) while it executes. The history is
+	 * cleared whenever a program is loaded.
+	 * 
+	 * @param history The history to record into, or nullptr to stop
+	 * recording. Must outlive the VM or be replaced before it is destroyed.
+	 */
+	void rewind(Chip8Rewind* history);
+
+	/**
+	 * @brief Set the input log that records, or replays, every key press and
+	 * release and the result of every key test.
+	 * 
+	 * @param log The log to use, or nullptr to take input from the keyboard
+	 * delegate and key_pressed()/key_released() alone. Must outlive the VM or
+	 * be replaced before it is destroyed.
+	 */
+	void input_log(Chip8InputLog* log);
+
+	/**
+	 * @brief Set the profiler that counts the cycles spent at each address of
+	 * the program, and the calls it makes, while the VM executes.
+	 * 
+	 * @param profiler The profiler to count into, or nullptr to stop
+	 * profiling. Must outlive the VM or be replaced before it is destroyed.
+	 */
+	void profiler(Chip8Profiler* profiler);
+
+	/**
+	 * @brief Set the debugger that stops the VM at breakpoints and
+	 * watchpoints. Instructions are only interpreted while one is set, and
+	 * its checks are compiled only into the batches executed then.
+	 * 
+	 * @param debugger The debugger to stop for, or nullptr to run freely.
+	 * Must outlive the VM or be replaced before it is destroyed.
+	 */
+	void debugger(Chip8Debugger* debugger);
 
 	/**
 	 * @brief Call to indicate the passed key was just pressed. A corresponding
 	 * call to key_released must be made after  every call to this function.
+	 * The key is held on the keypad from then on.
 	 * 
 	 * @param key The value of the key that was just pressed.
 	 * 
@@ -161,7 +519,8 @@ public:
 
 
 	/**
-	 * @brief Indicates the specified key has been released.
+	 * @brief Indicates the specified key has been released, which is no longer
+	 * held on the keypad.
 	 * 
 	 * @param key The value of the key that was just released.
 	 * 
@@ -171,17 +530,87 @@ public:
 	void key_released(uint8_t key);
 
 	/**
-	 * @brief Provides access to the VM's screen buffer for drawing.
+	 * @return The keys held on the keypad; bit k is set while key k is held.
+	 */
+	uint16_t keypad() const;
+
+	/**
+	 * @brief Sets the keys held on the keypad directly, without the effect a
+	 * press has on FX0A. Never blocks, so may be called from any thread.
 	 * 
-	 * Blocks if any blocking operating is being used by another thread until
-	 * release_screen_buf() is called.
+	 * @param keys Bit k is set to hold key k.
+	 */
+	void keypad(uint16_t keys);
+
+	/**
+	 * @brief Provides access to the VM's screen buffer for drawing. Must only
+	 * be used while the VM isn't executing.
 	 * 
 	 * @return A pointer to the 64-bit value containing the first line of screen
-	 * data.
+	 * data. In low resolution, the 32 values from it are the rows of the first
+	 * plane; the rest of the screen is found with get_screen().
 	 */
 	uint64_t* get_screen_buf();
 
+	/**
+	 * @brief Provides access to all of the VM's screen memory, in either
+	 * resolution. Must only be used while the VM isn't executing, as with
+	 * get_screen_buf().
+	 * 
+	 * @return The screen memory.
+	 */
+	const Chip8Screen& get_screen();
+
+	/**
+	 * @brief Hashes what a program leaves behind for a test to check: the
+	 * screen and the registers (V0-VF, I, the PC and stack pointer, and both
+	 * timers). Two VMs that ran a program the same way have the same
+	 * fingerprint, whatever engine or access they ran it with. Must only be
+	 * used while the VM isn't executing, as with get_screen().
+	 *
+	 * @return The 64 bit FNV-1a hash of the screen and registers.
+	 */
+	uint64_t fingerprint();
+
+	/**
+	 * @brief Provides the screen as it was at the end of the most recently
+	 * completed frame (at the last 60Hz timer tick at which it had changed).
+	 * Never blocks, so may be used by a thread drawing the screen while
+	 * another runs the VM. Must not be called by more than one thread.
+	 * 
+	 * @return The frame, which remains unchanged until the next call.
+	 */
+	const Chip8FrameBuffer::Frame& latest_frame();
+
+	/**
+	 * @return The sequence of the most recently completed frame, which can be
+	 * compared against that of the last frame drawn to see if it is out of
+	 * date. May be called from any thread.
+	 */
+	uint64_t frame_sequence();
+
+	/**
+	 * @brief Provides the VM's statistics as they were at the end of the most
+	 * recently completed batch. Never blocks, so may be used by a thread
+	 * showing them while another runs the VM. Must not be called by more than
+	 * one thread. Only collected when built with CHIP8_INSTRUMENT.
+	 * 
+	 * @return The statistics, which remain unchanged until the next call.
+	 */
+	const Chip8Stats& stats();
+
 protected:
+	friend class Chip8BlockCache;
+	friend class Chip8Compiled;
+	friend class Chip8Recompiler;
+	template <uint64_t Hash> friend struct Chip8CompiledRom;
+	friend class Chip8Lanes;
+	friend class Chip8Rewind;
+	friend class Chip8InputLog;
+	friend class Chip8Profiler;
+	friend class Chip8Debugger;
+	friend class Chip8Pool;
+
 	// Type of instruction implementing functions.
 	typedef void (*_InstrFunc) (Chip8& vm, uint16_t instruction);
 	// Invalid key sentinel.
@@ -190,9 +619,30 @@ protected:
 	Chip8Keyboard*	_keyboard;	// Handles input (keyboard).
 	Chip8Display*	_display;	// Handles output (screen).
 	Chip8Sound*		_speaker;	// Handles output (sound).
-	uint16_t	_freq {1200};	// Instruction cycle frequency.
-	std::mutex	_access_lock;	// Protects asynchronous access.
+	uint32_t	_freq {1200};	// Instruction cycle frequency.
+	Access		_access {Access::strict};	// How memory is accessed.
+	Platform	_platform {Platform::chip8};	// Whose quirks are executed.
+	uint64_t	_seed {0};		// Seed of the random number generator.
 	uint8_t _pressed_key {_no_key}; // The key value waiting to be released.
+	std::atomic<uint16_t> _keypad {0};	// Bit k is set while key k is held.
+	// Pre-decoded blocks used when the block cache engine is selected.
+	std::unique_ptr<Chip8BlockCache> _block_cache;
+	// Compiled blocks used when the compiled engine is selected.
+	std::unique_ptr<Chip8Compiled> _compiled;
+	Chip8FrameBuffer _frames;		// Completed frames for other threads.
+	Chip8Rewind* _rewind {nullptr};	// Records every frame if set.
+	Chip8InputLog* _input_log {nullptr};	// Records or replays input if set.
+	Chip8Profiler* _profiler {nullptr};		// Profiles the program if set.
+	Chip8Debugger* _debugger {nullptr};		// Stops the program if set.
+	uint64_t _dirty_rows {0};		// Rows changed since last published.
+	// Bit k is set if page k of memory, of _State_Page_Size bytes, may have
+	// been written since Chip8Pool last forked or restored the VM. Stack
+	// pushes aren't counted, as forks copy the stack along with the registers.
+	uint16_t _written_pages {UINT16_MAX};
+#ifdef CHIP8_INSTRUMENT
+	Chip8Stats _stats;				// Statistics collected so far.
+	Chip8StatsBuffer _stats_out;	// Completed batches' statistics.
+#endif
 	
 	// VM font memory offset.
 	static constexpr uint16_t _font_off {32};
@@ -208,6 +658,166 @@ protected:
 		0xf0, 0x80, 0x80, 0x80, 0xf0,    0xe0, 0x90, 0x90, 0x90, 0xe0,  // C, D
 		0xf0, 0x80, 0xf0, 0x80, 0xf0,    0xf0, 0x80, 0xf0, 0x80, 0x80,  // E, F
 	};
+	// VM large font memory offset, just after the font.
+	static constexpr uint16_t _big_font_off {_font_off + sizeof(_font)};
+	// VM large font data, in 8x10 digits for SUPER-CHIP and XO-CHIP.
+	static constexpr uint8_t _big_font[160]
+	{
+		0xff, 0xff, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xff, 0xff,  // 0
+		0x18, 0x78, 0x78, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0xff,  // 1
+		0xff, 0xff, 0x03, 0x03, 0xff, 0xff, 0xc0, 0xc0, 0xff, 0xff,  // 2
+		0xff, 0xff, 0x03, 0x03, 0xff, 0xff, 0x03, 0x03, 0xff, 0xff,  // 3
+		0xc3, 0xc3, 0xc3, 0xc3, 0xff, 0xff, 0x03, 0x03, 0x03, 0x03,  // 4
+		0xff, 0xff, 0xc0, 0xc0, 0xff, 0xff, 0x03, 0x03, 0xff, 0xff,  // 5
+		0xff, 0xff, 0xc0, 0xc0, 0xff, 0xff, 0xc3, 0xc3, 0xff, 0xff,  // 6
+		0xff, 0xff, 0x03, 0x03, 0x06, 0x0c, 0x18, 0x18, 0x18, 0x18,  // 7
+		0xff, 0xff, 0xc3, 0xc3, 0xff, 0xff, 0xc3, 0xc3, 0xff, 0xff,  // 8
+		0xff, 0xff, 0xc3, 0xc3, 0xff, 0xff, 0x03, 0x03, 0xff, 0xff,  // 9
+		0x7e, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xff, 0xc3, 0xc3, 0xc3,  // A
+		0xfc, 0xfc, 0xc3, 0xc3, 0xfc, 0xfc, 0xc3, 0xc3, 0xfc, 0xfc,  // B
+		0x3c, 0xff, 0xc3, 0xc0, 0xc0, 0xc0, 0xc0, 0xc3, 0xff, 0x3c,  // C
+		0xfc, 0xfe, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xfe, 0xfc,  // D
+		0xff, 0xff, 0xc0, 0xc0, 0xff, 0xff, 0xc0, 0xc0, 0xff, 0xff,  // E
+		0xff, 0xff, 0xc0, 0xc0, 0xff, 0xff, 0xc0, 0xc0, 0xc0, 0xc0,  // F
+	};
+
+	// Indices of the instruction implementing functions in _HANDLER_TABLE.
+	enum _Handler : uint8_t
+	{
+		H_INVALID = 0,
+		H_CLR,		H_RTS,		H_JUMP,		H_CALL,		H_SKE,		H_SKNE,
+		H_SKRE,		H_LOAD,		H_ADD,		H_MOVE,		H_OR,		H_AND,
+		H_XOR,		H_ADDR,		H_SUB,		H_SHR,		H_SUBA,		H_SHL,
+		H_SKRNE,	H_LOADI,	H_JUMPI,	H_RAND,		H_DRAW,		H_SKPR,
+		H_SKUP,		H_MOVED,	H_KEYD,		H_LOADD,	H_LOADS,	H_ADDI,
+		H_LDSPR,	H_BCD,		H_STOR,		H_READ,		H_SCD,		H_SCU,
+		H_SCR,		H_SCL,		H_LOW,		H_HIGH,		H_PLANE,	H_LDBIG,
+		H_COUNT
+	};
+	static_assert(Chip8Stats::handlers == H_COUNT,
+		"Chip8Stats must count every handler.");
+
+	/**
+	 * @brief Memory access policy that crashes the VM on any access outside
+	 * its memory, checking each byte as it is accessed.
+	 */
+	struct _Strict
+	{
+		/**
+		 * @return The address, after checking it is within memory.
+		 * @throws Chip8Error if it isn't.
+		 */
+		static uint16_t addr(uint32_t addr)
+		{
+			if (addr >= 4096) [[unlikely]]
+				throw Chip8Error("Memory access violation: "
+					"Invalid Chip-8 VM memory location.");
+			return static_cast<uint16_t>(addr);
+		}
+
+		/**
+		 * @return The address that would be accessed, unchecked.
+		 */
+		static constexpr uint16_t wrap(uint32_t addr)
+		{
+			return static_cast<uint16_t>(addr);
+		}
+
+		// Set if accesses are checked against a debugger's watchpoints.
+		static constexpr bool debug {false};
+
+		/**
+		 * @brief Called before an instruction reads or writes len bytes from
+		 * addr, for a debugger to watch. Does nothing.
+		 */
+		static constexpr void read(Chip8&, uint32_t, uint32_t) {}
+		static constexpr void write(Chip8&, uint32_t, uint32_t) {}
+	};
+
+	/**
+	 * @brief Memory access policy that wraps every address to 12 bits, so
+	 * never branches or throws.
+	 */
+	struct _Fast
+	{
+		/**
+		 * @return The address wrapped to within memory.
+		 */
+		static constexpr uint16_t addr(uint32_t addr)
+		{
+			return static_cast<uint16_t>(addr & 0xfff);
+		}
+
+		/**
+		 * @return The address that would be accessed.
+		 */
+		static constexpr uint16_t wrap(uint32_t addr)
+		{
+			return static_cast<uint16_t>(addr & 0xfff);
+		}
+
+		static constexpr bool debug {false};
+		static constexpr void read(Chip8&, uint32_t, uint32_t) {}
+		static constexpr void write(Chip8&, uint32_t, uint32_t) {}
+	};
+
+	/**
+	 * @brief Memory access policy that accesses memory as Base does, checking
+	 * the accesses of FX55, FX65, FX33, and DXYN against the VM's debugger,
+	 * which must be set. Only used while one is.
+	 */
+	template <typename Base>
+	struct _Debug : Base
+	{
+		static constexpr bool debug {true};
+
+		/**
+		 * @brief Stops the VM after the instruction if it reads a watched
+		 * address of the len bytes from addr.
+		 */
+		static void read(Chip8& vm, uint32_t addr, uint32_t len);
+
+		/**
+		 * @brief Stops the VM after the instruction if it writes a watched
+		 * address of the len bytes from addr.
+		 */
+		static void write(Chip8& vm, uint32_t addr, uint32_t len);
+	};
+
+	// Type of a table of instruction implementing functions.
+	typedef std::array<_InstrFunc, H_COUNT> _HandlerTable;
+	// Instruction implementing functions accessing memory through Policy
+	// with the quirks of platform P, indexed by _Handler.
+	template <typename Policy, Platform P>
+	static const _HandlerTable _HANDLER_TABLE;
+	// Handler index of every possible 16-bit instruction.
+	static const std::array<uint8_t, 0x10000> _DECODE_TABLE;
+
+	// Leading half bytes of each form of the original Chip-8's instructions
+	// paired with their handlers, which both _DECODE_TABLE and _INSTRUCTIONS1
+	// through _INSTRUCTIONS4 are built from.
+	static constexpr std::pair<uint8_t, uint8_t> _FORMS1[] // kNNN
+	{
+		{0x1, H_JUMP},	{0x2, H_CALL},	{0xa, H_LOADI},	{0xb, H_JUMPI},
+	};
+	static constexpr std::pair<uint8_t, uint8_t> _FORMS2[] // kXNN
+	{
+		{0x3, H_SKE},	{0x4, H_SKNE},	{0x6, H_LOAD},	{0x7, H_ADD},
+		{0xc, H_RAND},
+	};
+	static constexpr std::pair<uint8_t, uint8_t> _FORMS3[] // kXYk
+	{
+		{0x50, H_SKRE},	{0x80, H_MOVE},	{0x81, H_OR},	{0x82, H_AND},
+		{0x83, H_XOR},	{0x84, H_ADDR},	{0x85, H_SUB},	{0x86, H_SHR},
+		{0x87, H_SUBA},	{0x8e, H_SHL},	{0x90, H_SKRNE},
+	};
+	static constexpr std::pair<uint16_t, uint8_t> _FORMS4[] // kXkk
+	{
+		{0x0ea1, H_SKUP},	{0x0e9e, H_SKPR},	{0x0f33, H_BCD},
+		{0x0f15, H_LOADD},	{0x0f55, H_STOR},	{0x0f65, H_READ},
+		{0x0f07, H_MOVED},	{0x0f18, H_LOADS},	{0x0f29, H_LDSPR},
+		{0x0f0a, H_KEYD},	{0x0f1e, H_ADDI},
+	};
 
 	// Lookup table for instructions of the form kNNN.
 	static const std::map<uint8_t, _InstrFunc> _INSTRUCTIONS1;
@@ -219,25 +829,267 @@ protected:
 	static const std::map<uint16_t, _InstrFunc> _INSTRUCTIONS4;
 
 	/**
-	 * @brief Returns the function that implements the passed Chip-8
-	 * instruction.
+	 * @brief Builds one of _INSTRUCTIONS1 through _INSTRUCTIONS4 from the
+	 * instruction forms listed for it.
 	 * 
-	 * @param instruction A Chip-8 instruction.
-	 * @return A pointer to the instruction implementing function that
-	 * corresponds to the passed instruction.
-	 * @throws Chip8Error if the passed instruction is not a valid Chip-8
-	 * instruction.
+	 * @param forms The leading half bytes of the forms paired with their
+	 * handlers.
+	 * @return The strict implementation of each form on the original Chip-8,
+	 * by its leading half bytes.
 	 */
-	static _InstrFunc get_instr_func(uint16_t instruction);
+	template <typename Key, size_t N>
+	static std::map<Key, _InstrFunc> build_instructions(
+		const std::pair<Key, uint8_t> (&forms)[N]);
 
 	/**
-	 * @brief Executes the next Chip-8 instruction cycles, given the state of
-	 * the VM.
-	 * @param cycle_time The amount of time that will pass over the execution of
-	 * this cycle.
+	 * @brief Builds _DECODE_TABLE at compile time from the instruction forms
+	 * in _FORMS1 through _FORMS4, along with those SUPER-CHIP and XO-CHIP add.
+	 * 
+	 * @return The handler index of every possible 16-bit instruction, H_INVALID
+	 * where the instruction is not a valid Chip-8 instruction.
+	 */
+	static constexpr std::array<uint8_t, 0x10000> build_decode_table();
+
+	/**
+	 * @param access A way to access memory.
+	 * @param platform A platform.
+	 * @return The instruction implementing functions that access memory that
+	 * way with the platform's quirks, indexed by _Handler. Invalid
+	 * instructions map to in_invalid(), which throws a Chip8Error when
+	 * executed.
+	 */
+	static const _HandlerTable& handler_table(Access access, Platform platform);
+
+	/**
+	 * @brief Executes a number of instruction cycles with the quirks of the
+	 * VM's platform, accessing memory through Policy.
+	 * 
+	 * @param cycles The number of cycles to execute.
 	 * @throws Chip8Error If a cycle could not be executed.
 	 */
-	void execute_cycle(_TimeType cycle_time);
+	template <typename Policy>
+	void execute_platform(int64_t cycles);
+
+	/**
+	 * @brief Executes a number of instruction cycles, accessing memory through
+	 * Policy with the quirks of platform P. The cycles are split into runs
+	 * between the timer ticks and any input due, so only the cycles that tick
+	 * the timers pay for them.
+	 * 
+	 * @param cycles The number of cycles to execute.
+	 * @throws Chip8Error If a cycle could not be executed.
+	 */
+	template <typename Policy, Platform P>
+	void execute_cycles(int64_t cycles);
+
+	/**
+	 * @brief Executes a run of instruction cycles that neither tick the timers
+	 * nor have input due, accessing memory through Policy with the quirks of
+	 * platform P.
+	 * 
+	 * @param cycles The number of cycles to execute.
+	 * @throws Chip8Error If a cycle could not be executed.
+	 */
+	template <typename Policy, Platform P>
+	void execute_run(int64_t cycles);
+
+	/**
+	 * @brief Executes the cycles of a run up to the one specified with the
+	 * block cache engine, a whole cached block at a time, interpreting only
+	 * while waiting for a key or at a PC outside program memory.
+	 * 
+	 * @param end The cycle to stop before.
+	 * @throws Chip8Error If a cycle could not be executed.
+	 */
+	template <typename Policy, Platform P>
+	void execute_blocks(uint64_t end);
+
+	/**
+	 * @brief Executes the cycles of a run up to the one specified with the
+	 * compiled engine, interpreting any instruction that has no compiled block
+	 * or whose block doesn't fit in the cycles left.
+	 * 
+	 * @param end The cycle to stop before.
+	 * @throws Chip8Error If a cycle could not be executed.
+	 */
+	template <typename Policy, Platform P>
+	void execute_compiled(uint64_t end);
+
+	/**
+	 * @brief Executes the next Chip-8 instruction, given the state of the VM,
+	 * accessing memory through Policy with the quirks of platform P. Neither
+	 * the timers nor the sound are updated.
+	 * @throws Chip8Error If the instruction could not be executed.
+	 */
+	template <typename Policy, Platform P>
+	void execute_cycle();
+
+	/**
+	 * @brief Marks the pages of memory holding len bytes from addr as
+	 * written, for Chip8Pool.
+	 * 
+	 * @param addr The first address written, which is wrapped to 12 bits.
+	 * @param len The number of consecutive bytes written, from 1 to 256.
+	 */
+	void mark_written(uint32_t addr, uint32_t len);
+
+	/**
+	 * @brief Ticks the timers for a cycle that crosses a 60Hz boundary, ending
+	 * the frame.
+	 */
+	void tick();
+
+	/**
+	 * @return value * to / from, rounded down, without overflowing unless the
+	 * result does. Converts between the units of _time_budget and _timer at
+	 * two frequencies.
+	 */
+	static int64_t rescale(int64_t value, uint32_t to, uint32_t from);
+
+	/**
+	 * @brief Starts or stops the sound to reflect the value of its timer. Only
+	 * needed once the timer has been ticked or set.
+	 */
+	void update_sound();
+
+	/**
+	 * @return true if the PC is at the start of a loop that does nothing but
+	 * poll the delay timer until it reaches a value it isn't yet at: FX07,
+	 * 3XNN, then 1NNN back to the FX07.
+	 */
+	bool delay_loop();
+
+	/**
+	 * @brief Fast forwards through the cycles left in a run, if the VM is idle,
+	 * exactly as if they were executed. Only called while waiting for a key or
+	 * once a jump may have closed a delay loop, as set in _loop_hint, which it
+	 * clears. Accounts for the time.
+	 * 
+	 * @param cycles The cycles left in the run, which is the most skipped.
+	 * @return The number of cycles skipped, which is 0 if the next has to be
+	 * executed.
+	 */
+	int64_t skip_idle(int64_t cycles);
+
+	// Magic number at the start of every savestate.
+	static constexpr uint8_t _State_Magic[4] {'C', 'H', '8', 'S'};
+	// Current savestate format version.
+	static constexpr uint16_t _State_Version {5};
+	// Size of the savestate header.
+	static constexpr size_t _State_Header_Size {16};
+	// Size of the part of the savestate payload that is always present.
+	static constexpr size_t _State_Fixed_Size {66};
+	// Size of the pages of memory in a savestate.
+	static constexpr uint16_t _State_Page_Size {256};
+	// Size of the screen memory in a savestate.
+	static constexpr size_t _State_Screen_Size {
+		Chip8Screen::planes * Chip8Screen::rows * 2 * sizeof(uint64_t)};
+
+	/**
+	 * @brief Writes the VM's state as a savestate.
+	 * 
+	 * @param out Where to write the state, which is at most _Max_State_Size
+	 * bytes.
+	 * @return The size of the state.
+	 */
+	size_t write_state(uint8_t* out);
+
+	/**
+	 * @brief Overwrites the VM's state with a savestate.
+	 * 
+	 * @param in The state, which may be followed by other data.
+	 * @param size The number of bytes available at in.
+	 * @return The size of the state.
+	 * @throws std::invalid_argument if the state is invalid, in which case the
+	 * VM's state is left unchanged.
+	 */
+	size_t read_state(const uint8_t* in, size_t size);
+
+	/**
+	 * @brief Encodes the VM's state as a savestate payload.
+	 * 
+	 * @param out Where to write the payload, which is at most
+	 * _Max_State_Size - _State_Header_Size bytes.
+	 * @param sparse Set to leave out pages of memory that are all zero. If not
+	 * set, the payload is always the largest size, with every byte of the
+	 * state at the same offset.
+	 * @return The size of the payload.
+	 */
+	size_t encode_state(uint8_t* out, bool sparse = true);
+
+	/**
+	 * @brief Overwrites the VM's state with a savestate payload.
+	 * 
+	 * @param in The payload, which must be of the size it implies.
+	 * @param size The size of the payload.
+	 * @throws std::invalid_argument if the payload is malformed, in which case
+	 * the VM's state is left unchanged.
+	 */
+	void decode_state(const uint8_t* in, size_t size);
+
+	/**
+	 * @param seed A seed.
+	 * @return The initial state of a random number generator seeded with it.
+	 */
+	static uint64_t seed_random(uint64_t seed);
+
+	/**
+	 * @brief Steps a random number generator (PCG32).
+	 * 
+	 * @param state The generator's state, which is advanced.
+	 * @return The next random byte.
+	 */
+	static uint8_t next_random(uint64_t& state);
+
+	/**
+	 * @brief Tests if a key is held down, through the input log if one is in
+	 * use and poll_key() otherwise.
+	 * 
+	 * @param key The value of the key to test.
+	 * @return true if the key is held down; false otherwise.
+	 */
+	bool test_key(uint8_t key);
+
+	/**
+	 * @brief Tests if a key is held down, through the keyboard delegate if
+	 * there is one and on the keypad otherwise.
+	 * 
+	 * @param key The value of the key to test.
+	 * @return true if the key is held down; false otherwise.
+	 */
+	bool poll_key(uint8_t key);
+
+	/**
+	 * @brief Applies a key press.
+	 * 
+	 * @param key The value of the key pressed.
+	 * @throws Chip8Error if the instruction waiting for the key can't be read.
+	 */
+	void press_key(uint8_t key);
+
+	/**
+	 * @brief Applies a key release.
+	 * 
+	 * @param key The value of the key released.
+	 */
+	void release_key(uint8_t key);
+
+	/**
+	 * @brief Publishes the screen as a completed frame if it has changed since
+	 * it was last published.
+	 */
+	void publish_screen();
+
+#ifdef CHIP8_INSTRUMENT
+	/**
+	 * @brief Counts a completed batch and publishes the statistics.
+	 * 
+	 * @param start When the batch started.
+	 * @param budget The emulated time the batch was given.
+	 */
+	void publish_stats(std::chrono::steady_clock::time_point start,
+		_TimeType budget);
+#endif
 
 	/**
 	 * @brief Retrives the halfword in memory at the specified address.
@@ -299,8 +1151,22 @@ protected:
 	 *		vX = A register where X is a hexadecimal digit.
 	 *		vY = A register where Y is a hexadecimal digit.
 	 *		I = The memory index register.
+	 * Those that access memory are templated on the access Policy, _Strict or
+	 * _Fast, and those whose behaviour differs between platforms on the
+	 * Platform P, whose quirks() are resolved as they are compiled. Each is
+	 * instantiated for every combination in _HANDLER_TABLE.
 	 */
 
+	/**
+	 * @brief Stands in for any instruction that is not a valid Chip-8
+	 * instruction.
+	 * 
+	 * @param vm Chip8 reference on which to apply the instruction.
+	 * @param instr The instruction being executed.
+	 * @throws Chip8Error indicating the invalid instruction.
+	 */
+	static void in_invalid(Chip8& vm, uint16_t instr);
+
 	/**
 	 * @brief (0NNN) Exectures the machine instruction at address NNN. Note that
 	 * this is ignored by this emulation.
@@ -311,19 +1177,73 @@ protected:
 	static void in_sys(Chip8& vm, uint16_t instr);
 
 	/**
-	 * @brief (00E0) Clears the screen to blank; 0,
+	 * @brief (00E0) Clears the planes selected by FN01 to blank; 0,
 	 * 
 	 * @param vm Chip8 reference on which to apply the instruction.
 	 * @param instr The instruction being executed.
 	 */
 	static void in_clr(Chip8& vm, uint16_t instr);
 
+	/**
+	 * @brief (00CN) Scroll the selected planes down by N rows. SUPER-CHIP and
+	 * XO-CHIP only.
+	 * 
+	 * @param vm Chip8 reference on which to apply the instruction.
+	 * @param instr The instruction being executed.
+	 */
+	static void in_scd(Chip8& vm, uint16_t instr);
+
+	/**
+	 * @brief (00DN) Scroll the selected planes up by N rows. XO-CHIP only.
+	 * 
+	 * @param vm Chip8 reference on which to apply the instruction.
+	 * @param instr The instruction being executed.
+	 */
+	static void in_scu(Chip8& vm, uint16_t instr);
+
+	/**
+	 * @brief (00FB) Scroll the selected planes right by 4 pixels. SUPER-CHIP
+	 * and XO-CHIP only.
+	 * 
+	 * @param vm Chip8 reference on which to apply the instruction.
+	 * @param instr The instruction being executed.
+	 */
+	static void in_scr(Chip8& vm, uint16_t instr);
+
+	/**
+	 * @brief (00FC) Scroll the selected planes left by 4 pixels. SUPER-CHIP
+	 * and XO-CHIP only.
+	 * 
+	 * @param vm Chip8 reference on which to apply the instruction.
+	 * @param instr The instruction being executed.
+	 */
+	static void in_scl(Chip8& vm, uint16_t instr);
+
+	/**
+	 * @brief (00FE) Switch to the 64x32 low resolution and clear the screen.
+	 * SUPER-CHIP and XO-CHIP only.
+	 * 
+	 * @param vm Chip8 reference on which to apply the instruction.
+	 * @param instr The instruction being executed.
+	 */
+	static void in_low(Chip8& vm, uint16_t instr);
+
+	/**
+	 * @brief (00FF) Switch to the 128x64 high resolution and clear the screen.
+	 * SUPER-CHIP and XO-CHIP only.
+	 * 
+	 * @param vm Chip8 reference on which to apply the instruction.
+	 * @param instr The instruction being executed.
+	 */
+	static void in_high(Chip8& vm, uint16_t instr);
+
 	/**
 	 * @brief (00EE) Return control from a subroutine.
 	 * 
 	 * @param vm Chip8 reference on which to apply the instruction.
 	 * @param instr The instruction being executed.
 	 */
+	template <typename Policy>
 	static void in_rts(Chip8& vm, uint16_t instr);
 
 	/**
@@ -341,6 +1261,7 @@ protected:
 	 * @param instr The instruction being executed.
 	 * called.
 	 */
+	template <typename Policy>
 	static void in_call(Chip8& vm, uint16_t instr);
 
 	/**
@@ -396,29 +1317,32 @@ protected:
 
 	/**
 	 * @brief (8XY1) Set the value of vX to the bitwise disjunction of itself
-	 * and vY.
+	 * and vY. vF is cleared if the platform has the vf_reset quirk.
 	 * 
 	 * @param vm Chip8 reference on which to apply the instruction.
 	 * @param instr The instruction being executed.
 	 */
+	template <Platform P>
 	static void in_or(Chip8& vm, uint16_t instr);
 
 	/**
 	 * @brief (8XY2) Set the value of vX to the bitwise conjunction of itself
-	 * and vY.
+	 * and vY. vF is cleared if the platform has the vf_reset quirk.
 	 * 
 	 * @param vm Chip8 reference on which to apply the instruction.
 	 * @param instr The instruction being executed.
 	 */
+	template <Platform P>
 	static void in_and(Chip8& vm, uint16_t instr);
 
 	/**
 	 * @brief (8XY3) Set the value of vX to the bitwise exclusive disjunction of
-	 * itself and vY.
+	 * itself and vY. vF is cleared if the platform has the vf_reset quirk.
 	 * 
 	 * @param vm Chip8 reference on which to apply the instruction.
 	 * @param instr The instruction being executed.
 	 */
+	template <Platform P>
 	static void in_xor(Chip8& vm, uint16_t instr);
 
 	/**
@@ -442,11 +1366,13 @@ protected:
 	/**
 	 * @brief (8XY6) Stores the value of the 1 bit logical shift right of vY in
 	 * vX. vF is set to the least significant bit of vY before the shift is
-	 * applied and vY is unchanged.
+	 * applied and vY is unchanged. vX is shifted in place of vY if the
+	 * platform lacks the shift_vy quirk.
 	 * 
 	 * @param vm Chip8 reference on which to apply the instruction.
 	 * @param instr The instruction being executed.
 	 */
+	template <Platform P>
 	static void in_shr(Chip8& vm, uint16_t instr);
 
 	/**
@@ -460,12 +1386,14 @@ protected:
 
 	/**
 	 * @brief (8XYE) Stores the value of the 1 bit logical shift left of vY in
-	 * vX. vF is set to the least significant bit of vY before the shift is
-	 * applied and vY is unchanged.
+	 * vX. vF is set to the most significant bit of vY before the shift is
+	 * applied and vY is unchanged. vX is shifted in place of vY if the
+	 * platform lacks the shift_vy quirk.
 	 * 
 	 * @param vm Chip8 reference on which to apply the instruction.
 	 * @param instr The instruction being executed.
 	 */
+	template <Platform P>
 	static void in_shl(Chip8& vm, uint16_t instr);
 
 	/**
@@ -486,11 +1414,14 @@ protected:
 	static void in_loadi(Chip8& vm, uint16_t instr);
 
 	/**
-	 * @brief (BNNN) Unconditional branch to the address NNN + v0.
+	 * @brief (BNNN) Unconditional branch to the address NNN + v0, or NNN + vX
+	 * where X is the leading digit of NNN if the platform has the jump_vx
+	 * quirk.
 	 * 
 	 * @param vm Chip8 reference on which to apply the instruction.
 	 * @param instr The instruction being executed.
 	 */
+	template <Platform P>
 	static void in_jumpi(Chip8& vm, uint16_t instr);
 
 	/**
@@ -505,13 +1436,27 @@ protected:
 	 * @brief (DXYN) Draw a sprite onto the screen at the position (vX, vY)
 	 * using N bytes of sprite data starting at the address stored in I. The
 	 * value of vF will be set to 0x01 if any pixels are unset or 0x00
-	 * otherwise.
+	 * otherwise. Waits for the next 60Hz timer tick first if the platform has
+	 * the display_wait quirk. With the hires quirk, DXY0 draws a 16x16 sprite
+	 * of 32 bytes, and on those platforms sprites are drawn on each plane
+	 * selected by FN01 from consecutive sprite data.
 	 * 
 	 * @param vm Chip8 reference on which to apply the instruction.
 	 * @param instr The instruction being executed.
 	 */
+	template <typename Policy, Platform P>
 	static void in_draw(Chip8& vm, uint16_t instr);
 
+	/**
+	 * @brief Draws a sprite with Chip8Screen, for the sprites of SUPER-CHIP
+	 * and XO-CHIP that the original 64x32 path in in_draw can't.
+	 * 
+	 * @param vm Chip8 reference on which to apply the instruction.
+	 * @param instr The DXYN instruction being executed.
+	 */
+	template <typename Policy>
+	static void draw_wide(Chip8& vm, uint16_t instr);
+
 	/**
 	 * @brief (EX9E) Skip the following instruction if the key corresponding to
 	 * the hex value stored in vX is pressed.
@@ -580,6 +1525,25 @@ protected:
 	 */
 	static void in_ldspr(Chip8& vm, uint16_t instr);
 
+	/**
+	 * @brief (FX30) Set I to the address of the large sprite data that
+	 * corresponds to the digit stored in vX. SUPER-CHIP and XO-CHIP only.
+	 * 
+	 * @param vm Chip8 reference on which to apply the instruction.
+	 * @param instr The instruction being executed.
+	 */
+	static void in_ldbig(Chip8& vm, uint16_t instr);
+
+	/**
+	 * @brief (FN01) Select the planes drawn on, cleared, and scrolled by the
+	 * instructions that follow, with bit p of N for plane p, up to plane 1.
+	 * XO-CHIP only.
+	 * 
+	 * @param vm Chip8 reference on which to apply the instruction.
+	 * @param instr The instruction being executed.
+	 */
+	static void in_plane(Chip8& vm, uint16_t instr);
+
 	/**
 	 * @brief (FX33) Stores the BCD equivalent of the value of vX in memory at
 	 * addresses I, I + 1, and I + 2.
@@ -587,25 +1551,28 @@ protected:
 	 * @param vm Chip8 reference on which to apply the instruction.
 	 * @param instr The instruction being executed.
 	 */
+	template <typename Policy>
 	static void in_bcd(Chip8& vm, uint16_t instr);
 
 	/**
 	 * @brief (FX55) Stores the values of v0 to vX in memory, starting at the
-	 * address specified by I. I is set to I + X after the operation is
-	 * complete.
+	 * address specified by I. I is then moved by the platform's
+	 * index_increment quirk.
 	 * 
 	 * @param vm Chip8 reference on which to apply the instruction.
 	 * @param instr The instruction being executed.
 	 */
+	template <typename Policy, Platform P>
 	static void in_stor(Chip8& vm, uint16_t instr);
 
 	/**
 	 * @brief (FX65) Fill the registers v0 to vX with values in memory, starting
-	 * with that at the address specified by I. I is set to I - X the operation
-	 * is complete.
+	 * with that at the address specified by I. I is then moved by the
+	 * platform's index_increment quirk.
 	 * 
 	 * @param vm Chip8 reference on which to apply the instruction.
 	 * @param instr The instruction being executed.
 	 */
+	template <typename Policy, Platform P>
 	static void in_read(Chip8& vm, uint16_t instr);
 };
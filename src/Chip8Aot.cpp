@@ -0,0 +1,116 @@
+// Ahead of time compiler for the Chip-8 VM: translates the code reachable in a
+// ROM into C++ for the compiled engine, to be built into an executable.
+
+#include "Chip8.hpp"
+#include "Chip8Recompiler.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+
+namespace
+{
+	const char* usage
+	{
+		"Usage: chip8-aot [options] ROM\n"
+		"Options:\n"
+		"  --platform NAME  Quirks to compile with: chip8, chip48, schip,\n"
+		"                   xochip, or auto to guess from the ROM (default\n"
+		"                   auto). VMs only use the code when set to the\n"
+		"                   same platform.\n"
+		"  --output PATH    Write the C++ to PATH rather than to the standard\n"
+		"                   output.\n"
+		"The code registers itself once linked into an executable, so any VM\n"
+		"in it set to the compiled engine runs the ROM's compiled blocks.\n"
+	};
+}
+
+
+int main(int argc, char** argv)
+{
+	if (argc == 2 && std::string(argv[1]) == "--help")
+	{
+		std::cout << usage;
+		return 0;
+	}
+	std::string rom_path, output, platform_name {"auto"};
+	try
+	{
+		for (int i {1}; i < argc; ++i)
+		{
+			std::string arg {argv[i]};
+			auto value = [&]() -> std::string
+			{
+				if (i + 1 >= argc)
+					throw std::invalid_argument("Missing value for " + arg);
+				return argv[++i];
+			};
+
+			if (arg == "--platform") platform_name = value();
+			else if (arg == "--output") output = value();
+			else if (arg.starts_with("--"))
+				throw std::invalid_argument("Unknown option: " + arg);
+			else if (rom_path.empty()) rom_path = arg;
+			else throw std::invalid_argument("Only one ROM may be given.");
+		}
+		if (rom_path.empty()) throw std::invalid_argument("Missing the ROM.");
+	}
+	catch (std::exception& e)
+	{
+		std::cerr << e.what() << '\n' << usage;
+		return 2;
+	}
+
+	try
+	{
+		std::ifstream rom_file(rom_path, std::fstream::binary);
+		if (!rom_file)
+			throw std::invalid_argument("Unable to open ROM: " + rom_path);
+		std::stringstream sstr;
+		sstr << rom_file.rdbuf();
+		std::string rom {sstr.str()};
+		std::span<const uint8_t> program(
+			reinterpret_cast<const uint8_t*>(rom.data()), rom.size());
+
+		Chip8::Platform platform;
+		if (platform_name == "chip8") platform = Chip8::Platform::chip8;
+		else if (platform_name == "chip48")
+			platform = Chip8::Platform::chip48;
+		else if (platform_name == "schip") platform = Chip8::Platform::schip;
+		else if (platform_name == "xochip")
+			platform = Chip8::Platform::xochip;
+		else if (platform_name == "auto")
+			platform = Chip8::detect_platform(program);
+		else
+			throw std::invalid_argument("Unknown platform: " + platform_name);
+
+		// Written out whole, so a failure leaves no partial file for a build
+		// to pick up.
+		std::ostringstream source;
+		Chip8Recompiler::Summary summary {Chip8Recompiler::generate(program,
+			platform, std::filesystem::path(rom_path).filename().string(),
+			source)};
+		if (output.empty()) std::cout << source.str();
+		else
+		{
+			std::ofstream out(output, std::fstream::binary);
+			if (!(out << source.str()))
+				throw std::runtime_error("Unable to write " + output);
+		}
+		std::cerr << "Compiled " << summary.blocks << " blocks of "
+			<< summary.instructions << " instructions; "
+			<< summary.computed_jumps
+			<< " computed jumps are left to the interpreter.\n";
+	}
+	catch (std::exception& e)
+	{
+		std::cerr << e.what() << '\n';
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,169 @@
+#include "Chip8BatchRunner.hpp"
+
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+
+
+Chip8BatchRunner::Chip8BatchRunner(size_t threads)
+{
+	if (threads == 0)
+		threads = std::max(std::thread::hardware_concurrency(), 1U);
+	for (size_t i {0}; i < threads; ++i)
+		_workers.push_back(std::make_unique<Worker>());
+	for (std::unique_ptr<Worker>& worker : _workers)
+		worker->_thread = std::thread(&Chip8BatchRunner::work, this,
+			std::ref(*worker));
+}
+
+
+Chip8BatchRunner::~Chip8BatchRunner()
+{
+	{
+		std::lock_guard<std::mutex> guard(_lock);
+		_stop = true;
+	}
+	_start.notify_all();
+	for (std::unique_ptr<Worker>& worker : _workers) worker->_thread.join();
+}
+
+
+size_t Chip8BatchRunner::threads()
+{
+	return _workers.size();
+}
+
+
+std::vector<Chip8JobResult> Chip8BatchRunner::run(
+	const std::vector<Chip8Job>& jobs)
+{
+	std::vector<Chip8JobResult> results(jobs.size());
+	if (jobs.empty()) return results;
+
+	// Deal contiguous runs of jobs to each worker.
+	for (size_t w {0}; w < _workers.size(); ++w)
+	{
+		size_t begin {jobs.size() * w / _workers.size()};
+		size_t end {jobs.size() * (w + 1) / _workers.size()};
+		std::lock_guard<std::mutex> guard(_workers[w]->_lock);
+		for (size_t i {begin}; i < end; ++i) _workers[w]->_queue.push_back(i);
+	}
+
+	std::unique_lock<std::mutex> guard(_lock);
+	_jobs = &jobs;
+	_results = &results;
+	_busy = _workers.size();
+	++_batch;
+	_start.notify_all();
+	_finished.wait(guard, [this] { return _busy == 0; });
+	_jobs = nullptr;
+	_results = nullptr;
+	return results;
+}
+
+
+void Chip8BatchRunner::work(Worker& worker)
+{
+	uint64_t batch {0};
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> guard(_lock);
+			_start.wait(guard, [&] { return _stop || _batch != batch; });
+			if (_stop) return;
+			batch = _batch;
+		}
+
+		// No jobs are added during a batch, so once none can be taken from
+		// any worker this one is done.
+		size_t index;
+		while (take_job(worker, index))
+			run_job(worker, (*_jobs)[index], (*_results)[index]);
+
+		std::lock_guard<std::mutex> guard(_lock);
+		if (--_busy == 0) _finished.notify_one();
+	}
+}
+
+
+bool Chip8BatchRunner::take_job(Worker& worker, size_t& index)
+{
+	{
+		std::lock_guard<std::mutex> guard(worker._lock);
+		if (!worker._queue.empty())
+		{
+			index = worker._queue.front();
+			worker._queue.pop_front();
+			return true;
+		}
+	}
+
+	// Steal from the back of the first other worker that has jobs left.
+	for (std::unique_ptr<Worker>& victim : _workers)
+	{
+		if (victim.get() == &worker) continue;
+		std::lock_guard<std::mutex> guard(victim->_lock);
+		if (!victim->_queue.empty())
+		{
+			index = victim->_queue.back();
+			victim->_queue.pop_back();
+			return true;
+		}
+	}
+	return false;
+}
+
+
+void Chip8BatchRunner::run_job(Worker& worker, const Chip8Job& job,
+	Chip8JobResult& result)
+{
+	Chip8& vm {worker._vm};
+	vm.keypad(0);
+	bool loaded {false};
+
+	try
+	{
+		vm.platform(job.platform);
+		if (job.rom.empty()) vm.load_program(*job.program);
+		else vm.load_program(job.rom);
+		loaded = true;
+		vm.frequency(job.freq);
+		vm.engine(job.engine);
+		vm.access(job.access);
+
+		// Run up to each key event in turn, then apply it.
+		size_t next {0};
+		while (result.cycles < job.cycles)
+		{
+			while (next < job.input.size()
+				&& job.input[next].cycle <= result.cycles)
+			{
+				const Chip8KeyEvent& event {job.input[next++]};
+				if (event.key > 0xf)
+					throw std::invalid_argument("Key value too large.");
+				if (event.pressed) vm.key_pressed(event.key);
+				else vm.key_released(event.key);
+			}
+
+			uint64_t until {job.cycles};
+			if (next < job.input.size())
+				until = std::min(until, job.input[next].cycle);
+			vm.execute_batch(vm.cycles_duration(until - result.cycles));
+			result.cycles = until;
+		}
+	}
+	catch (std::exception& e)
+	{
+		// Crashes are reported at the cycle that faulted rather than the
+		// start of the run it was in.
+		if (loaded) result.cycles = vm.cycles();
+		result.crashed = true;
+		result.error = e.what();
+	}
+
+	std::ostringstream state;
+	state << vm;
+	result.state = state.str();
+	result.screen = vm.get_screen();
+	result.fingerprint = vm.fingerprint();
+}
@@ -0,0 +1,152 @@
+#pragma once
+
+#include "Chip8.hpp"
+#include "Chip8Headless.hpp"
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+/**
+ * @brief A change to the state of a key at a specific cycle of a job.
+ */
+struct Chip8KeyEvent
+{
+	uint64_t	cycle;		// Cycles executed before the event applies.
+	uint8_t		key;		// The value of the key.
+	bool		pressed;	// Set if the key is pressed; unset if released.
+};
+
+
+/**
+ * @brief A program to be run for a fixed number of cycles by a
+ * Chip8BatchRunner.
+ */
+struct Chip8Job
+{
+	// The program to run. May be shared between any number of jobs.
+	std::shared_ptr<const std::string> program;
+	// If not empty, the program to run in place of program, such as one from
+	// a Chip8RomPack. Must stay valid until the batch completes.
+	std::span<const uint8_t> rom;
+	// Key events to apply over the run, in order of their cycles.
+	std::vector<Chip8KeyEvent> input;
+	// Number of instruction cycles to execute.
+	uint64_t cycles {0};
+	// Instruction cycle frequency, which determines the timer rate.
+	uint32_t freq {1200};
+	// Engine to execute the program with.
+	Chip8::Engine engine {Chip8::Engine::interpreter};
+	// How the program's instructions access memory.
+	Chip8::Access access {Chip8::Access::strict};
+	// Platform whose quirks to run the program with, such as the one
+	// Chip8::detect_platform() picks for it.
+	Chip8::Platform platform {Chip8::Platform::chip8};
+};
+
+
+/**
+ * @brief The outcome of a Chip8Job.
+ */
+struct Chip8JobResult
+{
+	bool crashed {false};				// Set if the VM crashed.
+	std::string error;					// The reason for the crash, if any.
+	uint64_t cycles {0};				// Cycles run before any crash.
+	std::string state;					// The final state, as from operator<<.
+	Chip8Screen screen;					// The final screen contents.
+	uint64_t fingerprint {0};			// Chip8::fingerprint() at the end.
+};
+
+
+/**
+ * @brief Runs batches of Chip8Jobs in parallel on a pool of threads, each
+ * of which reuses a single VM for every job it executes.
+ *
+ * Jobs are dealt out evenly between the threads before a batch starts. A
+ * thread that runs out of jobs steals from the others, so batches of uneven
+ * jobs still keep every thread busy.
+ */
+class Chip8BatchRunner
+{
+public:
+	/**
+	 * @brief Construct a new Chip8BatchRunner and start its threads.
+	 *
+	 * @param threads The number of threads to run jobs on. If 0, one thread
+	 * is used for each hardware thread.
+	 */
+	Chip8BatchRunner(size_t threads = 0);
+
+	/**
+	 * @brief Destroy the Chip8BatchRunner, stopping its threads.
+	 */
+	~Chip8BatchRunner();
+
+	/**
+	 * @return The number of threads jobs are run on.
+	 */
+	size_t threads();
+
+	/**
+	 * @brief Runs every passed job to completion. Must not be called by more
+	 * than one thread at a time.
+	 *
+	 * @param jobs The jobs to run.
+	 * @return The result of each job, in the same order as the jobs.
+	 */
+	std::vector<Chip8JobResult> run(const std::vector<Chip8Job>& jobs);
+
+protected:
+	/**
+	 * @brief A thread of the pool and the VM it runs jobs on.
+	 */
+	struct Worker
+	{
+		NullDisplay			_display;	// Discards display output.
+		NullSound			_sound;		// Discards sound output.
+		// Keys are held on the VM's keypad.
+		Chip8				_vm {nullptr, &_display, &_sound};
+		std::mutex			_lock;		// Protects _queue.
+		std::deque<size_t>	_queue;		// Indices of jobs still to be run.
+		std::thread			_thread;	// Thread running jobs.
+	};
+
+	std::vector<std::unique_ptr<Worker>> _workers;	// The pool.
+	std::mutex _lock;					// Protects the fields below.
+	std::condition_variable _start;		// Signals a batch or shutdown.
+	std::condition_variable _finished;	// Signals a worker ran out of jobs.
+	uint64_t _batch {0};				// Number of batches started.
+	size_t _busy {0};					// Workers still running the batch.
+	bool _stop {false};					// Set when the threads should exit.
+	const std::vector<Chip8Job>* _jobs {nullptr};	// The current batch.
+	std::vector<Chip8JobResult>* _results {nullptr};	// Its results.
+
+	/**
+	 * @brief Main loop of each thread of the pool.
+	 */
+	void work(Worker& worker);
+
+	/**
+	 * @brief Takes the next job for a worker, from its own queue if possible
+	 * or else from another worker's.
+	 *
+	 * @param worker The worker looking for a job.
+	 * @param index Set to the index of the job taken.
+	 * @return true if a job was taken; false if none are left.
+	 */
+	bool take_job(Worker& worker, size_t& index);
+
+	/**
+	 * @brief Runs a single job on a worker's VM.
+	 */
+	static void run_job(Worker& worker, const Chip8Job& job,
+		Chip8JobResult& result);
+};
@@ -0,0 +1,505 @@
+// Benchmark suite for the Chip-8 VM. Runs synthetic instruction streams and
+// any ROMs passed on the command line through Chip8::execute_batch, printing
+// one JSON object per benchmark and engine on standard output. Given the
+// output of an earlier run as a baseline, fails if any benchmark has slowed
+// down by more than a threshold.
+
+#include "Chip8.hpp"
+#include "Chip8Compiled.hpp"
+#include "Chip8Headless.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <new>
+#include <optional>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+// Number of heap allocations made by the process so far.
+static std::atomic<uint64_t> allocations {0};
+
+
+void* operator new(std::size_t size)
+{
+	allocations.fetch_add(1, std::memory_order_relaxed);
+	if (void* ptr = std::malloc(size == 0 ? 1 : size)) return ptr;
+	throw std::bad_alloc();
+}
+
+
+void operator delete(void* ptr) noexcept
+{
+	std::free(ptr);
+}
+
+
+void operator delete(void* ptr, std::size_t size) noexcept
+{
+	std::free(ptr);
+}
+
+
+namespace
+{
+	const char* usage
+	{
+		"Usage: chip8-bench [options] [ROM...]\n"
+		"Options:\n"
+		"  --seconds S      Emulated seconds per benchmark (default 60).\n"
+		"  --repeat N       Run every benchmark N times over, reporting the\n"
+		"                   fastest run of each (default 1).\n"
+		"  --freq HZ        Instruction cycle frequency, up to 1000000000\n"
+		"                   (default 65535).\n"
+		"  --engine NAME    interpreter, block, compiled, or all (default\n"
+		"                   all, which only includes compiled if any ROMs\n"
+		"                   were compiled in).\n"
+		"  --access NAME    Memory access: strict or fast (default strict).\n"
+		"  --platform NAME  Quirks to run with: chip8, chip48, schip, xochip,\n"
+		"                   or auto to guess from each ROM (default auto).\n"
+		"  --only NAME      Only run the named benchmark.\n"
+		"  --baseline PATH  Compare against the output of an earlier run,\n"
+		"                   failing if any benchmark in both is slower.\n"
+		"  --threshold PCT  Slowdown in percent allowed by --baseline\n"
+		"                   (default 10).\n"
+	};
+
+
+	/**
+	 * @brief A named program to be benchmarked.
+	 */
+	struct Benchmark
+	{
+		std::string name;		// Name reported in the results.
+		std::string program;	// Chip-8 byte code, loaded at _Prog_Start.
+		Chip8::Platform platform {Chip8::Platform::chip8};	// Quirks to run.
+	};
+
+
+	/**
+	 * @brief Builds a program from a list of instructions.
+	 */
+	std::string assemble(const std::vector<uint16_t>& instrs)
+	{
+		std::string program;
+		for (uint16_t instr : instrs)
+		{
+			program.push_back(static_cast<char>(instr >> 8));
+			program.push_back(static_cast<char>(instr & 0xffU));
+		}
+		return program;
+	}
+
+
+	/**
+	 * @return The synthetic instruction streams, one per opcode class.
+	 */
+	std::vector<Benchmark> synthetic_benchmarks()
+	{
+		std::vector<Benchmark> benches;
+
+		// 8XYn arithmetic and logic in a loop.
+		benches.push_back({"alu", assemble({
+			0x6001, 0x6102, 0x6203, 0x6304,			// 0x200: Set up v0-v3.
+			0x8014, 0x8125, 0x8236, 0x8347,			// 0x208: Loop body.
+			0x801e, 0x8011, 0x8122, 0x8233,
+			0x8010, 0x8124, 0x8235, 0x8307,
+			0x1208,									// Repeat the loop.
+		})});
+
+		// DXYN sprite draws over the whole screen.
+		benches.push_back({"sprite", assemble({
+			0x6000, 0x6100, 0x6200, 0xf229,			// 0x200: Digit 0 sprite.
+			0xd015, 0x7008, 0xd015, 0x7008,			// 0x208: Loop body.
+			0xd01f, 0x7105, 0xd01f, 0x7203,
+			0xf229,
+			0x1208,									// Repeat the loop.
+		})});
+
+		// FX55 and FX65 block copies through memory.
+		benches.push_back({"memory", assemble({
+			0xa400, 0xff55, 0xa400, 0xff65,			// 0x200: Loop body.
+			0xa410, 0xf755, 0xa410, 0xf765,
+			0x7001,
+			0x1200,									// Repeat the loop.
+		})});
+
+		// 2NNN and 00EE through a chain of eight nested subroutines.
+		std::vector<uint16_t> calls {0x2204, 0x1200};	// 0x200: Main loop.
+		for (uint16_t depth {0}; depth < 8; ++depth)	// 0x204: Subroutines.
+		{
+			uint16_t next {static_cast<uint16_t>(0x204 + (depth + 1) * 4)};
+			calls.push_back(depth < 7 ? 0x2000 | next : 0x6001);
+			calls.push_back(0x00ee);
+		}
+		benches.push_back({"calls", assemble(calls)});
+
+		return benches;
+	}
+
+
+	/**
+	 * @brief Writes a string to the passed stream as a JSON string literal.
+	 */
+	void write_json_string(std::ostream& os, const std::string& str)
+	{
+		os << '"';
+		for (char c : str)
+		{
+			if (c == '"' || c == '\\') os << '\\' << c;
+			else if (static_cast<unsigned char>(c) < 0x20) os << ' ';
+			else os << c;
+		}
+		os << '"';
+	}
+
+
+	/**
+	 * @return The value of a field of a line of JSON written by
+	 * run_benchmark(), without any quotes, or an empty string if it has no
+	 * such field.
+	 */
+	std::string json_field(const std::string& line, const std::string& name)
+	{
+		std::string key {"\"" + name + "\": "};
+		size_t start {line.find(key)};
+		if (start == std::string::npos) return {};
+		start += key.size();
+		if (line[start] == '"')
+		{
+			size_t end {line.find('"', start + 1)};
+			return line.substr(start + 1, end - start - 1);
+		}
+		return line.substr(start, line.find_first_of(",}", start) - start);
+	}
+
+
+	/**
+	 * @return The name of an engine, as in the output.
+	 */
+	const char* engine_name(Chip8::Engine engine)
+	{
+		switch (engine)
+		{
+			case Chip8::Engine::block_cache: return "block";
+			case Chip8::Engine::compiled: return "compiled";
+			default: return "interpreter";
+		}
+	}
+
+
+	/**
+	 * @return The name of a platform, as in the output.
+	 */
+	const char* platform_name(Chip8::Platform platform)
+	{
+		switch (platform)
+		{
+			case Chip8::Platform::chip48: return "chip48";
+			case Chip8::Platform::schip: return "schip";
+			case Chip8::Platform::xochip: return "xochip";
+			default: return "chip8";
+		}
+	}
+
+
+	/**
+	 * @return The key a benchmark's results are matched by between runs.
+	 */
+	std::string result_key(const std::string& bench, const std::string& engine,
+		const std::string& access)
+	{
+		return bench + " (" + engine + ", " + access + ")";
+	}
+
+
+	/**
+	 * @brief Reads the nanoseconds per instruction of each benchmark in the
+	 * output of an earlier run, keyed by result_key().
+	 *
+	 * @throws std::invalid_argument if the file can't be read.
+	 */
+	std::map<std::string, double> read_baseline(const std::string& path)
+	{
+		std::ifstream file(path);
+		if (!file)
+			throw std::invalid_argument("Unable to open baseline: " + path);
+		std::map<std::string, double> baseline;
+		std::string line;
+		while (std::getline(file, line))
+		{
+			std::string ns {json_field(line, "ns_per_instruction")};
+			// Runs that crashed don't say how fast the benchmark is.
+			if (ns.empty() || !json_field(line, "error").empty()) continue;
+			baseline[result_key(json_field(line, "benchmark"),
+				json_field(line, "engine"), json_field(line, "access"))]
+				= std::stod(ns);
+		}
+		return baseline;
+	}
+
+
+	/**
+	 * @brief A benchmark to be run on an engine, with its fastest run so far.
+	 */
+	struct Run
+	{
+		const Benchmark* bench;	// The benchmark.
+		Chip8::Engine engine;	// The engine to run it on.
+		double ns {0};			// Nanoseconds per instruction, 0 if crashed.
+		std::string json;		// Its results, as a line of JSON.
+	};
+
+
+	/**
+	 * @brief Runs a single benchmark once on the specified engine.
+	 *
+	 * @param json Set to its results, as a line of JSON.
+	 * @return The nanoseconds taken per instruction, or 0 if it crashed.
+	 */
+	double run_benchmark(const Benchmark& bench, Chip8::Engine engine,
+		Chip8::Access access, uint32_t freq, uint64_t seconds,
+		std::string& json)
+	{
+		static constexpr Chip8::_TimeType batch_period {Chip8::_billion / 60U};
+
+		NullKeyboard key;
+		NullDisplay disp;
+		NullSound snd;
+		Chip8 vm(&key, &disp, &snd);
+		std::string program {bench.program};
+		vm.platform(bench.platform);
+		vm.load_program(program);
+		vm.frequency(freq);
+		vm.engine(engine);
+		vm.access(access);
+
+		uint64_t batches {seconds * 60};
+		std::string error;
+		uint64_t batches_run {0};
+		uint64_t skipped_before {vm.skipped_cycles()};
+		uint64_t allocs_before {allocations.load()};
+		auto start_time {std::chrono::steady_clock::now()};
+		try
+		{
+			for (; batches_run < batches; ++batches_run)
+				vm.execute_batch(batch_period);
+		}
+		catch (Chip8Error& e) { error = e.what(); }
+		std::chrono::duration<double> wall
+			{std::chrono::steady_clock::now() - start_time};
+		uint64_t allocs {allocations.load() - allocs_before};
+
+		// Idle cycles fast forwarded through take no time to execute, so
+		// only the cycles actually executed are timed.
+		uint64_t skipped {vm.skipped_cycles() - skipped_before};
+		uint64_t cycles {vm.cycles() - skipped};
+
+		std::ostringstream os;
+		os << "{\"benchmark\": ";
+		write_json_string(os, bench.name);
+		os << ", \"engine\": \"" << engine_name(engine)
+			<< "\", \"access\": \""
+			<< (access == Chip8::Access::fast ? "fast" : "strict")
+			<< "\", \"platform\": \"" << platform_name(bench.platform)
+			<< "\", \"frequency\": " << freq
+			<< ", \"batches\": " << batches_run
+			<< ", \"cycles\": " << cycles
+			<< ", \"skipped_cycles\": " << skipped
+			<< ", \"wall_seconds\": " << wall.count()
+			<< ", \"cycles_per_second\": "
+			<< (wall.count() > 0 ? cycles / wall.count() : 0)
+			<< ", \"ns_per_instruction\": "
+			<< (cycles > 0 ? wall.count() * 1e9 / cycles : 0)
+			<< ", \"allocations_per_batch\": "
+			<< (batches_run > 0
+				? static_cast<double>(allocs) / batches_run : 0);
+		if (!error.empty())
+		{
+			os << ", \"error\": ";
+			write_json_string(os, error);
+		}
+		os << "}\n";
+		json = os.str();
+		return !error.empty() || cycles == 0 ? 0 : wall.count() * 1e9 / cycles;
+	}
+}
+
+
+int main(int argc, char** argv)
+{
+	if (argc == 2 && std::string(argv[1]) == "--help")
+	{
+		std::cout << usage;
+		return 0;
+	}
+	uint64_t seconds {60};
+	uint32_t repeat {1};
+	uint32_t freq {UINT16_MAX};
+	std::vector<Chip8::Engine> engines
+		{Chip8::Engine::interpreter, Chip8::Engine::block_cache};
+	// Without any compiled code, the compiled engine just interprets.
+	if (!Chip8Compiled::programs().empty())
+		engines.push_back(Chip8::Engine::compiled);
+	Chip8::Access access {Chip8::Access::strict};
+	std::optional<Chip8::Platform> platform;	// Guessed if not set.
+	std::string only;
+	std::string baseline_path;
+	double threshold {10};
+	std::map<std::string, double> baseline;
+	std::vector<Benchmark> benches {synthetic_benchmarks()};
+
+	try
+	{
+		for (int i {1}; i < argc; ++i)
+		{
+			std::string arg {argv[i]};
+			auto value = [&]() -> std::string
+			{
+				if (i + 1 >= argc)
+					throw std::invalid_argument("Missing value for " + arg);
+				return argv[++i];
+			};
+
+			if (arg == "--seconds") seconds = std::stoull(value());
+			else if (arg == "--repeat")
+			{
+				unsigned long runs {std::stoul(value())};
+				if (runs == 0 || runs > UINT32_MAX)
+					throw std::invalid_argument("Repeat count out of range.");
+				repeat = static_cast<uint32_t>(runs);
+			}
+			else if (arg == "--freq")
+			{
+				unsigned long value_hz {std::stoul(value())};
+				if (value_hz == 0 || value_hz > Chip8::max_frequency)
+					throw std::invalid_argument("Frequency out of range.");
+				freq = static_cast<uint32_t>(value_hz);
+			}
+			else if (arg == "--engine")
+			{
+				std::string name {value()};
+				if (name == "interpreter")
+					engines = {Chip8::Engine::interpreter};
+				else if (name == "block")
+					engines = {Chip8::Engine::block_cache};
+				else if (name == "compiled")
+					engines = {Chip8::Engine::compiled};
+				else if (name != "all")
+					throw std::invalid_argument("Unknown engine: " + name);
+			}
+			else if (arg == "--access")
+			{
+				std::string name {value()};
+				if (name == "strict") access = Chip8::Access::strict;
+				else if (name == "fast") access = Chip8::Access::fast;
+				else throw std::invalid_argument("Unknown access: " + name);
+			}
+			else if (arg == "--platform")
+			{
+				std::string name {value()};
+				if (name == "chip8") platform = Chip8::Platform::chip8;
+				else if (name == "chip48") platform = Chip8::Platform::chip48;
+				else if (name == "schip") platform = Chip8::Platform::schip;
+				else if (name == "xochip") platform = Chip8::Platform::xochip;
+				else if (name == "auto") platform.reset();
+				else throw std::invalid_argument("Unknown platform: " + name);
+			}
+			else if (arg == "--only") only = value();
+			else if (arg == "--baseline") baseline_path = value();
+			else if (arg == "--threshold")
+			{
+				threshold = std::stod(value());
+				if (threshold < 0)
+					throw std::invalid_argument("Threshold out of range.");
+			}
+			else if (arg.starts_with("--"))
+				throw std::invalid_argument("Unknown option: " + arg);
+			else
+			{
+				std::ifstream rom_file(arg, std::fstream::binary);
+				if (!rom_file)
+					throw std::invalid_argument("Unable to open ROM: " + arg);
+				std::stringstream sstr;
+				sstr << rom_file.rdbuf();
+				benches.push_back({std::filesystem::path(arg).stem().string(),
+					sstr.str()});
+			}
+		}
+		for (Benchmark& bench : benches)
+			bench.platform = platform.value_or(Chip8::detect_platform(
+				std::span<const uint8_t>(
+					reinterpret_cast<const uint8_t*>(bench.program.data()),
+					bench.program.size())));
+		if (!baseline_path.empty()) baseline = read_baseline(baseline_path);
+	}
+	catch (std::exception& e)
+	{
+		std::cerr << e.what() << '\n' << usage;
+		return 2;
+	}
+
+	std::vector<Run> runs;
+	for (const Benchmark& bench : benches)
+	{
+		if (!only.empty() && bench.name != only) continue;
+		for (Chip8::Engine engine : engines) runs.push_back({&bench, engine});
+	}
+
+	// Each round runs every benchmark once, keeping the fastest run of each,
+	// so other load on the host that outlasts a run skews few of them.
+	for (uint32_t round {0}; round < repeat; ++round)
+		for (Run& run : runs)
+		{
+			// Runs are deterministic, so one that crashed would again.
+			if (round > 0 && run.ns == 0) continue;
+			std::string json;
+			double ns;
+			try { ns = run_benchmark(*run.bench, run.engine, access, freq,
+				seconds, json); }
+			catch (std::invalid_argument& e)
+			{
+				std::cerr << run.bench->name << ": " << e.what() << '\n';
+				return 1;
+			}
+			if (round == 0 || ns < run.ns)
+			{
+				run.ns = ns;
+				run.json = std::move(json);
+			}
+		}
+
+	int status {0};
+	for (const Run& run : runs)
+	{
+		std::cout << run.json << std::flush;
+		std::string key {result_key(run.bench->name, engine_name(run.engine),
+			access == Chip8::Access::fast ? "fast" : "strict")};
+		auto base {baseline.find(key)};
+		if (base == baseline.end()) continue;
+		if (run.ns == 0)
+		{
+			std::cerr << key << " crashed, but ran in the baseline\n";
+			status = 1;
+			continue;
+		}
+		double slowdown {(run.ns / base->second - 1) * 100};
+		if (slowdown > threshold)
+		{
+			std::cerr << key << " is " << slowdown << "% slower than the "
+				"baseline: " << run.ns << " ns per instruction, up from "
+				<< base->second << '\n';
+			status = 1;
+		}
+	}
+	return status;
+}
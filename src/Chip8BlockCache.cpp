@@ -0,0 +1,75 @@
+#include "Chip8BlockCache.hpp"
+
+#include <algorithm>
+
+
+void Chip8BlockCache::invalidate(uint16_t addr, uint16_t len)
+{
+	uint16_t last {static_cast<uint16_t>(
+		std::min<size_t>(addr + len, _cover.size()))};
+	bool covered {false};
+	for (uint16_t i {addr}; i < last; ++i) covered |= _cover[i] != 0;
+	if (!covered) return;
+
+	// Any block covering the range must start within a block's length of it.
+	uint16_t first {static_cast<uint16_t>(
+		std::max(static_cast<int>(addr) - _Max_Block_Ops * 2 + 1, 0))};
+	for (uint16_t start {first}; start < last; ++start)
+	{
+		Block* block {_blocks[start].get()};
+		if (block != nullptr && block->end > addr) drop(start);
+	}
+}
+
+
+void Chip8BlockCache::clear()
+{
+	for (std::unique_ptr<Block>& block : _blocks) block.reset();
+	_cover.fill(0);
+}
+
+
+Chip8BlockCache::Block& Chip8BlockCache::translate(Chip8& vm, uint16_t addr)
+{
+	std::unique_ptr<Block> block {std::make_unique<Block>()};
+	block->start = addr;
+	uint16_t pc {addr};
+
+	while (true)
+	{
+		uint16_t instr {vm.get_hword(pc)};
+		uint8_t handler {Chip8::_DECODE_TABLE[instr]};
+		bool advance {handler != Chip8::H_JUMP && handler != Chip8::H_JUMPI
+			&& handler != Chip8::H_CALL && handler != Chip8::H_KEYD};
+		const Chip8::_HandlerTable& table {
+			Chip8::handler_table(vm._access, vm._platform)};
+		block->ops.push_back({table[handler], instr, handler, advance});
+		pc += 2;
+
+		// End the block at anything that doesn't fall through to the next
+		// instruction, that has to be re-executed, or that writes memory and
+		// so may discard the block.
+		bool ends {handler == Chip8::H_INVALID || !advance
+			|| handler == Chip8::H_RTS || handler == Chip8::H_SKE
+			|| handler == Chip8::H_SKNE || handler == Chip8::H_SKRE
+			|| handler == Chip8::H_SKRNE || handler == Chip8::H_SKPR
+			|| handler == Chip8::H_SKUP || handler == Chip8::H_DRAW
+			|| handler == Chip8::H_STOR || handler == Chip8::H_BCD};
+		if (ends || block->ops.size() == _Max_Block_Ops
+			|| pc + 1U >= vm._mem.size()) break;
+	}
+
+	block->end = pc;
+	for (uint16_t i {addr}; i < pc; ++i) ++_cover[i];
+	_blocks[addr] = std::move(block);
+	return *_blocks[addr];
+}
+
+
+void Chip8BlockCache::drop(uint16_t addr)
+{
+	Block* block {_blocks[addr].get()};
+	if (block == nullptr) return;
+	for (uint16_t i {block->start}; i < block->end; ++i) --_cover[i];
+	_blocks[addr].reset();
+}
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "Chip8.hpp"
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+
+/**
+ * @brief Cache of pre-decoded basic blocks of Chip-8 program memory, used by
+ * the Chip8::Engine::block_cache execution engine.
+ *
+ * A block is a straight-line run of instructions that ends with the first
+ * branch, skip, draw, key wait, or write to memory. Each instruction in a
+ * block is stored with its handler and whether the PC advances past it, so
+ * neither has to be worked out again while the block remains valid, and the
+ * VM executes a whole block without checking its PC between instructions.
+ * Blocks that cover memory written by the program are discarded and
+ * translated again on their next execution. Only the last instruction of a
+ * block can write memory, so a block is never discarded while it executes
+ * anything after that.
+ */
+class Chip8BlockCache
+{
+public:
+	/**
+	 * @brief A single pre-decoded instruction.
+	 */
+	struct Op
+	{
+		Chip8::_InstrFunc	func;		// Implements the instruction.
+		uint16_t			instr;		// The instruction itself.
+		uint8_t				handler;	// Index of func in _HANDLER_TABLE.
+		bool				advance;	// Set if the PC moves on afterward.
+	};
+
+	/**
+	 * @brief A cached run of straight-line instructions.
+	 */
+	struct Block
+	{
+		uint16_t		start;	// Address of the first instruction.
+		uint16_t		end;	// Address just past the last instruction.
+		std::vector<Op>	ops;	// The instructions of the block, in order.
+	};
+
+	/**
+	 * @brief Returns the block starting at the VM's PC, translating it if
+	 * there is not one cached for the address.
+	 *
+	 * @param vm The VM whose next instructions are to be executed. Its PC
+	 * must point at a full halfword of program memory.
+	 * @return The block at the VM's PC. The reference is only valid until
+	 * the next call to any of this object's methods, including through an
+	 * instruction that writes memory.
+	 */
+	const Block& find(Chip8& vm);
+
+	/**
+	 * @brief Discards every block that covers any of the specified addresses.
+	 * Should be called whenever the VM writes to its memory.
+	 *
+	 * @param addr The first address written.
+	 * @param len The number of consecutive bytes written.
+	 */
+	void invalidate(uint16_t addr, uint16_t len);
+
+	/**
+	 * @brief Discards every cached block.
+	 */
+	void clear();
+
+protected:
+	// Longest block that will be translated, in instructions.
+	static constexpr uint16_t _Max_Block_Ops {64};
+
+	// Cached blocks, indexed by their starting address.
+	std::array<std::unique_ptr<Block>, 4096> _blocks;
+	// Number of cached blocks that cover each memory address.
+	std::array<uint8_t, 4096> _cover {};
+
+	/**
+	 * @brief Translates the block that starts at the specified address.
+	 *
+	 * @param vm The VM whose memory holds the block.
+	 * @param addr The address of the first instruction of the block.
+	 * @return The newly cached block.
+	 */
+	Block& translate(Chip8& vm, uint16_t addr);
+
+	/**
+	 * @brief Removes the block that starts at the specified address, if any.
+	 *
+	 * @param addr The starting address of the block to drop.
+	 */
+	void drop(uint16_t addr);
+};
+
+
+// Defined here so the lookup can be inlined into Chip8::execute_blocks.
+inline const Chip8BlockCache::Block& Chip8BlockCache::find(Chip8& vm)
+{
+	Block* block {_blocks[vm._pc].get()};
+	return block != nullptr ? *block : translate(vm, vm._pc);
+}
@@ -0,0 +1,84 @@
+#include "Chip8Compiled.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+
+Chip8Compiled::Registration::Registration(const Program& program)
+{
+	registry().push_back(program);
+}
+
+
+std::span<const Chip8Compiled::Program> Chip8Compiled::programs()
+{
+	return registry();
+}
+
+
+std::vector<Chip8Compiled::Program>& Chip8Compiled::registry()
+{
+	// Constructed on first use, as generated code registers during static
+	// initialization in no particular order.
+	static std::vector<Program> programs;
+	return programs;
+}
+
+
+void Chip8Compiled::attach(Chip8& vm)
+{
+	_entries.fill(nullptr);
+	_cover.fill(0);
+
+	// A state may have been saved after the program wrote over some of its
+	// code, so programs are matched by how many of their blocks are intact.
+	auto intact = [&vm](const Program& program, const Block& block)
+	{
+		size_t offset {static_cast<size_t>(block.start - Chip8::_Prog_Start)};
+		return memcmp(&vm._mem[block.start], &program.rom[offset],
+			block.ops * 2U) == 0;
+	};
+	const Program* best {nullptr};
+	size_t best_count {0};
+	for (const Program& program : registry())
+	{
+		if (program.platform != vm._platform) continue;
+		size_t count {static_cast<size_t>(std::count_if(
+			program.blocks.begin(), program.blocks.end(),
+			[&](const Block& block) { return intact(program, block); }))};
+		if (count > best_count)
+		{
+			best = &program;
+			best_count = count;
+		}
+	}
+	if (best == nullptr) return;
+
+	for (const Block& block : best->blocks)
+	{
+		if (!intact(*best, block)) continue;
+		_entries[block.start] = &block;
+		for (uint16_t i {0}; i < block.ops * 2U; ++i) ++_cover[block.start + i];
+	}
+}
+
+
+void Chip8Compiled::invalidate(uint16_t addr, uint16_t len)
+{
+	uint16_t last {static_cast<uint16_t>(
+		std::min<size_t>(addr + len, _cover.size()))};
+	bool covered {false};
+	for (uint16_t i {addr}; i < last; ++i) covered |= _cover[i] != 0;
+	if (!covered) return;
+
+	// Any block covering the range must start within a block's length of it.
+	uint16_t first {static_cast<uint16_t>(
+		std::max(static_cast<int>(addr) - max_block_ops * 2 + 1, 0))};
+	for (uint16_t start {first}; start < last; ++start)
+	{
+		const Block* block {_entries[start]};
+		if (block == nullptr || start + block->ops * 2U <= addr) continue;
+		for (uint16_t i {0}; i < block->ops * 2U; ++i) --_cover[start + i];
+		_entries[start] = nullptr;
+	}
+}
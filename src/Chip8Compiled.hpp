@@ -0,0 +1,155 @@
+#pragma once
+
+#include "Chip8.hpp"
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+
+/**
+ * @brief Code compiled ahead of time for particular programs, used by the
+ * Chip8::Engine::compiled execution engine.
+ *
+ * Chip8Recompiler translates each basic block reachable from the start of a
+ * program into a C++ function that calls the same instruction implementations
+ * the interpreter does, and registers the blocks with this class once the
+ * generated code is linked in. A VM using the engine executes a compiled block
+ * wherever its PC is at the start of one that matches its memory, and
+ * interprets every other instruction, such as the targets of BNNN, code that
+ * was never found to be reachable, and blocks that cover memory written by the
+ * program.
+ */
+class Chip8Compiled
+{
+public:
+	// Type of a function executing a compiled block.
+	typedef void (*_BlockFunc) (Chip8& vm);
+
+	// Longest block that will be compiled, in instructions.
+	static constexpr uint16_t max_block_ops {64};
+
+	/**
+	 * @brief A compiled run of straight-line instructions.
+	 */
+	struct Block
+	{
+		uint16_t		start;		// Address of the first instruction.
+		uint16_t		ops;		// Number of instructions in the block.
+		_BlockFunc		strict;		// Executes it with strict access.
+		_BlockFunc		fast;		// Executes it with fast access.
+		const uint8_t*	handlers;	// Handler of each of its instructions.
+	};
+
+	/**
+	 * @brief The compiled blocks of a program.
+	 */
+	struct Program
+	{
+		Chip8::Platform				platform;	// Quirks it is compiled with.
+		std::span<const uint8_t>	rom;		// The program compiled.
+		std::span<const Block>		blocks;		// Its blocks, by address.
+	};
+
+	/**
+	 * @brief Registers a program when constructed, so generated code can add
+	 * itself before main() runs.
+	 */
+	struct Registration
+	{
+		/**
+		 * @param program The program, which must outlive every VM.
+		 */
+		Registration(const Program& program);
+	};
+
+	/**
+	 * @return The programs that have been registered.
+	 */
+	static std::span<const Program> programs();
+
+	/**
+	 * @param pc The address of the next instruction.
+	 * @return The block to execute at the address, or nullptr if the
+	 * instruction there has to be interpreted.
+	 */
+	const Block* find(uint16_t pc) const
+	{
+		// A return can leave the PC anywhere in 16 bits.
+		return pc < _entries.size() ? _entries[pc] : nullptr;
+	}
+
+	/**
+	 * @brief Executes a block, counting its cycles. Must only be called with
+	 * a block returned by find() for the VM's PC.
+	 *
+	 * @param vm The VM to execute the block on.
+	 * @param block The block to execute.
+	 * @throws Chip8Error if an instruction could not be executed, after
+	 * counting the cycles up to and including it.
+	 */
+	template <typename Policy>
+	static void run(Chip8& vm, const Block& block);
+
+	/**
+	 * @brief Chooses the registered program that best matches the VM's memory
+	 * and platform, and which of its blocks are still intact. Should be
+	 * called whenever the VM's memory or platform is replaced.
+	 *
+	 * @param vm The VM to execute blocks on.
+	 */
+	void attach(Chip8& vm);
+
+	/**
+	 * @brief Stops executing every block that covers any of the specified
+	 * addresses. Should be called whenever the VM writes to its memory.
+	 *
+	 * @param addr The first address written.
+	 * @param len The number of consecutive bytes written.
+	 */
+	void invalidate(uint16_t addr, uint16_t len);
+
+protected:
+	/**
+	 * @return Every program that has been registered.
+	 */
+	static std::vector<Program>& registry();
+
+	// Block to execute at each address, or nullptr.
+	std::array<const Block*, 4096> _entries {};
+	// Number of blocks to execute that cover each memory address.
+	std::array<uint8_t, 4096> _cover {};
+};
+
+
+template <typename Policy>
+inline void Chip8Compiled::run(Chip8& vm, const Block& block)
+{
+	// The last instruction runs on the cycle it would be interpreted on, as
+	// EX9E and EXA1 replaying input depend on, so a block's cycles are counted
+	// before it runs.
+	vm._cycle += block.ops - 1;
+	try
+	{
+		if constexpr (std::is_same_v<Policy, Chip8::_Fast>) block.fast(vm);
+		else block.strict(vm);
+	}
+	catch (Chip8Error& e)
+	{
+		// Blocks set the PC before any instruction that can crash.
+		uint16_t done {static_cast<uint16_t>((vm._pc - block.start) / 2)};
+		vm._cycle -= block.ops - 1 - done;
+#ifdef CHIP8_INSTRUMENT
+		for (uint16_t i {0}; i <= done; ++i)
+			++vm._stats.executed[block.handlers[i]];
+#endif
+		throw e;
+	}
+	++vm._cycle;
+#ifdef CHIP8_INSTRUMENT
+	for (uint16_t i {0}; i < block.ops; ++i)
+		++vm._stats.executed[block.handlers[i]];
+#endif
+}
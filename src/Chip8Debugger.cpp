@@ -0,0 +1,124 @@
+#include "Chip8Debugger.hpp"
+
+
+namespace
+{
+	/**
+	 * @return For each page of 256 bytes, a bit set if any address in it is.
+	 */
+	uint16_t pages(const std::bitset<4096>& watch)
+	{
+		uint16_t result {0};
+		for (size_t addr {0}; addr < watch.size(); ++addr)
+			if (watch.test(addr)) result |= 1 << (addr >> 8);
+		return result;
+	}
+}
+
+
+Chip8Debugger::Registers Chip8Debugger::registers(const Chip8& vm)
+{
+	return {vm._pc, vm._index, vm._sp, vm._delay, vm._sound, vm._gprf,
+		vm._cycle, vm._key_wait};
+}
+
+
+std::span<const uint8_t, 4096> Chip8Debugger::memory(const Chip8& vm)
+{
+	return vm._mem;
+}
+
+
+void Chip8Debugger::breakpoint(uint16_t addr, bool set)
+{
+	_breakpoints.set(addr & 0xfff, set);
+}
+
+
+bool Chip8Debugger::breakpoint(uint16_t addr) const
+{
+	return _breakpoints.test(addr & 0xfff);
+}
+
+
+void Chip8Debugger::watch(uint16_t addr, uint16_t len, bool read, bool write)
+{
+	for (uint32_t i {0}; i < len; ++i)
+	{
+		size_t a {(addr + i) & 0xfff};
+		if (read) _read_watch.set(a);
+		if (write) _write_watch.set(a);
+	}
+	_read_pages = pages(_read_watch);
+	_write_pages = pages(_write_watch);
+}
+
+
+void Chip8Debugger::unwatch(uint16_t addr, uint16_t len)
+{
+	for (uint32_t i {0}; i < len; ++i)
+	{
+		size_t a {(addr + i) & 0xfff};
+		_read_watch.reset(a);
+		_write_watch.reset(a);
+	}
+	_read_pages = pages(_read_watch);
+	_write_pages = pages(_write_watch);
+}
+
+
+void Chip8Debugger::clear()
+{
+	_breakpoints.reset();
+	_read_watch.reset();
+	_write_watch.reset();
+	_read_pages = 0;
+	_write_pages = 0;
+}
+
+
+bool Chip8Debugger::stopped() const
+{
+	return _reason != Stop::none;
+}
+
+
+Chip8Debugger::Stop Chip8Debugger::reason() const
+{
+	return _reason;
+}
+
+
+uint16_t Chip8Debugger::address() const
+{
+	return _addr;
+}
+
+
+void Chip8Debugger::pause()
+{
+	if (_reason == Stop::none) _reason = Stop::paused;
+}
+
+
+void Chip8Debugger::resume()
+{
+	_reason = Stop::none;
+	_pass = true;
+}
+
+
+void Chip8Debugger::step(Chip8& vm, uint64_t cycles)
+{
+	if (cycles == 0) return;
+	resume();
+	vm.execute_batch(vm.cycles_duration(cycles));
+	if (_reason == Stop::none) halt(Stop::step, vm._pc);
+}
+
+
+void Chip8Debugger::halt(Stop reason, uint16_t addr)
+{
+	_reason = reason;
+	_addr = addr;
+}
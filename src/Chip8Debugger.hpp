@@ -0,0 +1,217 @@
+#pragma once
+
+#include "Chip8.hpp"
+
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <span>
+#include <utility>
+
+
+/**
+ * @brief Breakpoints, memory watchpoints, and single stepping for a program.
+ *
+ * Attach a debugger with Chip8::debugger() and the VM stops before executing
+ * an instruction at any address with a breakpoint, and after executing any
+ * FX55, FX65, FX33, or DXYN that writes or reads a watched address. A stopped
+ * VM does nothing while batches are executed, with emulated time not passing,
+ * until resume() or step() is called. The checks are only built into the
+ * batches of an attached VM, which are always interpreted and never fast
+ * forward through idle cycles, so a VM without a debugger runs as fast as it
+ * would without this class.
+ *
+ * A debugger must only be attached to one VM at a time, and must only be used
+ * from the thread executing it.
+ */
+class Chip8Debugger
+{
+public:
+	/**
+	 * @brief Why the VM was stopped.
+	 */
+	enum class Stop
+	{
+		none,		// The VM is running.
+		breakpoint,	// The PC reached a breakpoint.
+		read,		// An instruction read a watched address.
+		write,		// An instruction wrote a watched address.
+		step,		// A step finished.
+		paused,		// pause() was called.
+	};
+
+	/**
+	 * @brief The registers of a VM, as they are between instructions.
+	 */
+	struct Registers
+	{
+		uint16_t				pc;		// Address of the next instruction.
+		uint16_t				index;	// The I register.
+		uint16_t				sp;		// Address of the top of the stack.
+		uint8_t					delay;	// The delay timer.
+		uint8_t					sound;	// The sound timer.
+		std::array<uint8_t, 16>	v;		// V0 through VF.
+		uint64_t				cycle;	// Cycles executed so far.
+		bool					key_wait;	// Set while FX0A waits.
+	};
+
+	/**
+	 * @param vm A VM.
+	 * @return The VM's registers.
+	 */
+	static Registers registers(const Chip8& vm);
+
+	/**
+	 * @param vm A VM.
+	 * @return The VM's memory, which is only valid until the VM executes or
+	 * is destroyed.
+	 */
+	static std::span<const uint8_t, 4096> memory(const Chip8& vm);
+
+	/**
+	 * @brief Set or clear a breakpoint, stopping the VM before it executes the
+	 * instruction at an address.
+	 *
+	 * @param addr The address of the instruction.
+	 * @param set Whether to set the breakpoint, or else clear it.
+	 */
+	void breakpoint(uint16_t addr, bool set = true);
+
+	/**
+	 * @param addr An address.
+	 * @return Whether a breakpoint is set at the address.
+	 */
+	bool breakpoint(uint16_t addr) const;
+
+	/**
+	 * @brief Watch a range of memory, stopping the VM after any instruction
+	 * that accesses it the specified ways. Addresses wrap at the end of memory.
+	 *
+	 * @param addr The first address to watch.
+	 * @param len The number of consecutive addresses to watch.
+	 * @param read Whether to stop when the range is read.
+	 * @param write Whether to stop when the range is written.
+	 */
+	void watch(uint16_t addr, uint16_t len, bool read, bool write);
+
+	/**
+	 * @brief Stop watching a range of memory at all.
+	 *
+	 * @param addr The first address to stop watching.
+	 * @param len The number of consecutive addresses.
+	 */
+	void unwatch(uint16_t addr, uint16_t len);
+
+	/**
+	 * @brief Clears every breakpoint and watchpoint.
+	 */
+	void clear();
+
+	/**
+	 * @return Whether the VM is stopped.
+	 */
+	bool stopped() const;
+
+	/**
+	 * @return Why the VM was last stopped, or Stop::none if it is running.
+	 */
+	Stop reason() const;
+
+	/**
+	 * @return The PC the VM stopped at for a breakpoint or step, or the
+	 * watched address accessed.
+	 */
+	uint16_t address() const;
+
+	/**
+	 * @brief Stops the VM before its next instruction.
+	 */
+	void pause();
+
+	/**
+	 * @brief Lets a stopped VM run again from the next batch, without stopping
+	 * for any breakpoint at its PC.
+	 */
+	void resume();
+
+	/**
+	 * @brief Executes instruction cycles on a VM the debugger is attached to,
+	 * then stops it, unless a breakpoint or watchpoint stops it first. Any
+	 * breakpoint at the PC it starts at is passed over.
+	 *
+	 * @param vm The VM, which must have this debugger attached.
+	 * @param cycles The number of cycles to execute, any of which may be
+	 * spent waiting in FX0A.
+	 * @throws Chip8Error if the VM crashes or has already crashed.
+	 */
+	void step(Chip8& vm, uint64_t cycles = 1);
+
+protected:
+	friend class Chip8;
+
+	/**
+	 * @brief Checks whether the VM must stop before its next cycle, stopping
+	 * it for a breakpoint at its PC.
+	 *
+	 * @param vm The VM about to execute a cycle.
+	 * @return Whether the VM is stopped.
+	 */
+	bool check(const Chip8& vm);
+
+	/**
+	 * @brief Stops the VM after the current instruction if it accesses a
+	 * watched address.
+	 *
+	 * @param addr The first address accessed, which may be past the end of
+	 * memory.
+	 * @param len The number of consecutive addresses accessed.
+	 * @param write Whether they are written, or else read.
+	 */
+	void access(uint32_t addr, uint32_t len, bool write);
+
+	/**
+	 * @brief Stops the VM.
+	 */
+	void halt(Stop reason, uint16_t addr);
+
+	std::bitset<4096>	_breakpoints;	// Set for each address to stop at.
+	std::bitset<4096>	_read_watch;	// Set for each address to watch reads.
+	std::bitset<4096>	_write_watch;	// Set for each address to watch writes.
+	// Bit k is set while any address in page k, of 256 bytes, is watched.
+	uint16_t	_read_pages {0};
+	uint16_t	_write_pages {0};
+	Stop		_reason {Stop::none};	// Why the VM is stopped.
+	uint16_t	_addr {0};				// Where the VM stopped.
+	bool		_pass {false};	// Set to pass over a breakpoint at the PC.
+};
+
+
+inline bool Chip8Debugger::check(const Chip8& vm)
+{
+	if (_reason != Stop::none) return true;
+	// Waiting in FX0A executes nothing, so breakpoints are only checked for
+	// the cycle the instruction first runs on.
+	bool pass {std::exchange(_pass, false)};
+	if (pass || vm._key_wait || vm._pc >= _breakpoints.size()
+		|| !_breakpoints.test(vm._pc))
+		return false;
+	halt(Stop::breakpoint, vm._pc);
+	return true;
+}
+
+
+inline void Chip8Debugger::access(uint32_t addr, uint32_t len, bool write)
+{
+	uint16_t pages {write ? _write_pages : _read_pages};
+	if (pages == 0) return;
+	const std::bitset<4096>& watch {write ? _write_watch : _read_watch};
+	for (uint32_t i {0}; i < len; ++i)
+	{
+		uint16_t a {static_cast<uint16_t>((addr + i) & 0xfff)};
+		if ((pages >> (a >> 8) & 1) && watch.test(a))
+		{
+			halt(write ? Stop::write : Stop::read, a);
+			return;
+		}
+	}
+}
@@ -0,0 +1,29 @@
+#include "Chip8FrameBuffer.hpp"
+
+
+void Chip8FrameBuffer::publish(const Chip8Screen& screen, uint64_t dirty)
+{
+	Frame& frame {_frames[_back]};
+	frame.screen = screen;
+	frame.dirty = dirty;
+	frame.sequence = _published.load(std::memory_order_relaxed) + 1;
+	// Releases the frame to the reader and takes back whichever buffer it
+	// isn't holding.
+	_back = _middle.exchange(_back | _Fresh, std::memory_order_acq_rel)
+		& ~_Fresh;
+	_published.store(frame.sequence, std::memory_order_release);
+}
+
+
+const Chip8FrameBuffer::Frame& Chip8FrameBuffer::latest()
+{
+	if (_middle.load(std::memory_order_relaxed) & _Fresh)
+		_front = _middle.exchange(_front, std::memory_order_acq_rel) & ~_Fresh;
+	return _frames[_front];
+}
+
+
+uint64_t Chip8FrameBuffer::sequence()
+{
+	return _published.load(std::memory_order_acquire);
+}
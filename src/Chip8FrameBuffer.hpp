@@ -0,0 +1,66 @@
+#pragma once
+
+#include "Chip8Screen.hpp"
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+
+/**
+ * @brief Hands completed frames of screen memory from the thread running a VM
+ * to a single reader, without either side ever blocking the other.
+ *
+ * Frames are triple buffered. The writer fills its back buffer and swaps it
+ * for the middle buffer; the reader swaps the middle buffer for its front
+ * buffer whenever a frame newer than the one it holds has been published. The
+ * reader therefore always sees a whole frame, and the writer never waits for
+ * the reader to finish with one.
+ */
+class Chip8FrameBuffer
+{
+public:
+	/**
+	 * @brief A published frame.
+	 */
+	struct Frame
+	{
+		Chip8Screen screen;			// Screen memory.
+		uint64_t sequence {0};		// Increases with every frame.
+		uint64_t dirty {0};			// Rows changed since the last.
+	};
+
+	/**
+	 * @brief Publishes a frame. Must not be called by more than one thread at
+	 * a time.
+	 *
+	 * @param screen The screen memory of the frame.
+	 * @param dirty Bit y is set if row y changed since the last frame
+	 * published. Every bit is set if the resolution changed.
+	 */
+	void publish(const Chip8Screen& screen, uint64_t dirty);
+
+	/**
+	 * @brief Takes the most recently published frame. Must not be called by
+	 * more than one thread at a time.
+	 *
+	 * @return The frame, which is left untouched by the writer until the next
+	 * call. Its sequence is 0 if no frame has been published.
+	 */
+	const Frame& latest();
+
+	/**
+	 * @return The sequence of the most recently published frame. May be called
+	 * from any thread.
+	 */
+	uint64_t sequence();
+
+protected:
+	// Set in _middle if it holds a frame the reader hasn't taken.
+	static constexpr uint8_t _Fresh {0x4};
+
+	std::array<Frame, 3> _frames;			// The three buffers.
+	uint8_t _back {0};						// Buffer owned by the writer.
+	std::atomic<uint8_t> _middle {1};		// Buffer being handed over.
+	uint8_t _front {2};						// Buffer owned by the reader.
+	std::atomic<uint64_t> _published {0};	// Sequence of the last frame.
+};
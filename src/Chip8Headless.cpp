@@ -0,0 +1,56 @@
+#include "Chip8Headless.hpp"
+
+#include "Chip8.hpp"
+
+
+
+bool NullKeyboard::test_key(uint8_t)
+{
+	return false;
+}
+
+
+void NullDisplay::mark()
+{}
+
+
+void NullSound::start_sound()
+{}
+
+
+void NullSound::stop_sound()
+{}
+
+
+bool RecordingKeyboard::test_key(uint8_t key)
+{
+	++_tests.at(key);
+	return _states.at(key);
+}
+
+
+RecordingDisplay::RecordingDisplay(size_t max_frames)
+	: _max_frames(max_frames)
+{}
+
+
+void RecordingDisplay::mark()
+{
+	++_marks;
+	if (_frames.size() >= _max_frames) return;
+	_frames.push_back(_vm->get_screen());
+}
+
+
+void RecordingSound::start_sound()
+{
+	++_starts;
+	_sounding = true;
+}
+
+
+void RecordingSound::stop_sound()
+{
+	++_stops;
+	_sounding = false;
+}
@@ -0,0 +1,125 @@
+#pragma once
+
+#include "Chip8Observers.hpp"
+#include "Chip8Screen.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+/**
+ * @brief Keyboard delegate for which no key is ever pressed.
+ */
+struct NullKeyboard
+	: public Chip8Keyboard
+{
+	/**
+	 * @return false, as no keys exist to be pressed.
+	 */
+	bool test_key(uint8_t key) override;
+};
+
+
+/**
+ * @brief Display delegate that discards all output.
+ */
+class NullDisplay
+	: public Chip8Display
+{
+public:
+	/**
+	 * @brief Ignores the display update.
+	 */
+	void mark() override;
+};
+
+
+/**
+ * @brief Sound delegate that discards all output.
+ */
+struct NullSound
+	: public Chip8Sound
+{
+	/**
+	 * @brief Ignores the request to start sound.
+	 */
+	void start_sound() override;
+
+	/**
+	 * @brief Ignores the request to stop sound.
+	 */
+	void stop_sound() override;
+};
+
+
+/**
+ * @brief Keyboard delegate whose key states are set by the host and which
+ * counts how often each key is tested by the VM.
+ */
+struct RecordingKeyboard
+	: public Chip8Keyboard
+{
+	std::array<bool, 16>		_states {};	// Set for each key held down.
+	std::array<uint64_t, 16>	_tests {};	// Number of tests of each key.
+
+	/**
+	 * @brief Test if a key is held down and record that it was tested.
+	 *
+	 * @param key The value of the key to test.
+	 * @return True if the key is held down; false otherwise.
+	 */
+	bool test_key(uint8_t key) override;
+};
+
+
+/**
+ * @brief Display delegate that keeps a copy of the screen every time the VM
+ * updates it.
+ */
+class RecordingDisplay
+	: public Chip8Display
+{
+public:
+	// Screen contents after each update, oldest first.
+	std::vector<Chip8Screen> _frames;
+	// Largest number of frames kept; later updates are counted but not kept.
+	size_t _max_frames;
+	// Total number of display updates made by the VM.
+	uint64_t _marks {0};
+
+	/**
+	 * @brief Construct a new RecordingDisplay.
+	 *
+	 * @param max_frames The largest number of frames to keep.
+	 */
+	RecordingDisplay(size_t max_frames = 4096);
+
+	/**
+	 * @brief Records the updated display output.
+	 */
+	void mark() override;
+};
+
+
+/**
+ * @brief Sound delegate that records when the VM starts and stops sound.
+ */
+struct RecordingSound
+	: public Chip8Sound
+{
+	uint64_t	_starts {0};		// Number of times sound was started.
+	uint64_t	_stops {0};			// Number of times sound was stopped.
+	bool		_sounding {false};	// Set if sound is currently playing.
+
+	/**
+	 * @brief Records that sound has started.
+	 */
+	void start_sound() override;
+
+	/**
+	 * @brief Records that sound has stopped.
+	 */
+	void stop_sound() override;
+};
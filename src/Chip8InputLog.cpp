@@ -0,0 +1,285 @@
+#include "Chip8InputLog.hpp"
+
+#include <cstring>
+#include <stdexcept>
+
+
+namespace
+{
+	/**
+	 * @brief Stores value at out as little endian and advances out past it.
+	 */
+	template <typename T>
+	inline void put(uint8_t*& out, T value)
+	{
+		uint64_t bits {static_cast<uint64_t>(value)};
+		for (size_t i = 0; i < sizeof(T); ++i)
+			*out++ = static_cast<uint8_t>(bits >> 8 * i);
+	}
+
+
+	/**
+	 * @return The little endian value at in, advancing in past it.
+	 */
+	template <typename T>
+	inline T get(const uint8_t*& in)
+	{
+		uint64_t value {0};
+		for (size_t i = 0; i < sizeof(T); ++i)
+			value |= static_cast<uint64_t>(*in++) << 8 * i;
+		return static_cast<T>(value);
+	}
+}
+
+
+Chip8InputLog::Mode Chip8InputLog::mode()
+{
+	return _mode;
+}
+
+
+void Chip8InputLog::start_recording(Chip8& vm)
+{
+	_start.resize(Chip8::_Max_State_Size);
+	_start.resize(vm.write_state(reinterpret_cast<uint8_t*>(_start.data())));
+	_events.clear();
+	_end = vm._cycle;
+	_freq = vm._freq;
+	_platform = vm._platform;
+	_keys = 0;
+	_mode = Mode::recording;
+	vm._input_log = this;
+}
+
+
+void Chip8InputLog::start_replay(Chip8& vm)
+{
+	if (_start.empty()) throw std::invalid_argument("Nothing was recorded.");
+
+	// The state was saved at the recorded frequency, so is decoded at it to
+	// keep its timing exact.
+	uint32_t freq {vm._freq};
+	vm._freq = _freq;
+	try
+	{
+		vm.read_state(reinterpret_cast<const uint8_t*>(_start.data()),
+			_start.size());
+	}
+	catch (std::invalid_argument& e)
+	{
+		vm._freq = freq;
+		throw e;
+	}
+	// The cache was cleared with the state, so holds nothing of the old one.
+	vm._platform = _platform;
+	_keys = 0;
+	_next = 0;
+	_mode = Mode::replaying;
+	vm._input_log = this;
+}
+
+
+void Chip8InputLog::stop(Chip8& vm)
+{
+	if (_mode == Mode::recording) _end = vm._cycle;
+	_mode = Mode::idle;
+	if (vm._input_log == this) vm._input_log = nullptr;
+}
+
+
+uint64_t Chip8InputLog::end_cycle()
+{
+	return _end;
+}
+
+
+uint32_t Chip8InputLog::frequency()
+{
+	return _freq;
+}
+
+
+Chip8::Platform Chip8InputLog::platform()
+{
+	return _platform;
+}
+
+
+const std::vector<Chip8InputLog::Event>& Chip8InputLog::events()
+{
+	return _events;
+}
+
+
+bool Chip8InputLog::record_key(Chip8& vm, bool pressed, uint8_t key)
+{
+	if (_mode == Mode::replaying) return false;
+	if (_mode == Mode::recording)
+		_events.push_back({vm._cycle, pressed ? K_PRESS : K_RELEASE, key});
+	return true;
+}
+
+
+bool Chip8InputLog::test_key(Chip8& vm, uint8_t key)
+{
+	if (_mode == Mode::idle) return vm.poll_key(key);
+	// Keys that don't exist can't be logged, so are never held down.
+	if (key > 0xf) return false;
+	uint16_t bit {static_cast<uint16_t>(1U << key)};
+	if (_mode == Mode::replaying) return _keys & bit;
+
+	bool held {vm.poll_key(key)};
+	// Only changes are logged, which is all a replay needs to answer tests.
+	if (held != bool(_keys & bit))
+	{
+		_events.push_back({vm._cycle, held ? K_DOWN : K_UP, key});
+		_keys ^= bit;
+	}
+	return held;
+}
+
+
+uint64_t Chip8InputLog::next_cycle()
+{
+	if (_mode != Mode::replaying || _next == _events.size()) return UINT64_MAX;
+	return _events[_next].cycle;
+}
+
+
+void Chip8InputLog::replay(Chip8& vm)
+{
+	if (_mode != Mode::replaying) return;
+	for (; _next < _events.size() && _events[_next].cycle <= vm._cycle; ++_next)
+	{
+		const Event& event {_events[_next]};
+		switch (event.kind)
+		{
+			case K_PRESS:
+				// A press that failed when recorded had no effect.
+				try { vm.press_key(event.key); }
+				catch (Chip8Error&) {}
+				break;
+			case K_RELEASE:
+				vm.release_key(event.key);
+				break;
+			case K_UP:
+				_keys &= ~(1U << event.key);
+				break;
+			default:
+				_keys |= 1U << event.key;
+				break;
+		}
+	}
+}
+
+
+std::ostream& operator<<(std::ostream& os, Chip8InputLog& log)
+{
+	std::vector<uint8_t> buffer(Chip8InputLog::_Header_Size
+		+ log._events.size() * Chip8InputLog::_Event_Size);
+	uint8_t* out {buffer.data()};
+	memcpy(out, Chip8InputLog::_Magic, sizeof(Chip8InputLog::_Magic));
+	out += sizeof(Chip8InputLog::_Magic);
+	put<uint16_t>(out, Chip8InputLog::_Version);
+	put<uint16_t>(out, 0); // The frequency of version 1 and 2 logs.
+	put<uint64_t>(out, log._end);
+	put<uint32_t>(out, log._start.size());
+	put<uint32_t>(out, log._events.size());
+	put<uint16_t>(out, static_cast<uint16_t>(log._platform));
+	put<uint32_t>(out, log._freq);
+	for (const Chip8InputLog::Event& event : log._events)
+	{
+		put<uint64_t>(out, event.cycle);
+		put<uint8_t>(out, event.kind);
+		put<uint8_t>(out, event.key);
+	}
+
+	std::ios_base::iostate prev_state = os.exceptions();
+	os.exceptions(std::istream::failbit);
+	try
+	{
+		os.write(reinterpret_cast<char*>(buffer.data()),
+			Chip8InputLog::_Header_Size);
+		os.write(reinterpret_cast<char*>(log._start.data()), log._start.size());
+		os.write(reinterpret_cast<char*>(buffer.data())
+			+ Chip8InputLog::_Header_Size,
+			buffer.size() - Chip8InputLog::_Header_Size);
+	}
+	catch (std::ios_base::failure& e)
+	{
+		os.exceptions(prev_state);
+		throw e;
+	}
+	os.exceptions(prev_state);
+	return os;
+}
+
+
+std::istream& operator>>(std::istream& is, Chip8InputLog& log)
+{
+	std::ios_base::iostate prev_state = is.exceptions();
+	is.exceptions(std::istream::eofbit | std::istream::failbit);
+	try
+	{
+		uint8_t header[Chip8InputLog::_Header_Size];
+		is.read(reinterpret_cast<char*>(header),
+			Chip8InputLog::_V1_Header_Size);
+		const uint8_t* in {header};
+		if (memcmp(in, Chip8InputLog::_Magic, sizeof(Chip8InputLog::_Magic)))
+			throw std::ios_base::failure("Not an input log.");
+		in += sizeof(Chip8InputLog::_Magic);
+		uint16_t version {get<uint16_t>(in)};
+		if (version == 0 || version > Chip8InputLog::_Version)
+			throw std::ios_base::failure("Unsupported input log version.");
+		uint32_t freq {get<uint16_t>(in)};
+		uint64_t end {get<uint64_t>(in)};
+		uint32_t state_size {get<uint32_t>(in)};
+		uint32_t count {get<uint32_t>(in)};
+		uint16_t platform {0}; // Version 1 logs are of the original Chip-8.
+		if (version > 1)
+		{
+			size_t size {version > 2 ? Chip8InputLog::_Header_Size
+				: Chip8InputLog::_V2_Header_Size};
+			is.read(reinterpret_cast<char*>(header)
+				+ Chip8InputLog::_V1_Header_Size,
+				size - Chip8InputLog::_V1_Header_Size);
+			platform = get<uint16_t>(in);
+			if (version > 2) freq = get<uint32_t>(in);
+		}
+		if (freq == 0 || freq > Chip8::max_frequency || state_size > Chip8::_Max_State_Size
+			|| platform > static_cast<uint16_t>(Chip8::Platform::xochip))
+			throw std::ios_base::failure("Input log is corrupt.");
+
+		std::vector<std::byte> start(state_size);
+		is.read(reinterpret_cast<char*>(start.data()), state_size);
+		std::vector<Chip8InputLog::Event> events;
+		uint8_t data[Chip8InputLog::_Event_Size];
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			is.read(reinterpret_cast<char*>(data), sizeof(data));
+			in = data;
+			Chip8InputLog::Event event;
+			event.cycle = get<uint64_t>(in);
+			uint8_t kind {get<uint8_t>(in)};
+			event.key = get<uint8_t>(in);
+			if (kind >= Chip8InputLog::K_COUNT || event.key > 0xf
+				|| (!events.empty() && event.cycle < events.back().cycle))
+				throw std::ios_base::failure("Input log is corrupt.");
+			event.kind = static_cast<Chip8InputLog::Kind>(kind);
+			events.push_back(event);
+		}
+
+		log._start = std::move(start);
+		log._events = std::move(events);
+		log._end = end;
+		log._freq = freq;
+		log._platform = static_cast<Chip8::Platform>(platform);
+	}
+	catch (std::ios_base::failure& e)
+	{
+		is.exceptions(prev_state);
+		throw e;
+	}
+	is.exceptions(prev_state);
+	return is;
+}
@@ -0,0 +1,196 @@
+#pragma once
+
+#include "Chip8.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+
+/**
+ * @brief A record of the input a VM received over a session, from which the
+ * session can be replayed exactly, at any speed.
+ *
+ * While recording, the log keeps the VM's state at the start of the session,
+ * followed by every key press and release with the cycle it took effect
+ * before, and every change in the result of a key test with the cycle it was
+ * first seen on. A VM executes the same instructions given the same state,
+ * frequency, platform, and input at each cycle, so a replay fed the logged
+ * input at the logged cycles reproduces the session bit for bit, however its
+ * batches are sized. The frequency and platform must not be changed while
+ * recording, and keys above
+ * 0xF are never held down while recording or replaying.
+ *
+ * A log must only be used with one VM at a time.
+ */
+class Chip8InputLog
+{
+public:
+	/**
+	 * @brief What the log is doing to the VM using it.
+	 */
+	enum class Mode
+	{
+		idle,		// Not in use.
+		recording,	// Recording the input given to the VM.
+		replaying,	// Giving the recorded input to the VM.
+	};
+
+	/**
+	 * @brief Kinds of logged input.
+	 */
+	enum Kind : uint8_t
+	{
+		K_PRESS = 0,	// key_pressed() was called.
+		K_RELEASE,		// key_released() was called.
+		K_UP,			// The key is tested as not held down from now on.
+		K_DOWN,			// The key is tested as held down from now on.
+		K_COUNT
+	};
+
+	/**
+	 * @brief A logged input.
+	 */
+	struct Event
+	{
+		uint64_t	cycle;	// Cycles executed when the input took effect.
+		Kind		kind;	// What happened.
+		uint8_t		key;	// The key it happened to.
+	};
+
+	/**
+	 * @return What the log is currently doing.
+	 */
+	Mode mode();
+
+	/**
+	 * @brief Discards anything recorded and starts recording the input of the
+	 * passed VM from its current state.
+	 *
+	 * @param vm The VM to record. The log replaces any other it was using.
+	 */
+	void start_recording(Chip8& vm);
+
+	/**
+	 * @brief Restores the VM to the state the recording started from and
+	 * starts replaying the recorded input to it. Input from the keyboard
+	 * delegate and key_pressed()/key_released() is ignored for the duration.
+	 *
+	 * @param vm The VM to replay to. The log replaces any other it was using.
+	 * @throws std::invalid_argument if nothing has been recorded, or the
+	 * recorded state is invalid.
+	 */
+	void start_replay(Chip8& vm);
+
+	/**
+	 * @brief Stops recording or replaying, leaving the VM as it is. The end of
+	 * a recording is the VM's current cycle.
+	 *
+	 * @param vm The VM using the log.
+	 */
+	void stop(Chip8& vm);
+
+	/**
+	 * @return The cycle at which the recording stopped, after which a replay
+	 * has no more input to give.
+	 */
+	uint64_t end_cycle();
+
+	/**
+	 * @return The frequency the recorded VM was run at.
+	 */
+	uint32_t frequency();
+
+	/**
+	 * @return The platform the recorded VM was run with.
+	 */
+	Chip8::Platform platform();
+
+	/**
+	 * @return The recorded input, oldest first.
+	 */
+	const std::vector<Event>& events();
+
+	/**
+	 * @brief Stream insertion operator override.
+	 *
+	 * @param os The output stream to write to.
+	 * @param log The log to write, which should not be recording.
+	 * @return std::ostream& The output stream written to.
+	 * @throws std::ios_base::failure if an error occurs while writing.
+	 */
+	friend std::ostream& operator<<(std::ostream& os, Chip8InputLog& log);
+
+	/**
+	 * @brief Stream extraction operator override. The log must be idle.
+	 *
+	 * @param is The input stream to read from.
+	 * @param log The log to overwrite.
+	 * @return std::istream& The input stream read from.
+	 * @throws std::ios_base::failure if the end of the stream is encountered
+	 * early, an error occurs while reading, or the log read is invalid.
+	 */
+	friend std::istream& operator>>(std::istream& is, Chip8InputLog& log);
+
+protected:
+	friend class Chip8;
+
+	// Magic number at the start of every log.
+	static constexpr uint8_t _Magic[4] {'C', 'H', '8', 'I'};
+	// Current log format version.
+	static constexpr uint16_t _Version {3};
+	// Size of the log header, to which version 3 added a 32-bit frequency,
+	// leaving 0 in the 16-bit frequency of the earlier versions.
+	static constexpr size_t _Header_Size {30};
+	// Size of the header of a version 2 log, which added the platform.
+	static constexpr size_t _V2_Header_Size {26};
+	// Size of the header of a version 1 log, which was of the original Chip-8.
+	static constexpr size_t _V1_Header_Size {24};
+	// Size of an event as written.
+	static constexpr size_t _Event_Size {10};
+
+	Mode _mode {Mode::idle};			// What the log is doing.
+	std::vector<std::byte> _start;		// Savestate the recording started at.
+	std::vector<Event> _events;			// Recorded input, oldest first.
+	uint64_t _end {0};					// Cycle the recording stopped at.
+	uint32_t _freq {0};					// Frequency of the recorded VM.
+	// Platform of the recorded VM.
+	Chip8::Platform _platform {Chip8::Platform::chip8};
+	uint16_t _keys {0};					// Bit k is the last test of key k.
+	size_t _next {0};					// Next event to replay.
+
+	/**
+	 * @brief Called by the VM when a key is pressed or released.
+	 *
+	 * @param vm The VM using the log.
+	 * @param pressed Set if the key was pressed, clear if released.
+	 * @param key The key.
+	 * @return true if the VM should act on the input; false if it is being
+	 * replaced by a replay.
+	 */
+	bool record_key(Chip8& vm, bool pressed, uint8_t key);
+
+	/**
+	 * @brief Called by the VM to test if a key is held down.
+	 *
+	 * @param vm The VM using the log.
+	 * @param key The value of the key to test.
+	 * @return true if the key is held down; false otherwise.
+	 */
+	bool test_key(Chip8& vm, uint8_t key);
+
+	/**
+	 * @return The cycle of the next event to be replayed, or UINT64_MAX if
+	 * there is none.
+	 */
+	uint64_t next_cycle();
+
+	/**
+	 * @brief Called by the VM before each cycle to give it any input due by
+	 * then.
+	 *
+	 * @param vm The VM using the log.
+	 */
+	void replay(Chip8& vm);
+};
@@ -0,0 +1,567 @@
+#pragma once
+
+// Definitions of the instruction implementing methods of Chip8, included by the
+// interpreter and by the code Chip8Recompiler generates, so that both inline
+// the same implementations.
+
+#include "Chip8.hpp"
+#include "Chip8BlockCache.hpp"
+#include "Chip8Compiled.hpp"
+#include "Chip8Debugger.hpp"
+#include "Chip8Profiler.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <sstream>
+
+
+constexpr uint8_t Chip8::instr_a(uint16_t instruction)
+{
+	return (instruction & 0xf000U) >> 12;
+}
+
+
+constexpr uint8_t Chip8::instr_b(uint16_t instruction)
+{
+	return (instruction & 0x0f00U) >> 8;
+}
+
+
+constexpr uint8_t Chip8::instr_c(uint16_t instruction)
+{
+	return (instruction & 0x00f0U) >> 4;
+}
+
+
+constexpr uint8_t Chip8::instr_d(uint16_t instruction)
+{
+	return instruction & 0x000fU;
+}
+
+
+constexpr uint16_t Chip8::instr_addr(uint16_t instruction)
+{
+	return instruction & 0x0fffU;
+}
+
+
+constexpr uint8_t Chip8::instr_imm(uint16_t instruction)
+{
+	return instruction & 0x00ffU;
+}
+
+
+template <typename Base>
+void Chip8::_Debug<Base>::read(Chip8& vm, uint32_t addr, uint32_t len)
+{
+	vm._debugger->access(addr, len, false);
+}
+
+
+template <typename Base>
+void Chip8::_Debug<Base>::write(Chip8& vm, uint32_t addr, uint32_t len)
+{
+	vm._debugger->access(addr, len, true);
+}
+
+
+inline void Chip8::mark_written(uint32_t addr, uint32_t len)
+{
+	_written_pages |= 1 << (addr >> 8 & 0xf)
+		| 1 << ((addr + len - 1) >> 8 & 0xf);
+}
+
+
+// Instruction Implementing Methods ============================================
+inline void Chip8::in_invalid(Chip8& vm, uint16_t instr)
+{
+	std::stringstream msg;
+	msg << "Invalid Chip-8 instruction: "
+		<< std::uppercase << std::hex << instr;
+	throw Chip8Error(msg.str());
+}
+
+
+inline void Chip8::in_sys(Chip8& vm, uint16_t instr) // 0NNN
+{
+	// Originally called machine code instruction, does nothing here.
+}
+
+
+inline void Chip8::in_clr(Chip8& vm, uint16_t instr) // 00E0
+{
+	vm._screen.clear(vm._plane_mask);
+	vm._dirty_rows = UINT64_MAX;
+	vm._display->mark();
+#ifdef CHIP8_INSTRUMENT
+	++vm._stats.marks;
+#endif
+}
+
+
+inline void Chip8::in_scd(Chip8& vm, uint16_t instr) // 00CN
+{
+	vm._screen.scroll_down(vm._plane_mask, instr_d(instr));
+	vm._dirty_rows = UINT64_MAX;
+	vm._display->mark();
+#ifdef CHIP8_INSTRUMENT
+	++vm._stats.marks;
+#endif
+}
+
+
+inline void Chip8::in_scu(Chip8& vm, uint16_t instr) // 00DN
+{
+	vm._screen.scroll_up(vm._plane_mask, instr_d(instr));
+	vm._dirty_rows = UINT64_MAX;
+	vm._display->mark();
+#ifdef CHIP8_INSTRUMENT
+	++vm._stats.marks;
+#endif
+}
+
+
+inline void Chip8::in_scr(Chip8& vm, uint16_t instr) // 00FB
+{
+	vm._screen.scroll_right(vm._plane_mask);
+	vm._dirty_rows = UINT64_MAX;
+	vm._display->mark();
+#ifdef CHIP8_INSTRUMENT
+	++vm._stats.marks;
+#endif
+}
+
+
+inline void Chip8::in_scl(Chip8& vm, uint16_t instr) // 00FC
+{
+	vm._screen.scroll_left(vm._plane_mask);
+	vm._dirty_rows = UINT64_MAX;
+	vm._display->mark();
+#ifdef CHIP8_INSTRUMENT
+	++vm._stats.marks;
+#endif
+}
+
+
+inline void Chip8::in_low(Chip8& vm, uint16_t instr) // 00FE
+{
+	vm._screen = Chip8Screen();
+	vm._dirty_rows = UINT64_MAX;
+	vm._display->mark();
+#ifdef CHIP8_INSTRUMENT
+	++vm._stats.marks;
+#endif
+}
+
+
+inline void Chip8::in_high(Chip8& vm, uint16_t instr) // 00FF
+{
+	vm._screen = Chip8Screen();
+	vm._screen.hires = true;
+	vm._dirty_rows = UINT64_MAX;
+	vm._display->mark();
+#ifdef CHIP8_INSTRUMENT
+	++vm._stats.marks;
+#endif
+}
+
+
+template <typename Policy>
+void Chip8::in_rts(Chip8& vm, uint16_t instr) // 00EE
+{
+	if (vm._sp <= 1) throw Chip8Error("VM call stack underflow.");
+	vm._sp -= 2;
+	vm._pc = static_cast<uint16_t>(vm._mem[Policy::addr(vm._sp)] << 8
+		| vm._mem[Policy::addr(vm._sp + 1)]);
+	if (vm._profiler) vm._profiler->ret(vm._pc);
+}
+
+
+inline void Chip8::in_jump(Chip8& vm, uint16_t instr) // 1NNN
+{
+	// Jumping back 2 instructions may close a loop polling the delay timer.
+	vm._loop_hint = instr_addr(instr) == vm._pc - 4;
+	vm._pc = instr_addr(instr);
+}
+
+
+template <typename Policy>
+void Chip8::in_call(Chip8& vm, uint16_t instr) // 2NNN
+{
+	if (vm._sp >= _font_off - 1) throw Chip8Error("VM call stack overflow.");
+	if (vm._profiler) vm._profiler->call(vm._pc, instr_addr(instr));
+	vm._mem[Policy::addr(vm._sp)] = static_cast<uint8_t>(vm._pc >> 8);
+	vm._mem[Policy::addr(vm._sp + 1)] = static_cast<uint8_t>(vm._pc);
+	vm._sp += 2;
+	vm._pc = instr_addr(instr);
+}
+
+
+inline void Chip8::in_ske(Chip8& vm, uint16_t instr) // 3XNN
+{
+	if (vm._gprf[instr_b(instr)] == instr_imm(instr)) vm._pc += 2;
+}
+
+
+inline void Chip8::in_skne(Chip8& vm, uint16_t instr) // 4XNN
+{
+	if (vm._gprf[instr_b(instr)] != instr_imm(instr)) vm._pc += 2;
+}
+
+
+inline void Chip8::in_skre(Chip8& vm, uint16_t instr) // 5XY0
+{
+	if (vm._gprf[instr_b(instr)] == vm._gprf[instr_c(instr)]) vm._pc += 2;
+}
+
+
+inline void Chip8::in_load(Chip8& vm, uint16_t instr) // 6XNN
+{
+	vm._gprf[instr_b(instr)] = instr_imm(instr);
+}
+
+
+inline void Chip8::in_add(Chip8& vm, uint16_t instr) // 7XNN
+{
+	vm._gprf[instr_b(instr)] += instr_imm(instr);
+}
+
+
+inline void Chip8::in_move(Chip8& vm, uint16_t instr)
+{ // 8XY0
+	vm._gprf[instr_b(instr)] = vm._gprf[instr_c(instr)];
+}
+
+
+template <Chip8::Platform P>
+void Chip8::in_or(Chip8& vm, uint16_t instr) // 8XY1
+{
+	vm._gprf[instr_b(instr)]
+		= vm._gprf[instr_b(instr)] | vm._gprf[instr_c(instr)];
+	if constexpr (quirks(P).vf_reset) vm._gprf[0xf] = 0x00;
+}
+
+
+template <Chip8::Platform P>
+void Chip8::in_and(Chip8& vm, uint16_t instr) // 8XY2
+{
+	vm._gprf[instr_b(instr)]
+		= vm._gprf[instr_b(instr)] & vm._gprf[instr_c(instr)];
+	if constexpr (quirks(P).vf_reset) vm._gprf[0xf] = 0x00;
+}
+
+
+template <Chip8::Platform P>
+void Chip8::in_xor(Chip8& vm, uint16_t instr) // 8XY3
+{
+	vm._gprf[instr_b(instr)]
+		= vm._gprf[instr_b(instr)] ^ vm._gprf[instr_c(instr)];
+	if constexpr (quirks(P).vf_reset) vm._gprf[0xf] = 0x00;
+}
+
+
+inline void Chip8::in_addr(Chip8& vm, uint16_t instr) // 8XY4
+{
+	uint8_t b {vm._gprf[instr_b(instr)]};
+	uint8_t c {vm._gprf[instr_c(instr)]};
+	uint8_t sum {static_cast<uint8_t>(b + c)};
+	vm._gprf[instr_b(instr)] = sum;
+
+	if (sum < b) vm._gprf[0xf] = 0x01;
+	else vm._gprf[0xf] = 0x00;
+}
+
+
+inline void Chip8::in_sub(Chip8& vm, uint16_t instr) // 8XY5
+{
+	uint8_t b {vm._gprf[instr_b(instr)]};
+	uint8_t c {vm._gprf[instr_c(instr)]};
+	uint8_t difference {static_cast<uint8_t>(b - c)};
+	vm._gprf[instr_b(instr)] = difference;
+
+	if (difference > b) vm._gprf[0xf] = 0x00;
+	else vm._gprf[0xf] = 0x01;
+}
+
+
+template <Chip8::Platform P>
+void Chip8::in_shr(Chip8& vm, uint16_t instr) // 8XY6
+{
+	uint8_t op {vm._gprf[quirks(P).shift_vy ? instr_c(instr) : instr_b(instr)]};
+	vm._gprf[instr_b(instr)] = op >> 1;
+	vm._gprf[0xf] = op & 0x01;
+}
+
+
+inline void Chip8::in_suba(Chip8& vm, uint16_t instr) // 8XY7
+{
+	uint8_t b {vm._gprf[instr_b(instr)]};
+	uint8_t c {vm._gprf[instr_c(instr)]};
+	uint8_t difference {static_cast<uint8_t>(c - b)};
+	vm._gprf[instr_b(instr)] = difference;
+
+	if (difference > c) vm._gprf[0xf] = 0x00;
+	else vm._gprf[0xf] = 0x01;
+}
+
+
+template <Chip8::Platform P>
+void Chip8::in_shl(Chip8& vm, uint16_t instr) // 8XYE
+{
+	uint8_t op {vm._gprf[quirks(P).shift_vy ? instr_c(instr) : instr_b(instr)]};
+	vm._gprf[instr_b(instr)] = op << 1;
+	vm._gprf[0xf] = (op & 0x80) >> 7;
+}
+
+
+inline void Chip8::in_skrne(Chip8& vm, uint16_t instr)
+{ // 9XY0
+	if (vm._gprf[instr_b(instr)] != vm._gprf[instr_c(instr)]) vm._pc += 2;
+}
+
+
+inline void Chip8::in_loadi(Chip8& vm, uint16_t instr) // ANNN
+{
+	vm._index = instr_addr(instr);
+}
+
+
+template <Chip8::Platform P>
+void Chip8::in_jumpi(Chip8& vm, uint16_t instr) // BNNN
+{
+	vm._pc = vm._gprf[quirks(P).jump_vx ? instr_b(instr) : 0x0]
+		+ instr_addr(instr);
+}
+
+
+inline void Chip8::in_rand(Chip8& vm, uint16_t instr) // CXNN
+{
+	vm._gprf[instr_b(instr)] = next_random(vm._rng) & instr_imm(instr);
+}
+
+
+template <typename Policy, Chip8::Platform P>
+void Chip8::in_draw(Chip8& vm, uint16_t instr) // DXYN
+{
+	// Only draw just after a "screen refresh" (prevented V-tearing originally).
+	if constexpr (quirks(P).display_wait)
+	{
+		if (!vm._can_draw)
+		{
+#ifdef CHIP8_INSTRUMENT
+			++vm._stats.draw_stalls;
+#endif
+			vm._pc -= 2;
+			return;
+		}
+	}
+
+	// Anything the original Chip-8 couldn't draw goes the long way round.
+	if constexpr (quirks(P).hires)
+	{
+		if (vm._screen.hires || vm._plane_mask != 1 || instr_d(instr) == 0)
+		{
+			draw_wide<Policy>(vm, instr);
+			return;
+		}
+	}
+
+	vm._gprf[0xf] = 0x00; // Assume no overwrite for now.
+	// Grab the sprite coordinates, number of lines to draw, and the x shift.
+	uint8_t xpos { vm._gprf[instr_b(instr)] % 64U };
+ 	uint8_t ypos { vm._gprf[instr_c(instr)] % 32U };
+	int y_max { std::min(static_cast<int>(instr_d(instr)), 32 - ypos) };
+	int x_shift {56 - xpos};
+	Policy::read(vm, Policy::wrap(vm._index), y_max);
+	// Mark the rows covered by the sprite as changed.
+	vm._dirty_rows |= ((1ULL << y_max) - 1) << ypos;
+
+	// Iterate over each line of the sprite.
+	for (uint8_t y {0}; y < y_max; ++y)
+	{
+		// Grab the row from the sprite.
+		uint64_t spr_line {vm._mem[Policy::addr(vm._index + y)]};
+		// Shift the sprite row left or right.
+		if (x_shift >= 0) spr_line = spr_line << x_shift;
+		else spr_line = spr_line >> (-1 * x_shift);
+		// Determine the new screen line.
+		// The rows are clipped to the screen above, so need no checks.
+		uint64_t& row {vm._screen.plane[0].left[ypos + y]};
+		uint64_t new_line {row ^ spr_line};
+		// Set the flag if an overrite happened.
+		if (row & spr_line) vm._gprf[0xf] = 0x01;
+		// Update the screen memory with the new line.
+		row = new_line;
+	}
+	vm._display->mark();
+#ifdef CHIP8_INSTRUMENT
+	++vm._stats.marks;
+#endif
+}
+
+
+template <typename Policy>
+void Chip8::draw_wide(Chip8& vm, uint16_t instr)
+{
+	// DXY0 is a 16x16 sprite of two bytes a row.
+	bool wide {instr_d(instr) == 0};
+	unsigned rows {wide ? 16U : instr_d(instr)};
+	unsigned size {rows * (wide ? 2U : 1U)
+		* static_cast<unsigned>(std::popcount(vm._plane_mask))};
+	// Gather the sprite data for every plane, wherever memory wraps.
+	uint8_t sprite[2 * 16 * Chip8Screen::planes];
+	Policy::read(vm, Policy::wrap(vm._index), size);
+	for (unsigned i {0}; i < size; ++i)
+		sprite[i] = vm._mem[Policy::addr(vm._index + i)];
+
+	unsigned height {vm._screen.height()};
+	unsigned ypos {vm._gprf[instr_c(instr)] % height};
+	unsigned y_max {std::min(rows, height - ypos)};
+	vm._gprf[0xf] = vm._screen.draw(vm._plane_mask, vm._gprf[instr_b(instr)],
+		ypos, sprite, rows, wide) ? 0x01 : 0x00;
+	// Sprites are at most 16 rows, so the shift never overflows.
+	vm._dirty_rows |= ((1ULL << y_max) - 1) << ypos;
+	vm._display->mark();
+#ifdef CHIP8_INSTRUMENT
+	++vm._stats.marks;
+#endif
+}
+
+
+inline void Chip8::in_skpr(Chip8& vm, uint16_t instr) // EX9E
+{
+	if (vm.test_key(vm._gprf[instr_b(instr)])) vm._pc += 2;
+}
+
+
+inline void Chip8::in_skup(Chip8& vm, uint16_t instr) // EXA1
+{
+	if (!vm.test_key(vm._gprf[instr_b(instr)])) vm._pc += 2;
+}
+
+
+inline void Chip8::in_moved(Chip8& vm, uint16_t instr) // FX07
+{
+	vm._gprf[instr_b(instr)] = vm._delay;
+}
+
+
+inline void Chip8::in_keyd(Chip8& vm, uint16_t instr) // FX0A
+{
+	vm._key_wait = true;
+}
+
+
+inline void Chip8::in_loadd(Chip8& vm, uint16_t instr) // FX15
+{
+	vm._delay = vm._gprf[instr_b(instr)];
+}
+
+
+inline void Chip8::in_loads(Chip8& vm, uint16_t instr) // FX18
+{
+	vm._sound = vm._gprf[instr_b(instr)];
+	vm.update_sound();
+}
+
+
+inline void Chip8::in_addi(Chip8& vm, uint16_t instr) // FX1E
+{
+	vm._index += vm._gprf[instr_b(instr)];
+}
+
+
+inline void Chip8::in_ldspr(Chip8& vm, uint16_t instr) // FX29
+{
+	vm._index = _font_off + vm._gprf[instr_b(instr)] * 5;
+}
+
+
+inline void Chip8::in_ldbig(Chip8& vm, uint16_t instr) // FX30
+{
+	vm._index = _big_font_off + (vm._gprf[instr_b(instr)] & 0xf) * 10;
+}
+
+
+inline void Chip8::in_plane(Chip8& vm, uint16_t instr) // FN01
+{
+	vm._plane_mask = instr_b(instr);
+}
+
+
+// Employs the Double Dabble algorithm.
+template <typename Policy>
+void Chip8::in_bcd(Chip8& vm, uint16_t instr) // FX33
+{
+	static constexpr uint32_t hundreds = 0xf0000U;
+	static constexpr uint32_t tens = 0xf000U;
+	static constexpr uint32_t ones = 0xf00U;
+
+	// Grab the initial value from the register.
+	uint32_t scratch {vm._gprf[instr_b(instr)]};
+
+	for (size_t i {0}; i < 7; ++i)
+	{
+		scratch = scratch << 1; // Shift in each bit of the value.
+		// Add 3 to each digit if greater than 4.
+		if ((scratch & hundreds) > 0x40000)
+			scratch += 0x30000;
+		if ((scratch & tens) > 0x4000)
+			scratch += 0x3000;
+		if ((scratch & ones) > 0x400)
+			scratch += 0x300;
+	}
+	
+	scratch = scratch << 1; // Make the last shift.
+
+	// Store each digit in memory.
+	Policy::write(vm, Policy::wrap(vm._index), 3);
+	vm.mark_written(Policy::wrap(vm._index), 3);
+	if (vm._block_cache)
+		vm._block_cache->invalidate(Policy::wrap(vm._index), 3);
+	if (vm._compiled) vm._compiled->invalidate(Policy::wrap(vm._index), 3);
+	vm._mem[Policy::addr(vm._index)] = (scratch & hundreds) >> 16;
+	vm._mem[Policy::addr(vm._index + 1)] = (scratch & tens) >> 12;
+	vm._mem[Policy::addr(vm._index + 2)] = (scratch & ones) >> 8;
+}
+
+
+template <typename Policy, Chip8::Platform P>
+void Chip8::in_stor(Chip8& vm, uint16_t instr) // FX55
+{
+	// Any bytes wrapped past the end of memory land below the program.
+	Policy::write(vm, Policy::wrap(vm._index), instr_b(instr) + 1);
+	vm.mark_written(Policy::wrap(vm._index), instr_b(instr) + 1);
+	if (vm._block_cache)
+		vm._block_cache->invalidate(Policy::wrap(vm._index),
+			instr_b(instr) + 1);
+	if (vm._compiled)
+		vm._compiled->invalidate(Policy::wrap(vm._index), instr_b(instr) + 1);
+	if constexpr (quirks(P).index_increment == Increment::past)
+		for (uint8_t i {0}; i <= instr_b(instr); ++i)
+			vm._mem[Policy::addr(vm._index ++)] = vm._gprf[i];
+	else
+	{
+		for (uint8_t i {0}; i <= instr_b(instr); ++i)
+			vm._mem[Policy::addr(vm._index + i)] = vm._gprf[i];
+		if constexpr (quirks(P).index_increment == Increment::last)
+			vm._index += instr_b(instr);
+	}
+}
+
+
+template <typename Policy, Chip8::Platform P>
+void Chip8::in_read(Chip8& vm, uint16_t instr) // FX65
+{
+	Policy::read(vm, Policy::wrap(vm._index), instr_b(instr) + 1);
+	if constexpr (quirks(P).index_increment == Increment::past)
+		for (uint8_t i {0}; i <= instr_b(instr); ++i)
+			vm._gprf[i] = vm._mem[Policy::addr(vm._index ++)];
+	else
+	{
+		for (uint8_t i {0}; i <= instr_b(instr); ++i)
+			vm._gprf[i] = vm._mem[Policy::addr(vm._index + i)];
+		if constexpr (quirks(P).index_increment == Increment::last)
+			vm._index += instr_b(instr);
+	}
+}
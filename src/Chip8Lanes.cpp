@@ -0,0 +1,663 @@
+#include "Chip8Lanes.hpp"
+#include "Chip8BlockCache.hpp"
+#include "Chip8Compiled.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+
+
+namespace
+{
+	/**
+	 * @return value where mask is 0xff and old where it is 0x00.
+	 */
+	inline uint8_t blend(uint8_t mask, uint8_t value, uint8_t old)
+	{
+		return (value & mask) | (old & ~mask);
+	}
+
+
+	/**
+	 * @return value where mask is 0xff and old where it is 0x00.
+	 */
+	inline uint16_t blend16(uint8_t mask, uint16_t value, uint16_t old)
+	{
+		uint16_t wide {static_cast<uint16_t>(static_cast<int8_t>(mask))};
+		return (value & wide) | (old & ~wide);
+	}
+}
+
+
+Chip8Lanes::Chip8Lanes(size_t lanes)
+	: _n(lanes), _pc(lanes), _sp(lanes), _index(lanes), _delay(lanes),
+	_sound(lanes), _gprf(lanes * 16), _rng(lanes), _seed(lanes),
+	_sounding(lanes), _crashed(lanes), _key_wait(lanes), _keys(lanes),
+	_pressed_key(lanes), _screen(lanes * 32), _pages(lanes * _Num_Pages),
+	_private(lanes), _errors(lanes), _crash_budget(lanes), _crash_timer(lanes),
+	_crash_can_draw(lanes), _crash_cycle(lanes),
+	_instr(lanes), _pending(lanes), _mask(lanes)
+{
+	load_program("");
+}
+
+
+size_t Chip8Lanes::lanes()
+{
+	return _n;
+}
+
+
+void Chip8Lanes::load_program(const std::string& program)
+{
+	if (program.size() > Chip8::_Max_Prog_Size)
+		throw std::invalid_argument("Program is too large.");
+
+	// Build the memory image shared by every lane.
+	for (_Page& page : _base) page.fill(0);
+	uint8_t* mem {_base[0].data()};
+	memcpy(&mem[Chip8::_font_off], Chip8::_font, sizeof(Chip8::_font));
+	memcpy(&mem[Chip8::_Prog_Start], program.data(), program.size());
+	for (size_t l {0}; l < _n; ++l)
+		for (uint16_t p {0}; p < _Num_Pages; ++p)
+			_pages[l * _Num_Pages + p] = _base[p].data();
+	std::fill(_private.begin(), _private.end(), 0);
+	_pages_used = 0;
+
+	std::fill(_pc.begin(), _pc.end(), Chip8::_Prog_Start);
+	std::fill(_sp.begin(), _sp.end(), 0);
+	std::fill(_index.begin(), _index.end(), 0);
+	std::fill(_delay.begin(), _delay.end(), 0);
+	std::fill(_sound.begin(), _sound.end(), 0);
+	std::fill(_gprf.begin(), _gprf.end(), 0);
+	std::fill(_sounding.begin(), _sounding.end(), 0);
+	std::fill(_crashed.begin(), _crashed.end(), 0);
+	std::fill(_key_wait.begin(), _key_wait.end(), 0);
+	std::fill(_pressed_key.begin(), _pressed_key.end(), _no_key);
+	std::fill(_screen.begin(), _screen.end(), 0);
+	for (std::string& error : _errors) error.clear();
+	for (size_t l {0}; l < _n; ++l) _rng[l] = Chip8::seed_random(_seed[l]);
+	_can_draw = true;
+	_time_budget = 0;
+	_timer = 0;
+	_cycle = 0;
+}
+
+
+void Chip8Lanes::frequency(uint32_t value)
+{
+	if (value == 0 || value > Chip8::max_frequency)
+		throw std::invalid_argument("Invalid frequency.");
+	_time_budget = Chip8::rescale(_time_budget, value, _freq);
+	_timer = Chip8::rescale(_timer, value, _freq);
+	_freq = value;
+}
+
+
+void Chip8Lanes::seed(size_t lane, uint64_t value)
+{
+	_seed.at(lane) = value;
+	_rng[lane] = Chip8::seed_random(value);
+}
+
+
+void Chip8Lanes::execute_batch(Chip8::_TimeType elapsed_time)
+{
+	// Time is converted into cycles as Chip8::execute_batch() does.
+	_time_budget += elapsed_time.count() % Chip8::_billion * _freq;
+	int64_t cycles {elapsed_time.count() / Chip8::_billion * _freq
+		+ _time_budget / Chip8::_billion};
+	_time_budget %= Chip8::_billion;
+
+	for (int64_t i {0}; i < cycles; ++i)
+	{
+		execute_cycle();
+		++_cycle;
+	}
+}
+
+
+void Chip8Lanes::keys(size_t lane, uint16_t mask)
+{
+	_keys.at(lane) = mask;
+}
+
+
+void Chip8Lanes::key_pressed(size_t lane, uint8_t key)
+{
+	if (!_key_wait.at(lane) || _crashed[lane] || key > 0xf) return;
+	uint16_t instr {static_cast<uint16_t>(
+		read(lane, _pc[lane]) << 8 | read(lane, _pc[lane] + 1))};
+	reg((instr & 0x0f00U) >> 8)[lane] = key;
+	_pc[lane] += 2;
+	_pressed_key[lane] = key;
+}
+
+
+void Chip8Lanes::key_released(size_t lane, uint8_t key)
+{
+	if (key != _pressed_key.at(lane)) return;
+	_key_wait[lane] = 0;
+	_pressed_key[lane] = _no_key;
+}
+
+
+bool Chip8Lanes::is_crashed(size_t lane)
+{
+	return _crashed.at(lane);
+}
+
+
+const std::string& Chip8Lanes::error(size_t lane)
+{
+	return _errors.at(lane);
+}
+
+
+void Chip8Lanes::extract(size_t lane, Chip8& vm)
+{
+	if (lane >= _n) throw std::out_of_range("No such lane.");
+
+	vm._pc = _pc[lane];
+	vm._sp = _sp[lane];
+	vm._index = _index[lane];
+	vm._delay = _delay[lane];
+	vm._sound = _sound[lane];
+	vm._sounding = _sounding[lane];
+	vm._crashed = _crashed[lane];
+	vm._programmed = true;
+	vm._key_wait = _key_wait[lane];
+	vm._pressed_key = _pressed_key[lane];
+	vm._freq = _freq;
+	vm._can_draw = _crashed[lane] ? _crash_can_draw[lane] : _can_draw;
+	vm._time_budget = _crashed[lane] ? _crash_budget[lane] : _time_budget;
+	vm._timer = _crashed[lane] ? _crash_timer[lane] : _timer;
+	vm._rng = _rng[lane];
+	vm._seed = _seed[lane];
+	vm._cycle = _crashed[lane] ? _crash_cycle[lane] : _cycle;
+	for (uint8_t x {0}; x < 16; ++x) vm._gprf[x] = reg(x)[lane];
+	for (uint16_t p {0}; p < _Num_Pages; ++p)
+		memcpy(&vm._mem[p * _Page_Size], _pages[lane * _Num_Pages + p],
+			_Page_Size);
+	vm._written_pages = UINT16_MAX;
+	vm._screen = Chip8Screen();
+	memcpy(vm._screen.plane[0].left.data(), &_screen[lane * 32],
+		32 * sizeof(uint64_t));
+	vm._plane_mask = 1;
+	if (vm._block_cache) vm._block_cache->clear();
+	if (vm._compiled) vm._compiled->attach(vm);
+	vm._dirty_rows = UINT64_MAX;
+	vm.publish_screen();
+}
+
+
+void Chip8Lanes::execute_cycle()
+{
+	// Keep track of elapsed time to update the timers.
+	_timer += Chip8::_timer_freq;
+	const size_t count {_n};
+	uint16_t* pc {_pc.data()};
+	uint16_t* instr {_instr.data()};
+	uint8_t* crashed {_crashed.data()};
+	uint8_t* pending {_pending.data()};
+	uint8_t* m {_mask.data()};
+	if (_timer >= _freq)
+	{
+		uint8_t pulses {static_cast<uint8_t>(_timer / _freq)};
+		_timer %= _freq;
+		uint8_t* delay {_delay.data()};
+		uint8_t* sound {_sound.data()};
+		for (size_t l {0}; l < count; ++l)
+		{
+			uint8_t live {static_cast<uint8_t>(~crashed[l])};
+			uint8_t delay_on {static_cast<uint8_t>(delay[l] != 0 ? live : 0)};
+			uint8_t sound_on {static_cast<uint8_t>(sound[l] != 0 ? live : 0)};
+			delay[l] = blend(delay_on, delay[l] - pulses, delay[l]);
+			sound[l] = blend(sound_on, sound[l] - pulses, sound[l]);
+		}
+		_can_draw = true;
+	}
+	else _can_draw = false;
+
+	// Find the lanes that are able to run, and whether any will crash.
+	const uint8_t* key_wait {_key_wait.data()};
+	uint8_t out_of_range {0};
+	for (size_t l {0}; l < count; ++l)
+	{
+		pending[l] = ~(crashed[l] | key_wait[l]);
+		uint8_t bad {static_cast<uint8_t>(
+			(pc[l] < Chip8::_Prog_Start) | (pc[l] >= 4095))};
+		out_of_range |= pending[l] & -bad;
+	}
+	if (out_of_range)
+		for (size_t l {0}; l < count; ++l)
+		{
+			if (!pending[l]) continue;
+			if (pc[l] < Chip8::_Prog_Start || pc[l] > 4096)
+				crash(l, "PC is outside of the program range.");
+			else if (pc[l] >= 4095)
+				crash(l, "Invalid Chip-8 VM memory location.");
+			else continue;
+			pending[l] = 0;
+		}
+
+	// Fetch the next instruction of every lane that is able to run.
+	for (size_t l {0}; l < count; ++l)
+		if (pending[l]) instr[l] = read(l, pc[l]) << 8 | read(l, pc[l] + 1);
+
+	// Execute each distinct (PC, instruction) pair across its lanes.
+	for (size_t lead {0}; lead < count; ++lead)
+	{
+		if (!pending[lead]) continue;
+		uint16_t group_pc {pc[lead]};
+		uint16_t group_instr {instr[lead]};
+		for (size_t l {lead}; l < count; ++l)
+		{
+			uint8_t same {static_cast<uint8_t>(
+				(pc[l] == group_pc) & (instr[l] == group_instr))};
+			m[l] = pending[l] & -same;
+			pending[l] &= ~m[l];
+		}
+		std::fill(m, m + lead, 0);
+		execute_group(group_instr);
+	}
+
+	// Once ticked, the sound of every lane still running reflects its timer.
+	if (_can_draw)
+	{
+		const uint8_t* sound {_sound.data()};
+		uint8_t* sounding {_sounding.data()};
+		for (size_t l {0}; l < count; ++l)
+		{
+			uint8_t threshold {static_cast<uint8_t>(sounding[l] ? 1 : 2)};
+			uint8_t on {static_cast<uint8_t>(
+				sound[l] >= threshold ? 0xff : 0x00)};
+			sounding[l] = blend(static_cast<uint8_t>(~crashed[l]), on,
+				sounding[l]);
+		}
+	}
+}
+
+
+void Chip8Lanes::execute_group(uint16_t instr)
+{
+	uint8_t x {static_cast<uint8_t>((instr & 0x0f00U) >> 8)};
+	uint8_t y {static_cast<uint8_t>((instr & 0x00f0U) >> 4)};
+	uint8_t n {static_cast<uint8_t>(instr & 0x000fU)};
+	uint8_t imm {static_cast<uint8_t>(instr & 0x00ffU)};
+	uint16_t addr {static_cast<uint16_t>(instr & 0x0fffU)};
+	uint8_t* vx {reg(x)};
+	uint8_t* vy {reg(y)};
+	uint8_t* vf {reg(0xf)};
+	uint8_t* m {_mask.data()};
+	// Copied out of the members, as the compiler would otherwise have to
+	// assume that the stores through the uint8_t pointers modify them.
+	const size_t count {_n};
+	uint16_t* pc {_pc.data()};
+	uint16_t* sp {_sp.data()};
+	uint16_t* index {_index.data()};
+	uint8_t* delay {_delay.data()};
+	uint8_t* sound {_sound.data()};
+	uint8_t* sounding {_sounding.data()};
+	uint8_t* key_wait {_key_wait.data()};
+	const uint16_t* keys {_keys.data()};
+	uint8_t handler {Chip8::_DECODE_TABLE[instr]};
+	bool advance {true};
+
+	switch (handler)
+	{
+		case Chip8::H_CLR: // 00E0
+			for (size_t l {0}; l < count; ++l)
+				if (m[l]) std::fill_n(&_screen[l * 32], 32, 0);
+			break;
+
+		case Chip8::H_RTS: // 00EE
+			for (size_t l {0}; l < count; ++l)
+			{
+				if (!m[l]) continue;
+				if (sp[l] <= 1)
+				{
+					crash(l, "VM call stack underflow.");
+					continue;
+				}
+				sp[l] -= 2;
+				pc[l] = read(l, sp[l]) << 8 | read(l, sp[l] + 1);
+			}
+			break;
+
+		case Chip8::H_JUMP: // 1NNN
+			for (size_t l {0}; l < count; ++l)
+				pc[l] = blend16(m[l], addr, pc[l]);
+			advance = false;
+			break;
+
+		case Chip8::H_CALL: // 2NNN
+			for (size_t l {0}; l < count; ++l)
+			{
+				if (!m[l]) continue;
+				if (sp[l] >= Chip8::_font_off - 1)
+				{
+					crash(l, "VM call stack overflow.");
+					continue;
+				}
+				write(l, sp[l], static_cast<uint8_t>(pc[l] >> 8));
+				write(l, sp[l] + 1, static_cast<uint8_t>(pc[l] & 0xffU));
+				sp[l] += 2;
+				pc[l] = addr;
+			}
+			advance = false;
+			break;
+
+		case Chip8::H_SKE: // 3XNN
+			for (size_t l {0}; l < count; ++l)
+				pc[l] += 2 & -(m[l] & (vx[l] == imm));
+			break;
+
+		case Chip8::H_SKNE: // 4XNN
+			for (size_t l {0}; l < count; ++l)
+				pc[l] += 2 & -(m[l] & (vx[l] != imm));
+			break;
+
+		case Chip8::H_SKRE: // 5XY0
+			for (size_t l {0}; l < count; ++l)
+				pc[l] += 2 & -(m[l] & (vx[l] == vy[l]));
+			break;
+
+		case Chip8::H_LOAD: // 6XNN
+			for (size_t l {0}; l < count; ++l) vx[l] = blend(m[l], imm, vx[l]);
+			break;
+
+		case Chip8::H_ADD: // 7XNN
+			for (size_t l {0}; l < count; ++l)
+				vx[l] = blend(m[l], vx[l] + imm, vx[l]);
+			break;
+
+		case Chip8::H_MOVE: // 8XY0
+			for (size_t l {0}; l < count; ++l)
+				vx[l] = blend(m[l], vy[l], vx[l]);
+			break;
+
+		case Chip8::H_OR: // 8XY1
+			for (size_t l {0}; l < count; ++l)
+			{
+				vx[l] = blend(m[l], vx[l] | vy[l], vx[l]);
+				vf[l] = blend(m[l], 0x00, vf[l]);
+			}
+			break;
+
+		case Chip8::H_AND: // 8XY2
+			for (size_t l {0}; l < count; ++l)
+			{
+				vx[l] = blend(m[l], vx[l] & vy[l], vx[l]);
+				vf[l] = blend(m[l], 0x00, vf[l]);
+			}
+			break;
+
+		case Chip8::H_XOR: // 8XY3
+			for (size_t l {0}; l < count; ++l)
+			{
+				vx[l] = blend(m[l], vx[l] ^ vy[l], vx[l]);
+				vf[l] = blend(m[l], 0x00, vf[l]);
+			}
+			break;
+
+		case Chip8::H_ADDR: // 8XY4
+			for (size_t l {0}; l < count; ++l)
+			{
+				uint8_t b {vx[l]};
+				uint8_t sum {static_cast<uint8_t>(b + vy[l])};
+				vx[l] = blend(m[l], sum, b);
+				vf[l] = blend(m[l], sum < b, vf[l]);
+			}
+			break;
+
+		case Chip8::H_SUB: // 8XY5
+			for (size_t l {0}; l < count; ++l)
+			{
+				uint8_t b {vx[l]};
+				uint8_t difference {static_cast<uint8_t>(b - vy[l])};
+				vx[l] = blend(m[l], difference, b);
+				vf[l] = blend(m[l], difference <= b, vf[l]);
+			}
+			break;
+
+		case Chip8::H_SHR: // 8XY6
+			for (size_t l {0}; l < count; ++l)
+			{
+				uint8_t opY {vy[l]};
+				vx[l] = blend(m[l], opY >> 1, vx[l]);
+				vf[l] = blend(m[l], opY & 0x01, vf[l]);
+			}
+			break;
+
+		case Chip8::H_SUBA: // 8XY7
+			for (size_t l {0}; l < count; ++l)
+			{
+				uint8_t b {vx[l]};
+				uint8_t c {vy[l]};
+				uint8_t difference {static_cast<uint8_t>(c - b)};
+				vx[l] = blend(m[l], difference, b);
+				vf[l] = blend(m[l], difference <= c, vf[l]);
+			}
+			break;
+
+		case Chip8::H_SHL: // 8XYE
+			for (size_t l {0}; l < count; ++l)
+			{
+				uint8_t opY {vy[l]};
+				vx[l] = blend(m[l], opY << 1, vx[l]);
+				vf[l] = blend(m[l], (opY & 0x80) >> 7, vf[l]);
+			}
+			break;
+
+		case Chip8::H_SKRNE: // 9XY0
+			for (size_t l {0}; l < count; ++l)
+				pc[l] += 2 & -(m[l] & (vx[l] != vy[l]));
+			break;
+
+		case Chip8::H_LOADI: // ANNN
+			for (size_t l {0}; l < count; ++l)
+				index[l] = blend16(m[l], addr, index[l]);
+			break;
+
+		case Chip8::H_JUMPI: // BNNN
+			for (size_t l {0}; l < count; ++l)
+				pc[l] = blend16(m[l], reg(0x0)[l] + addr, pc[l]);
+			advance = false;
+			break;
+
+		case Chip8::H_RAND: // CXNN
+			for (size_t l {0}; l < count; ++l)
+				if (m[l]) vx[l] = Chip8::next_random(_rng[l]) & imm;
+			break;
+
+		case Chip8::H_DRAW: // DXYN
+			// Only draw just after a "screen refresh".
+			if (!_can_draw)
+			{
+				for (size_t l {0}; l < count; ++l) pc[l] -= 2 & -(m[l] & 1);
+				break;
+			}
+			for (size_t l {0}; l < count; ++l)
+			{
+				if (!m[l]) continue;
+				vf[l] = 0x00;
+				uint8_t xpos {static_cast<uint8_t>(vx[l] % 64U)};
+				uint8_t ypos {static_cast<uint8_t>(vy[l] % 32U)};
+				int y_max {std::min(static_cast<int>(n), 32 - ypos)};
+				int x_shift {56 - xpos};
+				uint64_t* screen {&_screen[l * 32]};
+				for (uint8_t row {0}; row < y_max; ++row)
+				{
+					uint32_t src {static_cast<uint32_t>(index[l] + row)};
+					if (src >= 4096)
+					{
+						crash(l, "Memory access violation: "
+							"Invalid Chip-8 VM memory location.");
+						break;
+					}
+					uint64_t spr_line {read(l, src)};
+					if (x_shift >= 0) spr_line = spr_line << x_shift;
+					else spr_line = spr_line >> (-1 * x_shift);
+					if (screen[ypos + row] & spr_line) vf[l] = 0x01;
+					screen[ypos + row] ^= spr_line;
+				}
+			}
+			break;
+
+		case Chip8::H_SKPR: // EX9E
+			for (size_t l {0}; l < count; ++l)
+			{
+				bool pressed {vx[l] <= 0xf && (keys[l] >> vx[l] & 1)};
+				pc[l] += 2 & -(m[l] & pressed);
+			}
+			break;
+
+		case Chip8::H_SKUP: // EXA1
+			for (size_t l {0}; l < count; ++l)
+			{
+				bool pressed {vx[l] <= 0xf && (keys[l] >> vx[l] & 1)};
+				pc[l] += 2 & -(m[l] & !pressed);
+			}
+			break;
+
+		case Chip8::H_MOVED: // FX07
+			for (size_t l {0}; l < count; ++l)
+				vx[l] = blend(m[l], delay[l], vx[l]);
+			break;
+
+		case Chip8::H_KEYD: // FX0A
+			for (size_t l {0}; l < count; ++l) key_wait[l] |= m[l];
+			advance = false;
+			break;
+
+		case Chip8::H_LOADD: // FX15
+			for (size_t l {0}; l < count; ++l)
+				delay[l] = blend(m[l], vx[l], delay[l]);
+			break;
+
+		case Chip8::H_LOADS: // FX18
+			for (size_t l {0}; l < count; ++l)
+			{
+				sound[l] = blend(m[l], vx[l], sound[l]);
+				uint8_t threshold {static_cast<uint8_t>(sounding[l] ? 1 : 2)};
+				uint8_t on {static_cast<uint8_t>(
+					sound[l] >= threshold ? 0xff : 0x00)};
+				sounding[l] = blend(m[l], on, sounding[l]);
+			}
+			break;
+
+		case Chip8::H_ADDI: // FX1E
+			for (size_t l {0}; l < count; ++l)
+				index[l] = blend16(m[l], index[l] + vx[l], index[l]);
+			break;
+
+		case Chip8::H_LDSPR: // FX29
+			for (size_t l {0}; l < count; ++l)
+				index[l] = blend16(m[l], Chip8::_font_off + vx[l] * 5,
+					index[l]);
+			break;
+
+		case Chip8::H_BCD: // FX33
+			for (size_t l {0}; l < count; ++l)
+			{
+				if (!m[l]) continue;
+				uint8_t value {vx[l]};
+				uint8_t digits[3] {static_cast<uint8_t>(value / 100),
+					static_cast<uint8_t>(value / 10 % 10),
+					static_cast<uint8_t>(value % 10)};
+				for (uint8_t i {0}; i < 3 && m[l]; ++i)
+				{
+					if (index[l] + i >= 4096)
+						crash(l, "Memory access violation: "
+							"Invalid Chip-8 VM memory location.");
+					else write(l, index[l] + i, digits[i]);
+				}
+			}
+			break;
+
+		case Chip8::H_STOR: // FX55
+			for (size_t l {0}; l < count; ++l)
+			{
+				for (uint8_t i {0}; i <= x && m[l]; ++i)
+				{
+					uint16_t dst {index[l]++};
+					if (dst >= 4096)
+						crash(l, "Memory access violation: "
+							"Invalid Chip-8 VM memory location.");
+					else write(l, dst, reg(i)[l]);
+				}
+			}
+			break;
+
+		case Chip8::H_READ: // FX65
+			for (size_t l {0}; l < count; ++l)
+			{
+				for (uint8_t i {0}; i <= x && m[l]; ++i)
+				{
+					uint16_t src {index[l]++};
+					if (src >= 4096)
+						crash(l, "Memory access violation: "
+							"Invalid Chip-8 VM memory location.");
+					else reg(i)[l] = read(l, src);
+				}
+			}
+			break;
+
+		default: // Invalid instructions.
+		{
+			std::stringstream msg;
+			msg << "Invalid Chip-8 instruction: "
+				<< std::uppercase << std::hex << instr;
+			for (size_t l {0}; l < count; ++l) if (m[l]) crash(l, msg.str());
+			break;
+		}
+	}
+
+	if (advance)
+		for (size_t l {0}; l < count; ++l) pc[l] += 2 & -(m[l] & 1);
+}
+
+
+void Chip8Lanes::crash(size_t lane, const std::string& msg)
+{
+	_crashed[lane] = 0xff;
+	_mask[lane] = 0;
+	_errors[lane] = msg;
+	_crash_budget[lane] = _time_budget;
+	_crash_timer[lane] = _timer;
+	_crash_can_draw[lane] = _can_draw;
+	_crash_cycle[lane] = _cycle;
+}
+
+
+uint8_t Chip8Lanes::read(size_t lane, uint16_t addr)
+{
+	return _pages[lane * _Num_Pages + addr / _Page_Size][addr % _Page_Size];
+}
+
+
+void Chip8Lanes::write(size_t lane, uint16_t addr, uint8_t value)
+{
+	uint16_t page {static_cast<uint16_t>(addr / _Page_Size)};
+	uint8_t*& data {_pages[lane * _Num_Pages + page]};
+	if (!(_private[lane] & (1U << page)))
+	{
+		// Copy the shared page into one owned by this lane.
+		if (_pages_used == _page_store.size())
+			_page_store.push_back(std::make_unique<_Page>());
+		_Page& copy {*_page_store[_pages_used++]};
+		memcpy(copy.data(), data, _Page_Size);
+		data = copy.data();
+		_private[lane] |= 1U << page;
+	}
+	data[addr % _Page_Size] = value;
+}
+
+
+uint8_t* Chip8Lanes::reg(uint8_t x)
+{
+	return &_gprf[x * _n];
+}
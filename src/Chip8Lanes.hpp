@@ -0,0 +1,212 @@
+#pragma once
+
+#include "Chip8.hpp"
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+/**
+ * @brief Runs many Chip-8 VMs ("lanes") in lockstep, one instruction across
+ * every lane at a time. Intended for fuzzing and search workloads where every
+ * lane runs the same program with different inputs.
+ *
+ * State is kept as structure-of-arrays: each register, the PC, the index
+ * register, and the timers are contiguous arrays with one element per lane, so
+ * the instruction implementations are branch-free loops over the lanes that
+ * the compiler vectorizes. Lanes whose PCs or instructions diverge (after
+ * skips, branches, or self-modification) are executed as separate groups,
+ * each under a mask of the lanes it applies to. Memory is shared between lanes
+ * in 256-byte pages that are copied the first time a lane writes to them.
+ *
+ * Lanes have no delegates. Keys are held by setting each lane's key mask and
+ * display and sound output is only reflected in the lanes' state. Every lane
+ * runs at the same frequency, and so shares its timer phase and time budget.
+ * extract() produces an ordinary Chip8 state from any lane that matches what
+ * execute_batch() on a single Chip8 with the same seed would produce, except
+ * that keys above 0xF are never pressed rather than being left to the keyboard
+ * delegate.
+ */
+class Chip8Lanes
+{
+public:
+	/**
+	 * @brief Construct a new set of lanes. A program will have to be loaded
+	 * before execute_batch() can be called.
+	 *
+	 * @param lanes The number of VMs to run in lockstep.
+	 */
+	Chip8Lanes(size_t lanes);
+
+	/**
+	 * @return The number of lanes.
+	 */
+	size_t lanes();
+
+	/**
+	 * @brief Loads the passed program into every lane and initializes each to
+	 * run from its start.
+	 *
+	 * @param program The program to be loaded, as for Chip8::load_program().
+	 * @throws std::invalid_argument if the loaded program is too large.
+	 */
+	void load_program(const std::string& program);
+
+	/**
+	 * @brief Set the emulation instruction cycle frequency of every lane.
+	 *
+	 * @param value The new frequency in Hz.
+	 * @throws std::invalid_argument if the frequency is 0 or above
+	 * Chip8::max_frequency.
+	 */
+	void frequency(uint32_t value);
+
+	/**
+	 * @brief Seed the random number generator of a lane, as for
+	 * Chip8::seed(). Every lane has the same seed until it is given another.
+	 *
+	 * @param lane The lane whose generator is being seeded.
+	 * @param value The new seed.
+	 */
+	void seed(size_t lane, uint64_t value);
+
+	/**
+	 * @brief Run every lane for the specified duration. Lanes that crash stop
+	 * executing; the others carry on.
+	 *
+	 * @param elapsed_time The amount of time to run the emulation forward.
+	 */
+	void execute_batch(Chip8::_TimeType elapsed_time);
+
+	/**
+	 * @brief Set which keys are held down for a lane.
+	 *
+	 * @param lane The lane whose keys are being set.
+	 * @param mask Bit k is set if key k is held down.
+	 */
+	void keys(size_t lane, uint16_t mask);
+
+	/**
+	 * @brief Equivalent of Chip8::key_pressed() for the specified lane.
+	 */
+	void key_pressed(size_t lane, uint8_t key);
+
+	/**
+	 * @brief Equivalent of Chip8::key_released() for the specified lane.
+	 */
+	void key_released(size_t lane, uint8_t key);
+
+	/**
+	 * @return true if the specified lane has crashed; false otherwise.
+	 */
+	bool is_crashed(size_t lane);
+
+	/**
+	 * @return The reason the specified lane crashed, or an empty string.
+	 */
+	const std::string& error(size_t lane);
+
+	/**
+	 * @brief Overwrites the state of the passed VM with that of a lane.
+	 *
+	 * @param lane The lane whose state is to be copied.
+	 * @param vm The VM to receive the state.
+	 */
+	void extract(size_t lane, Chip8& vm);
+
+protected:
+	// Size of a page of memory shared between lanes.
+	static constexpr uint16_t _Page_Size {256};
+	// Number of pages of memory in each lane.
+	static constexpr uint16_t _Num_Pages {4096 / _Page_Size};
+	// Invalid key sentinel.
+	static constexpr uint8_t _no_key {0x10};
+
+	typedef std::array<uint8_t, _Page_Size> _Page;
+
+	size_t _n;							// Number of lanes.
+	uint32_t _freq {1200};				// Instruction cycle frequency.
+	bool _can_draw {true};				// Set just after a "screen refresh".
+	int64_t _time_budget {0};			// As Chip8::_time_budget.
+	int64_t _timer {0};					// As Chip8::_timer.
+	uint64_t _cycle {0};				// Cycles executed since loading.
+
+	// Per-lane registers. Each register file entry is stored for all lanes
+	// contiguously, so vX of lane l is _gprf[X * _n + l].
+	std::vector<uint16_t>	_pc;
+	std::vector<uint16_t>	_sp;
+	std::vector<uint16_t>	_index;
+	std::vector<uint8_t>	_delay;
+	std::vector<uint8_t>	_sound;
+	std::vector<uint8_t>	_gprf;
+	std::vector<uint64_t>	_rng;		// Random number generator states.
+	std::vector<uint64_t>	_seed;		// Random number generator seeds.
+	// Per-lane flags, 0x00 or 0xff.
+	std::vector<uint8_t>	_sounding;
+	std::vector<uint8_t>	_crashed;
+	std::vector<uint8_t>	_key_wait;
+	// Per-lane input.
+	std::vector<uint16_t>	_keys;
+	std::vector<uint8_t>	_pressed_key;
+	// Per-lane screen memory; the rows of lane l start at _screen[l * 32].
+	std::vector<uint64_t>	_screen;
+
+	// Memory: the pages of lane l start at _pages[l * _Num_Pages], each of
+	// which points into _base until the lane first writes to it.
+	std::array<_Page, _Num_Pages>		_base;
+	std::vector<uint8_t*>				_pages;
+	std::vector<uint16_t>				_private;	// Mask of copied pages.
+	std::vector<std::unique_ptr<_Page>>	_page_store;	// All copied pages.
+	size_t								_pages_used {0};	// Of _page_store.
+
+	// State of crashed lanes at the point they crashed.
+	std::vector<std::string>		_errors;
+	std::vector<int64_t>			_crash_budget;
+	std::vector<int64_t>			_crash_timer;
+	std::vector<uint8_t>			_crash_can_draw;
+	std::vector<uint64_t>			_crash_cycle;
+
+	// Scratch space for each cycle.
+	std::vector<uint16_t>	_instr;		// Instruction fetched by each lane.
+	std::vector<uint8_t>	_pending;	// Lanes still to execute this cycle.
+	std::vector<uint8_t>	_mask;		// Lanes of the group being executed.
+
+	/**
+	 * @brief Executes the next instruction cycle of every lane.
+	 */
+	void execute_cycle();
+
+	/**
+	 * @brief Executes an instruction for every lane in _mask.
+	 *
+	 * @param instr The instruction, which each lane in _mask fetched.
+	 */
+	void execute_group(uint16_t instr);
+
+	/**
+	 * @brief Marks a lane as crashed and removes it from _mask.
+	 *
+	 * @param lane The lane that crashed.
+	 * @param msg The reason for the crash.
+	 */
+	void crash(size_t lane, const std::string& msg);
+
+	/**
+	 * @return The byte at the address in the lane's memory.
+	 */
+	uint8_t read(size_t lane, uint16_t addr);
+
+	/**
+	 * @brief Stores a byte in a lane's memory, copying its page first if it is
+	 * still shared.
+	 */
+	void write(size_t lane, uint16_t addr, uint8_t value);
+
+	/**
+	 * @return A pointer to register X of lane 0, followed by every other lane.
+	 */
+	uint8_t* reg(uint8_t x);
+};
@@ -0,0 +1,93 @@
+#include "Chip8MappedFile.hpp"
+
+#include <ios>
+
+#ifdef _WIN32
+	#define WIN32_LEAN_AND_MEAN
+	#include <windows.h>
+#else
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+
+#ifdef _WIN32
+Chip8MappedFile::Chip8MappedFile(const std::string& path)
+{
+	HANDLE file {CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ,
+		nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr)};
+	if (file == INVALID_HANDLE_VALUE)
+		throw std::ios_base::failure("Unable to open " + path);
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(file, &size))
+	{
+		CloseHandle(file);
+		throw std::ios_base::failure("Unable to read the size of " + path);
+	}
+	_size = static_cast<size_t>(size.QuadPart);
+
+	// Empty files can't be mapped, but have nothing to map anyway.
+	if (_size != 0)
+	{
+		_mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0,
+			nullptr);
+		if (_mapping)
+			_data = static_cast<const uint8_t*>(
+				MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0));
+	}
+	CloseHandle(file);
+	if (_size != 0 && !_data)
+	{
+		if (_mapping) CloseHandle(_mapping);
+		throw std::ios_base::failure("Unable to map " + path);
+	}
+}
+
+
+Chip8MappedFile::~Chip8MappedFile()
+{
+	if (_data) UnmapViewOfFile(_data);
+	if (_mapping) CloseHandle(_mapping);
+}
+#else
+Chip8MappedFile::Chip8MappedFile(const std::string& path)
+{
+	int fd {open(path.c_str(), O_RDONLY)};
+	if (fd < 0) throw std::ios_base::failure("Unable to open " + path);
+	struct stat info;
+	if (fstat(fd, &info) != 0)
+	{
+		close(fd);
+		throw std::ios_base::failure("Unable to read the size of " + path);
+	}
+	_size = static_cast<size_t>(info.st_size);
+
+	// Empty files can't be mapped, but have nothing to map anyway.
+	if (_size != 0)
+	{
+		void* data {mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0)};
+		if (data == MAP_FAILED)
+		{
+			close(fd);
+			throw std::ios_base::failure("Unable to map " + path);
+		}
+		_data = static_cast<const uint8_t*>(data);
+	}
+	// The mapping holds its own reference to the file.
+	close(fd);
+}
+
+
+Chip8MappedFile::~Chip8MappedFile()
+{
+	if (_data) munmap(const_cast<uint8_t*>(_data), _size);
+}
+#endif
+
+
+std::span<const uint8_t> Chip8MappedFile::bytes() const
+{
+	return {_data, _size};
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+
+
+/**
+ * @brief A file mapped read-only into memory, so that its contents can be
+ * used, such as by Chip8::load_program(), without first being read into a
+ * buffer.
+ */
+class Chip8MappedFile
+{
+public:
+	/**
+	 * @brief Map the whole of a file.
+	 *
+	 * @param path The path of the file.
+	 * @throws std::ios_base::failure if the file can't be opened or mapped.
+	 */
+	Chip8MappedFile(const std::string& path);
+
+	/**
+	 * @brief Unmap the file.
+	 */
+	~Chip8MappedFile();
+
+	Chip8MappedFile(const Chip8MappedFile&) = delete;
+	Chip8MappedFile& operator=(const Chip8MappedFile&) = delete;
+
+	/**
+	 * @return The contents of the file, which remain valid for the lifetime
+	 * of this object.
+	 */
+	std::span<const uint8_t> bytes() const;
+
+protected:
+	const uint8_t* _data {nullptr};	// Start of the mapping.
+	size_t _size {0};				// Size of the file.
+#ifdef _WIN32
+	void* _mapping {nullptr};		// Handle of the file mapping object.
+#endif
+};
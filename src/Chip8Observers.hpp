@@ -8,7 +8,9 @@ class Chip8;
 
 
 /**
- * @brief Delegate to handle keyboard input for the Chip-8 VM.
+ * @brief Delegate to handle keyboard input for the Chip-8 VM. Optional, for
+ * hosts that keep key states of their own: a VM without one tests keys on its
+ * keypad, which costs no virtual call.
  */
 struct Chip8Keyboard
 {
@@ -40,17 +42,30 @@ public:
 	/**
 	 * @brief Called if the VM has updated the display output. The display data
 	 * can be obtained by calling Chip8::get_screen_buf() on the instance being
-	 * observed.
+	 * observed, or from another thread through Chip8::latest_frame() once the
+	 * frame is complete.
 	 */
 	virtual void mark() = 0;
 };
 
 
 /**
- * @brief Delegate to handle sound output for the Chip-8 VM.
+ * @brief Delegate to handle sound output for the Chip-8 VM. Both calls are
+ * only made once the sound timer has ticked or been set, so Chip8::ticks()
+ * tells which frame they land on.
  */
-struct Chip8Sound
+class Chip8Sound
 {
+protected:
+	friend class Chip8;
+
+	/**
+	 * @brief The VM this object will act as sound output for. Will be
+	 * assigned by the VM upon its construction.
+	 */
+	Chip8* _vm;
+
+public:
 	/**
 	 * @brief Called if the VM is to start emitting sound.
 	 */
@@ -0,0 +1,82 @@
+#include "Chip8Pacer.hpp"
+
+#include <stdexcept>
+#include <thread>
+
+
+Chip8Pacer::Mode Chip8Pacer::mode()
+{
+	return _mode;
+}
+
+
+void Chip8Pacer::mode(Mode value)
+{
+	_mode = value;
+}
+
+
+uint16_t Chip8Pacer::factor()
+{
+	return _factor;
+}
+
+
+void Chip8Pacer::factor(uint16_t value)
+{
+	if (value == 0)
+		throw std::invalid_argument("Fast forward factor must be nonzero.");
+	_factor = value;
+}
+
+
+void Chip8Pacer::reset()
+{
+	_scheduled = false;
+}
+
+
+Chip8::_TimeType Chip8Pacer::begin_frame()
+{
+	// Unthrottled frames have no deadline to keep.
+	if (_mode == Mode::unthrottled)
+	{
+		_scheduled = false;
+		return _Frame_Period;
+	}
+
+	Clock::time_point now {Clock::now()};
+	int64_t frames {1};
+	if (!_scheduled)
+	{
+		_deadline = now;
+		_scheduled = true;
+	}
+	else if (now > _deadline)
+	{
+		// Catch up on any whole frames missed, unless too far behind.
+		int64_t missed {(now - _deadline) / _Frame_Period};
+		if (missed > _Max_Lag_Frames) _deadline = now;
+		else frames += missed;
+	}
+	_deadline += _Frame_Period * frames;
+
+	if (_mode == Mode::fast_forward) frames *= _factor;
+	return _Frame_Period * frames;
+}
+
+
+bool Chip8Pacer::end_frame()
+{
+	if (_mode != Mode::unthrottled)
+	{
+		std::this_thread::sleep_until(_deadline);
+		return true;
+	}
+
+	// Only refresh the display at the rate it would be refreshed in real time.
+	Clock::time_point now {Clock::now()};
+	if (now < _present) return false;
+	_present = now + _Frame_Period;
+	return true;
+}
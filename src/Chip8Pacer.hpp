@@ -0,0 +1,100 @@
+#pragma once
+
+#include "Chip8.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+
+/**
+ * @brief Paces the execution of a VM against the wall clock, one display
+ * frame (a sixtieth of a second) at a time.
+ *
+ * Frames are scheduled against absolute deadlines rather than by sleeping for
+ * whatever is left of each frame, so time lost to a late wakeup or a slow
+ * batch is recovered by the following frames instead of accumulating as drift.
+ * If emulation falls too far behind to catch up, such as after being paused,
+ * the schedule restarts from the current time.
+ *
+ * The mode and factor may be changed from any thread. Everything else must be
+ * called from the thread running the VM, as in:
+ *
+ *     vm.execute_batch(pacer.begin_frame());
+ *     if (pacer.end_frame()) refresh_display();
+ */
+class Chip8Pacer
+{
+public:
+	typedef std::chrono::steady_clock Clock;
+
+	/**
+	 * @brief Rates at which emulation can be run.
+	 */
+	enum class Mode
+	{
+		realtime,		// One emulated frame per frame of wall time.
+		fast_forward,	// factor() emulated frames per frame of wall time.
+		unthrottled,	// As many emulated frames as the host can execute.
+	};
+
+	// Duration of a single display frame.
+	static constexpr Chip8::_TimeType _Frame_Period {Chip8::_billion / 60U};
+
+	/**
+	 * @return The current mode.
+	 */
+	Mode mode();
+
+	/**
+	 * @brief Set the pacing mode. Takes effect from the next frame.
+	 *
+	 * @param value The new mode.
+	 */
+	void mode(Mode value);
+
+	/**
+	 * @return The number of emulated frames run per frame in fast_forward.
+	 */
+	uint16_t factor();
+
+	/**
+	 * @brief Set the number of emulated frames run per frame in fast_forward.
+	 *
+	 * @param value The new factor.
+	 * @throws std::invalid_argument if the factor is 0.
+	 */
+	void factor(uint16_t value);
+
+	/**
+	 * @brief Restarts the schedule from the current time, discarding any
+	 * frames that were due to be caught up.
+	 */
+	void reset();
+
+	/**
+	 * @brief Starts a frame, scheduling its deadline.
+	 *
+	 * @return The amount of emulated time to execute over the frame. This
+	 * includes any whole frames missed since the last deadline.
+	 */
+	Chip8::_TimeType begin_frame();
+
+	/**
+	 * @brief Ends a frame, sleeping until its deadline if the mode requires.
+	 *
+	 * @return true if the display should be refreshed, which is at most once
+	 * per frame of wall time; false otherwise.
+	 */
+	bool end_frame();
+
+protected:
+	// Deadlines missed by more than this many frames are not caught up.
+	static constexpr int64_t _Max_Lag_Frames {4};
+
+	std::atomic<Mode> _mode {Mode::realtime};	// Current pacing mode.
+	std::atomic<uint16_t> _factor {2};			// Speed up in fast_forward.
+	bool _scheduled {false};		// Set once _deadline is meaningful.
+	Clock::time_point _deadline;	// When the current frame should end.
+	Clock::time_point _present;		// When the display is next refreshed.
+};
@@ -0,0 +1,96 @@
+// ROM pack tool for the Chip-8 VM: packs ROMs into a single file indexed by
+// the hash of their contents, or lists the ROMs in a pack.
+
+#include "Chip8MappedFile.hpp"
+#include "Chip8RomPack.hpp"
+
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+
+namespace
+{
+	const char* usage
+	{
+		"Usage: chip8-pack PACK ROM...\n"
+		"       chip8-pack --list PACK\n"
+		"Writes the ROMs to PACK, printing the hash each is found by, or\n"
+		"prints the hash and size of every ROM in PACK.\n"
+	};
+
+
+	/**
+	 * @brief Prints a hash as chip8-run --pack expects it.
+	 */
+	void print_hash(std::ostream& os, uint64_t hash)
+	{
+		os << std::hex << std::setw(16) << std::setfill('0') << hash
+			<< std::dec << std::setfill(' ');
+	}
+}
+
+
+int main(int argc, char** argv)
+{
+	if (argc == 2 && std::string(argv[1]) == "--help")
+	{
+		std::cout << usage;
+		return 0;
+	}
+	if (argc < 3 || (std::string(argv[1]) == "--list" && argc != 3))
+	{
+		std::cerr << usage;
+		return 2;
+	}
+
+	if (std::string(argv[1]) == "--list")
+	{
+		try
+		{
+			Chip8RomPack pack(argv[2]);
+			for (size_t i {0}; i < pack.size(); ++i)
+			{
+				print_hash(std::cout, pack.hash(i));
+				std::cout << ' ' << pack.rom(i).size() << '\n';
+			}
+		}
+		catch (std::exception& e)
+		{
+			std::cerr << "Unable to read pack: " << e.what() << '\n';
+			return 1;
+		}
+		return 0;
+	}
+
+	// The ROMs stay mapped until the pack is written.
+	std::vector<std::unique_ptr<Chip8MappedFile>> files;
+	std::vector<std::span<const uint8_t>> roms;
+	for (int i {2}; i < argc; ++i)
+	{
+		try { files.push_back(std::make_unique<Chip8MappedFile>(argv[i])); }
+		catch (std::exception& e)
+		{
+			std::cerr << "Unable to open ROM: " << argv[i] << " ("
+				<< e.what() << ")\n";
+			return 1;
+		}
+		roms.push_back(files.back()->bytes());
+		print_hash(std::cout, Chip8RomPack::hash(roms.back()));
+		std::cout << ' ' << argv[i] << '\n';
+	}
+
+	std::ofstream pack_file(argv[1], std::ofstream::out | std::ofstream::binary);
+	try { Chip8RomPack::write(pack_file, roms); }
+	catch (std::exception& e)
+	{
+		std::cerr << "Failed to write pack: " << e.what() << '\n';
+		return 1;
+	}
+	return 0;
+}
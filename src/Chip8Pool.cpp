@@ -0,0 +1,287 @@
+#include "Chip8Pool.hpp"
+#include "Chip8BlockCache.hpp"
+#include "Chip8Compiled.hpp"
+
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+
+Chip8Pool::Fork::Fork(Chip8Pool* pool, uint32_t state)
+	: _pool(pool), _state(state)
+{}
+
+
+Chip8Pool::Fork::Fork(const Fork& other)
+	: _pool(other._pool), _state(other._state)
+{
+	if (_pool) ++_pool->_states[_state].refs;
+}
+
+
+Chip8Pool::Fork::Fork(Fork&& other) noexcept
+	: _pool(std::exchange(other._pool, nullptr)), _state(other._state)
+{}
+
+
+Chip8Pool::Fork& Chip8Pool::Fork::operator=(Fork other) noexcept
+{
+	std::swap(_pool, other._pool);
+	std::swap(_state, other._state);
+	return *this;
+}
+
+
+Chip8Pool::Fork::~Fork()
+{
+	if (_pool) _pool->release_state(_state);
+}
+
+
+Chip8Pool::Fork::operator bool() const
+{
+	return _pool != nullptr;
+}
+
+
+Chip8Pool::_Slot::_Slot()
+{
+	origin.fill(_No_Page);
+}
+
+
+Chip8Pool::Fork Chip8Pool::fork(Chip8& vm)
+{
+	uint32_t id;
+	if (_free_states.empty())
+	{
+		id = static_cast<uint32_t>(_states.size());
+		_states.emplace_back();
+	}
+	else
+	{
+		id = _free_states.back();
+		_free_states.pop_back();
+	}
+	Fork result {this, id};
+
+	// Pages the VM hasn't written since they were last shared are shared
+	// again, and the rest copied once and shared from then on.
+	_Slot* owner {slot(vm)};
+	std::array<uint32_t, _Num_Pages> pages;
+	for (uint16_t p {0}; p < _Num_Pages; ++p)
+	{
+		const uint8_t* mem {&vm._mem[p * _Page_Size]};
+		if (!owner)
+		{
+			pages[p] = copy_page(mem);
+			continue;
+		}
+		if (owner->origin[p] == _No_Page || vm._written_pages & 1 << p)
+		{
+			release_page(owner->origin[p]);
+			owner->origin[p] = copy_page(mem);
+		}
+		pages[p] = owner->origin[p];
+		++_page_refs[pages[p]];
+	}
+	if (owner) vm._written_pages = 0;
+
+	_State& state {_states[id]};
+	state.refs = 1;
+	state.pages = pages;
+	state.pc = vm._pc;
+	state.sp = vm._sp;
+	state.index = vm._index;
+	state.delay = vm._delay;
+	state.sound = vm._sound;
+	state.sounding = vm._sounding;
+	state.crashed = vm._crashed;
+	state.programmed = vm._programmed;
+	state.can_draw = vm._can_draw;
+	state.key_wait = vm._key_wait;
+	state.loop_hint = vm._loop_hint;
+	state.pressed_key = vm._pressed_key;
+	state.plane_mask = vm._plane_mask;
+	state.time_budget = vm._time_budget;
+	state.timer = vm._timer;
+	state.rng = vm._rng;
+	state.cycle = vm._cycle;
+	state.seed = vm._seed;
+	state.freq = vm._freq;
+	state.platform = vm._platform;
+	state.access = vm._access;
+	state.gprf = vm._gprf;
+	memcpy(state.stack.data(), vm._mem.data(), sizeof(state.stack));
+	state.screen = vm._screen;
+	return result;
+}
+
+
+void Chip8Pool::restore(Chip8& vm, const Fork& fork)
+{
+	if (fork._pool != this)
+		throw std::invalid_argument("The fork isn't one of this pool's.");
+	const _State& state {_states[fork._state]};
+
+	// Only pages that differ from those the VM's memory holds are copied.
+	_Slot* owner {slot(vm)};
+	bool copied {false};
+	for (uint16_t p {0}; p < _Num_Pages; ++p)
+	{
+		uint32_t page {state.pages[p]};
+		if (owner)
+		{
+			if (owner->origin[p] == page && !(vm._written_pages & 1 << p))
+				continue;
+			++_page_refs[page];
+			release_page(owner->origin[p]);
+			owner->origin[p] = page;
+		}
+		memcpy(&vm._mem[p * _Page_Size], _pages[page].data(), _Page_Size);
+		if (vm._block_cache) vm._block_cache->invalidate(p * _Page_Size,
+			_Page_Size);
+		copied = true;
+	}
+	if (owner) vm._written_pages = 0;
+	else vm._written_pages = UINT16_MAX;
+	memcpy(vm._mem.data(), state.stack.data(), sizeof(state.stack));
+
+	vm._pc = state.pc;
+	vm._sp = state.sp;
+	vm._index = state.index;
+	vm._delay = state.delay;
+	vm._sound = state.sound;
+	vm._sounding = state.sounding;
+	vm._crashed = state.crashed;
+	vm._programmed = state.programmed;
+	vm._can_draw = state.can_draw;
+	vm._key_wait = state.key_wait;
+	vm._loop_hint = state.loop_hint;
+	vm._pressed_key = state.pressed_key;
+	vm._plane_mask = state.plane_mask;
+	vm._time_budget = state.time_budget;
+	vm._timer = state.timer;
+	vm._rng = state.rng;
+	vm._cycle = state.cycle;
+	vm._seed = state.seed;
+	vm._freq = state.freq;
+	// Cached blocks hold the instruction implementations of the old policy
+	// and platform.
+	bool retarget {vm._platform != state.platform
+		|| vm._access != state.access};
+	vm._platform = state.platform;
+	vm._access = state.access;
+	vm._gprf = state.gprf;
+	vm._screen = state.screen;
+
+	if (retarget && vm._block_cache) vm._block_cache->clear();
+	if ((copied || retarget) && vm._compiled) vm._compiled->attach(vm);
+	vm._dirty_rows = UINT64_MAX;
+	vm.publish_screen();
+}
+
+
+Chip8& Chip8Pool::acquire()
+{
+	Chip8& vm {lease().vm};
+	vm.frequency(1200);
+	vm.seed(0);
+	vm.platform(Chip8::Platform::chip8);
+	vm.access(Chip8::Access::strict);
+	vm.clear_state();
+	return vm;
+}
+
+
+Chip8& Chip8Pool::acquire(const Fork& fork)
+{
+	if (fork._pool != this)
+		throw std::invalid_argument("The fork isn't one of this pool's.");
+	Chip8& vm {lease().vm};
+	restore(vm, fork);
+	return vm;
+}
+
+
+void Chip8Pool::release(Chip8& vm)
+{
+	_Slot* owner {slot(vm)};
+	if (!owner || !owner->leased)
+		throw std::invalid_argument(
+			"The VM isn't one handed out by this pool.");
+	vm.profiler(nullptr);
+	vm.debugger(nullptr);
+	vm.rewind(nullptr);
+	vm.input_log(nullptr);
+	vm.engine(Chip8::Engine::interpreter);
+	vm.keypad(0);
+	owner->leased = false;
+	// Its pages are kept, so restoring a fork into it again copies few.
+	_idle.push_back(owner);
+}
+
+
+size_t Chip8Pool::pages_used()
+{
+	return _pages.size() - _free_pages.size();
+}
+
+
+Chip8Pool::_Slot& Chip8Pool::lease()
+{
+	if (_idle.empty())
+	{
+		_slots.push_back(std::make_unique<_Slot>());
+		_Slot* created {_slots.back().get()};
+		_slot_of[&created->vm] = created;
+		_idle.push_back(created);
+	}
+	_Slot* owner {_idle.back()};
+	_idle.pop_back();
+	owner->leased = true;
+	return *owner;
+}
+
+
+Chip8Pool::_Slot* Chip8Pool::slot(const Chip8& vm)
+{
+	auto it {_slot_of.find(&vm)};
+	return it == _slot_of.end() ? nullptr : it->second;
+}
+
+
+uint32_t Chip8Pool::copy_page(const uint8_t* mem)
+{
+	uint32_t page;
+	if (_free_pages.empty())
+	{
+		page = static_cast<uint32_t>(_pages.size());
+		_pages.emplace_back();
+		_page_refs.push_back(0);
+	}
+	else
+	{
+		page = _free_pages.back();
+		_free_pages.pop_back();
+	}
+	memcpy(_pages[page].data(), mem, _Page_Size);
+	_page_refs[page] = 1;
+	return page;
+}
+
+
+void Chip8Pool::release_page(uint32_t page)
+{
+	if (page != _No_Page && --_page_refs[page] == 0)
+		_free_pages.push_back(page);
+}
+
+
+void Chip8Pool::release_state(uint32_t state)
+{
+	_State& released {_states[state]};
+	if (--released.refs != 0) return;
+	for (uint32_t page : released.pages) release_page(page);
+	_free_states.push_back(state);
+}
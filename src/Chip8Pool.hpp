@@ -0,0 +1,224 @@
+#pragma once
+
+#include "Chip8.hpp"
+#include "Chip8Headless.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+
+/**
+ * @brief Forks VM states cheaply and keeps VMs to run them in, for search
+ * workloads that explore many branches of a program's input from the same
+ * states.
+ *
+ * A fork records a VM's registers, timers, call stack, and screen, and shares
+ * its memory in pages of 256 bytes with the forks taken before it. Only pages
+ * that FX55 or FX33 (or the host) wrote since the VM was last forked or
+ * restored are copied, so the pages holding the fonts and the program are
+ * never copied again once the first fork of a program is taken. Restoring a
+ * fork into a VM likewise copies only the pages that differ from those its
+ * memory already holds. Both page tracking and reuse only apply to the VMs
+ * handed out by acquire(); any other VM can be forked and restored, but has
+ * all of its memory copied each time.
+ *
+ * Fork states and pages are kept in arenas owned by the pool and reused as
+ * forks are released, and released VMs are kept to be acquired again, so a
+ * pool that has warmed up allocates nothing. A pool must only be used from
+ * one thread at a time, and must outlive its forks and VMs.
+ */
+class Chip8Pool
+{
+public:
+	/**
+	 * @brief A VM state taken by fork(). Copying a fork shares its state,
+	 * which is released when the last copy is destroyed.
+	 */
+	class Fork
+	{
+	public:
+		/**
+		 * @brief Construct an empty fork, which holds no state.
+		 */
+		Fork() = default;
+		Fork(const Fork& other);
+		Fork(Fork&& other) noexcept;
+		Fork& operator=(Fork other) noexcept;
+		~Fork();
+
+		/**
+		 * @return true if the fork holds a state; false if it is empty.
+		 */
+		explicit operator bool() const;
+
+	protected:
+		friend class Chip8Pool;
+
+		/**
+		 * @brief Takes over a reference to a state of a pool.
+		 */
+		Fork(Chip8Pool* pool, uint32_t state);
+
+		Chip8Pool*	_pool {nullptr};	// Pool holding the state, if any.
+		uint32_t	_state {0};			// Index of the state in the pool.
+	};
+
+	Chip8Pool() = default;
+	Chip8Pool(const Chip8Pool&) = delete;
+	Chip8Pool& operator=(const Chip8Pool&) = delete;
+
+	/**
+	 * @brief Records the state of a VM, which must not be executing.
+	 *
+	 * @param vm The VM to fork.
+	 * @return The fork.
+	 */
+	Fork fork(Chip8& vm);
+
+	/**
+	 * @brief Overwrites the state of a VM, which must not be executing, with
+	 * that of a fork, along with the frequency, seed, platform, and memory
+	 * access of the VM it was taken from.
+	 *
+	 * @param vm The VM to overwrite.
+	 * @param fork The fork to restore.
+	 * @throws std::invalid_argument if the fork is empty or of another pool.
+	 */
+	void restore(Chip8& vm, const Fork& fork);
+
+	/**
+	 * @brief Hands out a VM of the pool that has no program loaded and the
+	 * default settings. It has no keyboard delegate, so takes keys from
+	 * key_pressed(), key_released(), and keypad(), and discards its display
+	 * and sound output.
+	 *
+	 * @return The VM, which remains the caller's until it is released.
+	 */
+	Chip8& acquire();
+
+	/**
+	 * @brief Hands out a VM of the pool with a fork restored into it, as for
+	 * acquire() and restore().
+	 *
+	 * @param fork The fork to restore.
+	 * @return The VM, which remains the caller's until it is released.
+	 * @throws std::invalid_argument if the fork is empty or of another pool.
+	 */
+	Chip8& acquire(const Fork& fork);
+
+	/**
+	 * @brief Returns a VM handed out by acquire() to the pool. Its profiler,
+	 * debugger, rewind history, and input log are removed, its engine set
+	 * back to the interpreter, and its keypad cleared.
+	 *
+	 * @param vm The VM.
+	 * @throws std::invalid_argument if the VM wasn't handed out by the pool.
+	 */
+	void release(Chip8& vm);
+
+	/**
+	 * @return The number of pages of memory held by forks and VMs.
+	 */
+	size_t pages_used();
+
+protected:
+	// Size of a page of memory shared between forks.
+	static constexpr uint16_t _Page_Size {Chip8::_State_Page_Size};
+	// Number of pages of memory in a VM.
+	static constexpr uint16_t _Num_Pages {4096 / _Page_Size};
+	// Page index that refers to no page.
+	static constexpr uint32_t _No_Page {UINT32_MAX};
+
+	typedef std::array<uint8_t, _Page_Size> _Page;
+
+	/**
+	 * @brief The state of a VM recorded by a fork.
+	 */
+	struct _State
+	{
+		uint32_t	refs;			// Forks sharing the state, 0 if free.
+		std::array<uint32_t, _Num_Pages> pages;	// Memory, as page indices.
+		uint16_t	pc;
+		uint16_t	sp;
+		uint16_t	index;
+		uint8_t		delay;
+		uint8_t		sound;
+		bool		sounding;
+		bool		crashed;
+		bool		programmed;
+		bool		can_draw;
+		bool		key_wait;
+		bool		loop_hint;
+		uint8_t		pressed_key;
+		uint8_t		plane_mask;
+		int64_t		time_budget;
+		int64_t		timer;
+		uint64_t	rng;
+		uint64_t	cycle;
+		uint64_t	seed;
+		uint32_t	freq;
+		Chip8::Platform	platform;
+		Chip8::Access	access;
+		std::array<uint8_t, 16>	gprf;
+		// Memory below the fonts, which holds the call stack.
+		std::array<uint8_t, Chip8::_font_off>	stack;
+		Chip8Screen	screen;
+	};
+
+	/**
+	 * @brief A VM handed out by acquire(), with the delegates it discards its
+	 * output through.
+	 */
+	struct _Slot
+	{
+		NullDisplay	display;
+		NullSound	sound;
+		Chip8		vm {nullptr, &display, &sound};
+		// The page each page of the VM's memory matches, unless marked in
+		// Chip8::_written_pages. Each holds a reference to the page.
+		std::array<uint32_t, _Num_Pages> origin;
+		bool		leased {false};	// Set while handed out.
+
+		_Slot();
+	};
+
+	std::vector<_State>		_states;		// Arena of fork states.
+	std::vector<uint32_t>	_free_states;	// States with no references.
+	std::vector<_Page>		_pages;			// Arena of pages of memory.
+	std::vector<uint32_t>	_page_refs;		// References held to each page.
+	std::vector<uint32_t>	_free_pages;	// Pages with no references.
+	std::vector<std::unique_ptr<_Slot>>		_slots;	// Every VM of the pool.
+	std::vector<_Slot*>		_idle;			// VMs not handed out.
+	std::unordered_map<const Chip8*, _Slot*>	_slot_of;	// By their VMs.
+
+	/**
+	 * @return An idle slot, created if there are none, marked as handed out.
+	 */
+	_Slot& lease();
+
+	/**
+	 * @return The slot holding a VM, or nullptr if it isn't one of the pool's.
+	 */
+	_Slot* slot(const Chip8& vm);
+
+	/**
+	 * @return The index of a page, with a reference held to it, filled with a
+	 * copy of the page of memory at the address.
+	 */
+	uint32_t copy_page(const uint8_t* mem);
+
+	/**
+	 * @brief Releases a reference to a page, if it is one.
+	 */
+	void release_page(uint32_t page);
+
+	/**
+	 * @brief Releases a reference to a state, along with its pages once it
+	 * has no more.
+	 */
+	void release_state(uint32_t state);
+};
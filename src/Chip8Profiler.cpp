@@ -0,0 +1,157 @@
+#include "Chip8Profiler.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <iterator>
+
+
+namespace
+{
+	/**
+	 * @return The callgrind position of an address.
+	 */
+	std::string position(uint16_t addr)
+	{
+		char text[8];
+		snprintf(text, sizeof(text), "0x%03x", addr);
+		return text;
+	}
+
+
+	/**
+	 * @return The name of the function that starts at an address.
+	 */
+	std::string function(uint16_t addr)
+	{
+		char text[sizeof("sub_ffff")];
+		snprintf(text, sizeof(text), "sub_%03x", addr);
+		return text;
+	}
+}
+
+
+uint64_t Chip8Profiler::samples()
+{
+	return _samples;
+}
+
+
+const std::array<uint64_t, 4096>& Chip8Profiler::hits()
+{
+	return _hits;
+}
+
+
+std::vector<Chip8Profiler::Edge> Chip8Profiler::edges()
+{
+	std::vector<Edge> edges;
+	edges.reserve(_edges.size());
+	for (const auto& [key, calls] : _edges)
+	{
+		Edge edge {static_cast<uint16_t>(key >> 16),
+			static_cast<uint16_t>(key), calls.calls, calls.cycles};
+		// Count calls in progress up to now, by the outermost if recursive.
+		for (size_t i = 0; i < _depth; ++i)
+			if (_stack[i].calls == &calls)
+			{
+				edge.cycles += _samples - _stack[i].start;
+				break;
+			}
+		edges.push_back(edge);
+	}
+	std::sort(edges.begin(), edges.end(), [](const Edge& a, const Edge& b)
+		{ return a.site != b.site ? a.site < b.site : a.target < b.target; });
+	return edges;
+}
+
+
+void Chip8Profiler::reset()
+{
+	_hits.fill(0);
+	_samples = 0;
+	_edges.clear();
+	_depth = 0;
+}
+
+
+void Chip8Profiler::write_callgrind(std::ostream& os,
+	const std::string& program)
+{
+	std::vector<Edge> edges {this->edges()};
+
+	// Every address called starts a function, as does the program.
+	std::vector<uint16_t> starts {Chip8::_Prog_Start};
+	for (const Edge& edge : edges) starts.push_back(edge.target);
+	std::sort(starts.begin(), starts.end());
+	starts.erase(std::unique(starts.begin(), starts.end()), starts.end());
+
+	std::ios_base::iostate prev_state = os.exceptions();
+	os.exceptions(std::istream::failbit);
+	try
+	{
+		os << "# callgrind format\nversion: 1\ncreator: chip-8-cpp\n"
+			<< "positions: instr\nevents: Cycles\nsummary: " << _samples
+			<< "\n\nob=" << program << '\n';
+
+		auto edge {edges.begin()};
+		for (size_t f = 0; f < starts.size(); ++f)
+		{
+			// Addresses before the first function (which can't be executed)
+			// count toward it.
+			size_t begin {f == 0 ? size_t{0} : size_t{starts[f]}};
+			size_t end {f + 1 < starts.size() ? starts[f + 1] : _hits.size()};
+			os << "\nfn=" << function(starts[f]) << '\n';
+			for (size_t addr = begin; addr < end; ++addr)
+			{
+				if (_hits[addr] != 0)
+					os << position(addr) << ' ' << _hits[addr] << '\n';
+				for (; edge != edges.end() && edge->site == addr; ++edge)
+					os << "cfn=" << function(edge->target) << '\n'
+						<< "calls=" << edge->calls << ' '
+						<< position(edge->target) << '\n'
+						<< position(addr) << ' ' << edge->cycles << '\n';
+			}
+		}
+	}
+	catch (std::ios_base::failure& e)
+	{
+		os.exceptions(prev_state);
+		throw e;
+	}
+	os.exceptions(prev_state);
+}
+
+
+void Chip8Profiler::call(uint16_t site, uint16_t target)
+{
+	_Calls& calls {_edges[uint32_t(site) << 16 | target]};
+	++calls.calls;
+	// Chip8 crashes before its stack gets this deep, but a state may have
+	// been loaded in the middle of calls that were never seen.
+	if (_depth == _Max_Depth)
+	{
+		std::move(std::next(_stack.begin()), _stack.end(), _stack.begin());
+		--_depth;
+	}
+	_stack[_depth++] = {site, _samples, &calls};
+}
+
+
+void Chip8Profiler::ret(uint16_t site)
+{
+	// Find the call being returned from, which is usually the latest. Any
+	// made after it were abandoned.
+	size_t depth {_depth};
+	while (depth > 0 && _stack[depth - 1].site != site) --depth;
+	if (depth == 0) return;
+
+	for (size_t i = _depth; i-- > depth - 1;)
+	{
+		// Recursive calls are counted once, by the outermost.
+		bool outer {true};
+		for (size_t j = 0; j < i; ++j)
+			if (_stack[j].calls == _stack[i].calls) outer = false;
+		if (outer) _stack[i].calls->cycles += _samples - _stack[i].start;
+	}
+	_depth = depth - 1;
+}
@@ -0,0 +1,140 @@
+#pragma once
+
+#include "Chip8.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+/**
+ * @brief A profile of where a program spends its cycles, from which the
+ * program's hotspots and calls can be found.
+ *
+ * Attach a profiler with Chip8::profiler() and the VM counts every cycle it
+ * executes against the address of the instruction it executed or waited in,
+ * and every 2NNN call against the address it was made from and the address
+ * called. A shadow of the call stack is kept to attribute the cycles spent in
+ * each call to it, including those of any calls it makes. Attaching and
+ * detaching are cheap, so profiling can be switched on and off at any time.
+ *
+ * A profiler must only be attached to one VM at a time, and must only be read
+ * while the VM isn't executing or once it has been detached.
+ */
+class Chip8Profiler
+{
+public:
+	/**
+	 * @brief Calls made from one address to another.
+	 */
+	struct Edge
+	{
+		uint16_t	site;	// Address of the 2NNN instruction.
+		uint16_t	target;	// Address called.
+		uint64_t	calls;	// Number of calls made.
+		uint64_t	cycles;	// Cycles spent in the calls, including theirs.
+	};
+
+	/**
+	 * @return The number of cycles counted.
+	 */
+	uint64_t samples();
+
+	/**
+	 * @return The number of cycles counted against each address.
+	 */
+	const std::array<uint64_t, 4096>& hits();
+
+	/**
+	 * @return Every pair of addresses a call was made between, ordered by site
+	 * then target. The cycles of calls still in progress count up to now.
+	 */
+	std::vector<Edge> edges();
+
+	/**
+	 * @brief Discards everything counted so far.
+	 */
+	void reset();
+
+	/**
+	 * @brief Writes the profile in the callgrind format, which can be read by
+	 * tools such as KCachegrind or converted into a flame graph.
+	 *
+	 * The program isn't divided into functions, so each address called, and
+	 * the start of the program, is taken as the start of one that runs up to
+	 * the next.
+	 *
+	 * @param os The output stream to write to.
+	 * @param program The name to give the program profiled.
+	 * @throws std::ios_base::failure if an error occurs while writing.
+	 */
+	void write_callgrind(std::ostream& os, const std::string& program);
+
+protected:
+	friend class Chip8;
+
+	// Deepest call stack allowed by Chip8.
+	static constexpr size_t _Max_Depth {16};
+
+	/**
+	 * @brief Calls made along an edge.
+	 */
+	struct _Calls
+	{
+		uint64_t calls {0};		// Number of calls.
+		uint64_t cycles {0};	// Cycles spent in completed calls.
+	};
+
+	/**
+	 * @brief A call in progress.
+	 */
+	struct _Frame
+	{
+		uint16_t	site;	// Address the call was made from.
+		uint64_t	start;	// Cycles counted when it was made.
+		_Calls*		calls;	// The edge it was made along.
+	};
+
+	std::array<uint64_t, 4096> _hits {};		// Cycles counted per address.
+	uint64_t _samples {0};						// Cycles counted.
+	// Calls made, keyed by site in the high 16 bits and target in the low.
+	std::unordered_map<uint32_t, _Calls> _edges;
+	std::array<_Frame, _Max_Depth> _stack;		// Calls in progress.
+	size_t _depth {0};							// Calls in _stack.
+
+	/**
+	 * @brief Called by the VM for every cycle executed.
+	 *
+	 * @param pc The address of the instruction being executed.
+	 */
+	void sample(uint16_t pc);
+
+	/**
+	 * @brief Called by the VM when a call is made.
+	 *
+	 * @param site The address of the 2NNN instruction.
+	 * @param target The address called.
+	 */
+	void call(uint16_t site, uint16_t target);
+
+	/**
+	 * @brief Called by the VM when a call returns.
+	 *
+	 * @param site The address the call was made from, which is returned to.
+	 * Returns that match no call in progress, such as those after a state is
+	 * loaded, are ignored.
+	 */
+	void ret(uint16_t site);
+};
+
+
+// Defined here so the per-cycle sample can be inlined into Chip8::execute_cycle.
+inline void Chip8Profiler::sample(uint16_t pc)
+{
+	++_hits[pc & 0xfff];
+	++_samples;
+}
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <utility>
+
+
+/**
+ * @brief Fixed size queue passing values from one thread to one other, such
+ * as commands from a UI to the thread running a VM, without either taking a
+ * lock.
+ *
+ * Values are moved into a ring of N slots. The writer publishes each by
+ * advancing the head past it, and the reader releases each slot by advancing
+ * the tail past it, so neither side ever writes what the other does. A reader
+ * with nothing to do can block in wait() until the next value is pushed.
+ *
+ * @tparam T The type of value queued, which must be default constructible and
+ * movable.
+ * @tparam N The number of values the queue holds. A power of two.
+ */
+template <typename T, size_t N>
+class Chip8Queue
+{
+	static_assert(N != 0 && (N & (N - 1)) == 0, "N must be a power of two.");
+
+public:
+	/**
+	 * @brief Adds a value to the back of the queue, waking the reader if it
+	 * is waiting. Yields until there is room if the queue is full. Must only
+	 * be called by the writer.
+	 *
+	 * @param value The value to add.
+	 */
+	void push(T value)
+	{
+		size_t head {_head.load(std::memory_order_relaxed)};
+		while (head - _tail.load(std::memory_order_acquire) == N)
+			std::this_thread::yield();
+		_slots[head % N] = std::move(value);
+		_head.store(head + 1, std::memory_order_release);
+		_head.notify_one();
+	}
+
+	/**
+	 * @brief Adds a value to the back of the queue unless it is full, waking
+	 * the reader if it is waiting. Never blocks. Must only be called by the
+	 * writer.
+	 *
+	 * @param value The value to add, which is swapped with the contents of
+	 * the slot it takes, so a buffer the reader gave back can be reused.
+	 * @return true if the value was added; false if the queue was full.
+	 */
+	bool try_push(T& value)
+	{
+		size_t head {_head.load(std::memory_order_relaxed)};
+		if (head - _tail.load(std::memory_order_acquire) == N) return false;
+		std::swap(_slots[head % N], value);
+		_head.store(head + 1, std::memory_order_release);
+		_head.notify_one();
+		return true;
+	}
+
+	/**
+	 * @brief Takes the value at the front of the queue, if there is one. Must
+	 * only be called by the reader.
+	 *
+	 * @param value Swapped with the value taken, leaving what it held in the
+	 * slot for the writer to reuse.
+	 * @return true if a value was taken; false if the queue was empty.
+	 */
+	bool pop(T& value)
+	{
+		size_t tail {_tail.load(std::memory_order_relaxed)};
+		if (tail == _head.load(std::memory_order_acquire)) return false;
+		std::swap(value, _slots[tail % N]);
+		_tail.store(tail + 1, std::memory_order_release);
+		return true;
+	}
+
+	/**
+	 * @brief Blocks until the queue holds a value, returning at once if it
+	 * already does. Must only be called by the reader.
+	 */
+	void wait()
+	{
+		_head.wait(_tail.load(std::memory_order_relaxed),
+			std::memory_order_acquire);
+	}
+
+protected:
+	std::array<T, N> _slots;	// Values pushed and not yet taken.
+	// Values pushed, written by the writer. Kept on a cache line apart from
+	// _tail so the two sides don't contend for it.
+	alignas(64) std::atomic<size_t> _head {0};
+	alignas(64) std::atomic<size_t> _tail {0};	// Values taken, by the reader.
+};
@@ -0,0 +1,281 @@
+#include "Chip8Recompiler.hpp"
+
+#include "Chip8Compiled.hpp"
+#include "Chip8Instructions.hpp"
+#include "Chip8RomPack.hpp"
+
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+
+
+namespace
+{
+	/**
+	 * @return The name of the platform's enumerator.
+	 */
+	const char* platform_name(Chip8::Platform platform)
+	{
+		switch (platform)
+		{
+			case Chip8::Platform::chip48: return "chip48";
+			case Chip8::Platform::schip: return "schip";
+			case Chip8::Platform::xochip: return "xochip";
+			default: return "chip8";
+		}
+	}
+
+
+	/**
+	 * @return The value as a hexadecimal literal of the passed digits.
+	 */
+	std::string hex(uint64_t value, int digits)
+	{
+		std::ostringstream os;
+		os << "0x" << std::hex << std::setw(digits) << std::setfill('0')
+			<< value;
+		return os.str();
+	}
+}
+
+
+Chip8Recompiler::Summary Chip8Recompiler::generate(
+	std::span<const uint8_t> program, Chip8::Platform platform,
+	const std::string& name, std::ostream& out)
+{
+	if (program.size() > Chip8::_Max_Prog_Size)
+		throw std::invalid_argument("Program is too large.");
+	Summary summary;
+	std::vector<_Block> blocks {discover(program, platform, summary)};
+	if (blocks.empty())
+		throw std::invalid_argument("No code found to compile.");
+
+	std::string rom {"Chip8CompiledRom<"
+		+ hex(Chip8RomPack::hash(program), 16) + "ULL>"};
+	out << "// Generated by chip8-aot from " << name << " for the "
+		<< platform_name(platform) << " platform; do not edit.\n"
+		"// Compiles the program's basic blocks for Chip8::Engine::compiled.\n"
+		"\n"
+		"#include \"Chip8Compiled.hpp\"\n"
+		"#include \"Chip8Instructions.hpp\"\n"
+		"\n"
+		"\n"
+		"template <>\n"
+		"struct " << rom << "\n"
+		"{\n"
+		"\tstatic constexpr Chip8::Platform P {Chip8::Platform::"
+		<< platform_name(platform) << "};\n"
+		"\tstatic const uint8_t rom[];\n"
+		"\tstatic const uint8_t handlers[];\n"
+		"\tstatic const Chip8Compiled::Block blocks[];\n";
+
+	for (const _Block& block : blocks)
+	{
+		out << "\n"
+			"\ttemplate <typename Policy>\n"
+			"\tstatic void block_" << hex(block.start, 4).substr(2)
+			<< "(Chip8& vm)\n"
+			"\t{\n";
+		uint16_t addr {block.start};
+		bool pc_set {false};
+		for (uint16_t instr : block.instrs)
+		{
+			uint8_t handler {Chip8::_DECODE_TABLE[instr]};
+			bool advance {handler != Chip8::H_JUMP
+				&& handler != Chip8::H_JUMPI && handler != Chip8::H_CALL
+				&& handler != Chip8::H_KEYD};
+			// Anything that can crash or that uses the PC needs it set first.
+			pc_set = !advance || handler == Chip8::H_RTS
+				|| handler == Chip8::H_SKE || handler == Chip8::H_SKNE
+				|| handler == Chip8::H_SKRE || handler == Chip8::H_SKRNE
+				|| handler == Chip8::H_SKPR || handler == Chip8::H_SKUP
+				|| handler == Chip8::H_DRAW || handler == Chip8::H_BCD
+				|| handler == Chip8::H_STOR || handler == Chip8::H_READ;
+			if (pc_set) out << "\t\tvm._pc = " << hex(addr, 4) << ";\n";
+			out << "\t\tChip8::" << handler_name(handler) << "(vm, "
+				<< hex(instr, 4) << ");\n";
+			if (pc_set && advance) out << "\t\tvm._pc += 2;\n";
+			addr += 2;
+			++summary.instructions;
+		}
+		if (!pc_set) out << "\t\tvm._pc = " << hex(addr, 4) << ";\n";
+		out << "\t}\n";
+	}
+	out << "};\n";
+
+	out << "\n"
+		"\n"
+		"const uint8_t " << rom << "::rom[]\n"
+		"{";
+	for (size_t i {0}; i < program.size(); ++i)
+		out << (i % 12 == 0 ? "\n\t" : " ") << hex(program[i], 2) << ",";
+	out << "\n};\n";
+
+	out << "\n"
+		"\n"
+		"const uint8_t " << rom << "::handlers[]\n"
+		"{\n";
+	for (const _Block& block : blocks)
+	{
+		out << "\t";
+		for (uint16_t instr : block.instrs)
+			out << +Chip8::_DECODE_TABLE[instr] << ", ";
+		out << "// " << hex(block.start, 4) << "\n";
+	}
+	out << "};\n";
+
+	out << "\n"
+		"\n"
+		"const Chip8Compiled::Block " << rom << "::blocks[]\n"
+		"{\n";
+	size_t handlers {0};
+	for (const _Block& block : blocks)
+	{
+		std::string func {"block_" + hex(block.start, 4).substr(2)};
+		out << "\t{" << hex(block.start, 4) << ", " << block.instrs.size()
+			<< ", " << func << "<Chip8::_Strict>,\n"
+			"\t\t" << func << "<Chip8::_Fast>, &handlers[" << handlers
+			<< "]},\n";
+		handlers += block.instrs.size();
+	}
+	out << "};\n";
+
+	out << "\n"
+		"\n"
+		"namespace\n"
+		"{\n"
+		"\tconst Chip8Compiled::Registration registration {{" << rom
+		<< "::P,\n"
+		"\t\t" << rom << "::rom, " << rom << "::blocks}};\n"
+		"}\n";
+
+	summary.blocks = blocks.size();
+	return summary;
+}
+
+
+std::vector<Chip8Recompiler::_Block> Chip8Recompiler::discover(
+	std::span<const uint8_t> program, Chip8::Platform platform,
+	Summary& summary)
+{
+	const Chip8::_HandlerTable& table {
+		Chip8::handler_table(Chip8::Access::strict, platform)};
+	size_t end {Chip8::_Prog_Start + program.size()};
+	// Returns the handler of the instruction at addr, or H_INVALID if there
+	// isn't a valid one wholly within the program.
+	auto decode = [&](uint16_t addr, uint16_t& instr) -> uint8_t
+	{
+		if (addr < Chip8::_Prog_Start || addr + 2U > end)
+			return Chip8::H_INVALID;
+		size_t offset {static_cast<size_t>(addr - Chip8::_Prog_Start)};
+		instr = static_cast<uint16_t>(program[offset] << 8
+			| program[offset + 1]);
+		uint8_t handler {Chip8::_DECODE_TABLE[instr]};
+		return table[handler] == Chip8::in_invalid ? Chip8::H_INVALID
+			: handler;
+	};
+
+	// Every address execution is found to reach, and those that start blocks.
+	std::vector<bool> reached(end + 4), leader(end + 4);
+	std::vector<uint16_t> work {Chip8::_Prog_Start};
+	reached[Chip8::_Prog_Start] = true;
+	leader[Chip8::_Prog_Start] = true;
+	auto visit = [&](uint32_t addr, bool lead)
+	{
+		if (addr >= end) return;
+		leader[addr] = leader[addr] || lead;
+		if (reached[addr]) return;
+		reached[addr] = true;
+		work.push_back(static_cast<uint16_t>(addr));
+	};
+	while (!work.empty())
+	{
+		uint16_t addr {work.back()};
+		work.pop_back();
+		uint16_t instr;
+		switch (decode(addr, instr))
+		{
+			case Chip8::H_INVALID: case Chip8::H_RTS:
+				break;
+			case Chip8::H_JUMPI:
+				++summary.computed_jumps;
+				break;
+			case Chip8::H_JUMP:
+				visit(Chip8::instr_addr(instr), true);
+				break;
+			case Chip8::H_CALL:
+				visit(Chip8::instr_addr(instr), true);
+				visit(addr + 2U, true);
+				break;
+			case Chip8::H_SKE: case Chip8::H_SKNE: case Chip8::H_SKRE:
+			case Chip8::H_SKRNE: case Chip8::H_SKPR: case Chip8::H_SKUP:
+				visit(addr + 2U, true);
+				visit(addr + 4U, true);
+				break;
+			case Chip8::H_DRAW:
+				// A draw waiting for the display is executed again on its own.
+				if (Chip8::quirks(platform).display_wait) leader[addr] = true;
+				visit(addr + 2U, true);
+				break;
+			case Chip8::H_KEYD: case Chip8::H_BCD: case Chip8::H_STOR:
+				visit(addr + 2U, true);
+				break;
+			default:
+				visit(addr + 2U, false);
+				break;
+		}
+	}
+
+	std::vector<_Block> blocks;
+	for (uint16_t start {Chip8::_Prog_Start}; start < end; ++start)
+	{
+		if (!reached[start] || !leader[start]) continue;
+		_Block block {start, {}};
+		uint16_t addr {start};
+		uint16_t instr;
+		uint8_t handler;
+		while ((addr == start || !leader[addr])
+			&& (handler = decode(addr, instr)) != Chip8::H_INVALID)
+		{
+			block.instrs.push_back(instr);
+			addr += 2;
+			// The same instructions end a block here as in Chip8BlockCache,
+			// along with writes to memory, which may overwrite the block.
+			bool ends {handler == Chip8::H_JUMP || handler == Chip8::H_JUMPI
+				|| handler == Chip8::H_CALL || handler == Chip8::H_RTS
+				|| handler == Chip8::H_SKE || handler == Chip8::H_SKNE
+				|| handler == Chip8::H_SKRE || handler == Chip8::H_SKRNE
+				|| handler == Chip8::H_SKPR || handler == Chip8::H_SKUP
+				|| handler == Chip8::H_DRAW || handler == Chip8::H_KEYD
+				|| handler == Chip8::H_BCD || handler == Chip8::H_STOR};
+			if (ends || block.instrs.size() == Chip8Compiled::max_block_ops)
+				break;
+		}
+		if (!block.instrs.empty()) blocks.push_back(std::move(block));
+	}
+	return blocks;
+}
+
+
+const char* Chip8Recompiler::handler_name(uint8_t handler)
+{
+	// In the order of _HANDLER_TABLE, with the same template arguments.
+	static constexpr const char* names[]
+	{
+		"in_invalid",
+		"in_clr",		"in_rts<Policy>",	"in_jump",		"in_call<Policy>",
+		"in_ske",		"in_skne",			"in_skre",		"in_load",
+		"in_add",		"in_move",			"in_or<P>",		"in_and<P>",
+		"in_xor<P>",	"in_addr",			"in_sub",		"in_shr<P>",
+		"in_suba",		"in_shl<P>",		"in_skrne",		"in_loadi",
+		"in_jumpi<P>",	"in_rand",			"in_draw<Policy, P>",
+		"in_skpr",		"in_skup",			"in_moved",		"in_keyd",
+		"in_loadd",		"in_loads",			"in_addi",		"in_ldspr",
+		"in_bcd<Policy>",	"in_stor<Policy, P>",	"in_read<Policy, P>",
+		"in_scd",		"in_scu",			"in_scr",		"in_scl",
+		"in_low",		"in_high",			"in_plane",		"in_ldbig",
+	};
+	static_assert(std::size(names) == Chip8::H_COUNT,
+		"Every handler must be named.");
+	return names[handler];
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "Chip8.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <span>
+#include <string>
+#include <vector>
+
+
+/**
+ * @brief Compiles programs ahead of time for the Chip8::Engine::compiled
+ * execution engine, as C++ to be linked in beside the core.
+ *
+ * The code reachable from the start of the program is found by following
+ * every jump, call, and skip from it, then split into basic blocks that end at
+ * the first jump, call, return, skip, draw, key wait, or write to memory. Each
+ * block becomes a function calling the instruction implementations of the
+ * program's platform one after another, which the compiler inlines and folds
+ * together. Targets of BNNN can't be known ahead of time, so are only found if
+ * other code reaches them; whatever isn't found is interpreted.
+ */
+class Chip8Recompiler
+{
+public:
+	/**
+	 * @brief What was compiled of a program.
+	 */
+	struct Summary
+	{
+		size_t blocks {0};			// Blocks compiled.
+		size_t instructions {0};	// Instructions in those blocks.
+		size_t computed_jumps {0};	// BNNN found, whose targets are unknown.
+	};
+
+	/**
+	 * @brief Writes C++ registering the compiled blocks of a program for
+	 * Chip8Compiled. It needs Chip8Compiled.hpp and Chip8Instructions.hpp on
+	 * its include path, and must be linked into the executable, not a static
+	 * library, as nothing refers to it.
+	 *
+	 * @param program The bytes of the program.
+	 * @param platform The platform whose quirks the program is run with, which
+	 * a VM must also be set to for the code to be used.
+	 * @param name A name for the program, such as its file's, written in a
+	 * comment.
+	 * @param out Where to write the source.
+	 * @return What was compiled.
+	 * @throws std::invalid_argument if the program is too large or has no
+	 * code to compile at its start.
+	 */
+	static Summary generate(std::span<const uint8_t> program,
+		Chip8::Platform platform, const std::string& name, std::ostream& out);
+
+protected:
+	/**
+	 * @brief A block found to compile.
+	 */
+	struct _Block
+	{
+		uint16_t				start;	// Address of the first instruction.
+		std::vector<uint16_t>	instrs;	// Its instructions, in order.
+	};
+
+	/**
+	 * @brief Finds the basic blocks reachable from the start of a program.
+	 *
+	 * @param program The bytes of the program.
+	 * @param platform The platform the program is run with.
+	 * @param summary Counts the computed jumps found.
+	 * @return The blocks, in order of address.
+	 */
+	static std::vector<_Block> discover(std::span<const uint8_t> program,
+		Chip8::Platform platform, Summary& summary);
+
+	/**
+	 * @param handler The index of a handler in Chip8::_HANDLER_TABLE.
+	 * @return The name of the handler's function in generated code, with the
+	 * template arguments it takes there.
+	 */
+	static const char* handler_name(uint8_t handler);
+};
@@ -0,0 +1,183 @@
+#include "Chip8Rewind.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+
+namespace
+{
+	// Equal bytes shorter than this are kept in a run of changed bytes, as a
+	// new run would take more space.
+	constexpr size_t min_skip {4};
+
+
+	/**
+	 * @return The number of bytes from offset to size that are the same in
+	 * both a and b.
+	 */
+	inline size_t same_bytes(const uint8_t* a, const uint8_t* b, size_t offset,
+		size_t size)
+	{
+		size_t i {offset};
+		for (; i + 8 <= size; i += 8)
+		{
+			uint64_t x, y;
+			memcpy(&x, a + i, 8);
+			memcpy(&y, b + i, 8);
+			if (x != y) break;
+		}
+		while (i < size && a[i] == b[i]) ++i;
+		return i - offset;
+	}
+
+
+	inline void put16(uint8_t*& out, size_t value)
+	{
+		*out++ = static_cast<uint8_t>(value);
+		*out++ = static_cast<uint8_t>(value >> 8);
+	}
+
+
+	inline size_t get16(const uint8_t*& in)
+	{
+		size_t value {static_cast<size_t>(in[0] | in[1] << 8)};
+		in += 2;
+		return value;
+	}
+}
+
+
+Chip8Rewind::Chip8Rewind(size_t capacity, size_t max_frames)
+	: _newest(_Image_Size), _image(_Image_Size), _delta(_Max_Delta_Size)
+{
+	if (capacity < _Max_Delta_Size || capacity > UINT32_MAX)
+		throw std::invalid_argument("Invalid rewind capacity.");
+	if (max_frames == 0)
+		throw std::invalid_argument("Rewind must keep at least one frame.");
+	_data.resize(capacity);
+	_entries.resize(max_frames);
+}
+
+
+size_t Chip8Rewind::frames()
+{
+	return _count;
+}
+
+
+size_t Chip8Rewind::rewind(Chip8& vm, size_t frames)
+{
+	if (!_recorded) return 0;
+
+	// Walk back from the most recent state, dropping each difference.
+	size_t steps {std::min(frames, _count.load())};
+	for (size_t i = 0; i < steps; ++i)
+	{
+		const _Entry& last {_entries[(_first + _count - 1) % _entries.size()]};
+		apply_delta(&_data[last.offset], last.size, _newest.data());
+		_head = last.offset;
+		--_count;
+	}
+	vm.decode_state(_newest.data(), _newest.size());
+	return steps;
+}
+
+
+void Chip8Rewind::capture(Chip8& vm)
+{
+	vm.encode_state(_image.data(), false);
+	if (!_recorded)
+	{
+		std::swap(_newest, _image);
+		_recorded = true;
+		return;
+	}
+	size_t size {encode_delta(_newest.data(), _image.data(), _delta.data())};
+	std::swap(_newest, _image);
+
+	// Make room for the difference, wrapping to the start of the ring if it
+	// won't fit at the end. The oldest differences always lie just after
+	// _head, so they are the ones discarded.
+	if (_count == _entries.size()) evict_oldest();
+	size_t head {_head};
+	bool wrapped {head + size > _data.size()};
+	size_t pos {wrapped ? 0 : head};
+	while (_count > 0)
+	{
+		const _Entry& oldest {_entries[_first]};
+		bool behind {wrapped && oldest.offset >= head};
+		bool overlaps {oldest.offset < pos + size
+			&& pos < oldest.offset + oldest.size};
+		if (!behind && !overlaps) break;
+		evict_oldest();
+	}
+
+	memcpy(&_data[pos], _delta.data(), size);
+	_entries[(_first + _count) % _entries.size()] = {
+		static_cast<uint32_t>(pos), static_cast<uint32_t>(size)};
+	++_count;
+	_head = pos + size;
+}
+
+
+void Chip8Rewind::clear()
+{
+	_first = 0;
+	_count = 0;
+	_head = 0;
+	_recorded = false;
+}
+
+
+void Chip8Rewind::evict_oldest()
+{
+	_first = (_first + 1) % _entries.size();
+	--_count;
+}
+
+
+size_t Chip8Rewind::encode_delta(const uint8_t* from, const uint8_t* to,
+	uint8_t* out)
+{
+	// The difference is a sequence of runs, each the number of bytes that are
+	// unchanged, the number that follow which changed, then those bytes XORed.
+	uint8_t* start {out};
+	size_t i {0};
+	while (true)
+	{
+		size_t skip {same_bytes(from, to, i, _Image_Size)};
+		i += skip;
+		if (i == _Image_Size) break;
+
+		// Extend the run of changes until enough bytes are unchanged.
+		size_t end {i + 1};
+		while (end < _Image_Size)
+		{
+			size_t same {same_bytes(from, to, end, _Image_Size)};
+			if (same >= min_skip || end + same == _Image_Size) break;
+			end += same + 1;
+		}
+
+		put16(out, skip);
+		put16(out, end - i);
+		for (; i < end; ++i) *out++ = from[i] ^ to[i];
+	}
+	assert(static_cast<size_t>(out - start) <= _Max_Delta_Size);
+	return out - start;
+}
+
+
+void Chip8Rewind::apply_delta(const uint8_t* delta, size_t size,
+	uint8_t* image)
+{
+	const uint8_t* end {delta + size};
+	while (delta < end)
+	{
+		image += get16(delta);
+		size_t changed {get16(delta)};
+		for (size_t i = 0; i < changed; ++i) *image++ ^= *delta++;
+	}
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include "Chip8.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+
+/**
+ * @brief A history of a VM's state at the end of each of its recent frames,
+ * which the VM can be rewound through.
+ *
+ * Attach a history with Chip8::rewind() and the VM records its state into it
+ * after every 60Hz timer tick. Only the most recent state is kept whole; every
+ * other is stored as the difference between it and the state after it (the
+ * bytes that changed, XORed and run-length encoded), which is usually a few
+ * dozen bytes. The differences are kept in a ring of fixed size, the oldest
+ * being discarded to make room for new ones, so recording and rewinding never
+ * allocate and rewinding takes constant time per frame stepped back.
+ *
+ * A history must only be attached to one VM at a time.
+ */
+class Chip8Rewind
+{
+public:
+	/**
+	 * @brief Construct a new, empty history. All of its memory is allocated
+	 * here.
+	 *
+	 * @param capacity The number of bytes available to store differences
+	 * between frames in.
+	 * @param max_frames The largest number of frames that can be rewound.
+	 * @throws std::invalid_argument if the capacity is too small to store a
+	 * single difference, or too large, or max_frames is 0.
+	 */
+	Chip8Rewind(size_t capacity = 4 << 20, size_t max_frames = 60 * 60 * 5);
+
+	/**
+	 * @return The number of frames the VM can currently be rewound by. May be
+	 * called from any thread.
+	 */
+	size_t frames();
+
+	/**
+	 * @brief Restores the VM to the state it had at the end of an earlier
+	 * frame, discarding the frames after it.
+	 *
+	 * @param vm The VM recording into this history.
+	 * @param frames The number of frames before the most recently recorded one
+	 * to restore. 0 restores the most recent frame.
+	 * @return The number of frames actually stepped back, which is at most
+	 * frames().
+	 */
+	size_t rewind(Chip8& vm, size_t frames);
+
+protected:
+	friend class Chip8;
+
+	// Size of the state of a VM as recorded.
+	static constexpr size_t _Image_Size {
+		Chip8::_Max_State_Size - Chip8::_State_Header_Size};
+	// Largest size of the difference between two states.
+	static constexpr size_t _Max_Delta_Size {_Image_Size + 4};
+
+	/**
+	 * @brief The location of a difference in _data.
+	 */
+	struct _Entry
+	{
+		uint32_t offset;
+		uint32_t size;
+	};
+
+	std::vector<uint8_t> _data;		// Ring of differences between frames.
+	std::vector<_Entry> _entries;	// Ring of differences, oldest first.
+	size_t _first {0};				// Index of the oldest entry.
+	std::atomic<size_t> _count {0};	// Number of entries.
+	size_t _head {0};				// Offset in _data to write next.
+	bool _recorded {false};			// Set once _newest holds a state.
+	std::vector<uint8_t> _newest;	// The most recently recorded state.
+	std::vector<uint8_t> _image;	// Scratch space for a new state.
+	std::vector<uint8_t> _delta;	// Scratch space for a new difference.
+
+	/**
+	 * @brief Records the VM's current state as the most recent frame.
+	 *
+	 * @param vm The VM recording into this history.
+	 */
+	void capture(Chip8& vm);
+
+	/**
+	 * @brief Discards every recorded frame.
+	 */
+	void clear();
+
+	/**
+	 * @brief Discards the oldest difference.
+	 */
+	void evict_oldest();
+
+	/**
+	 * @brief Encodes the bytes that differ between two states.
+	 *
+	 * @param from The state to be restored by applying the difference.
+	 * @param to The state the difference is applied to.
+	 * @param out Where to write the difference, which is at most
+	 * _Max_Delta_Size bytes.
+	 * @return The size of the difference.
+	 */
+	static size_t encode_delta(const uint8_t* from, const uint8_t* to,
+		uint8_t* out);
+
+	/**
+	 * @brief Applies a difference produced by encode_delta() to a state.
+	 *
+	 * @param delta The difference.
+	 * @param size The size of the difference.
+	 * @param image The state to change.
+	 */
+	static void apply_delta(const uint8_t* delta, size_t size, uint8_t* image);
+};
@@ -0,0 +1,157 @@
+#include "Chip8RomPack.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <stdexcept>
+
+
+namespace
+{
+	/**
+	 * @brief Stores value at out as little endian and advances out past it.
+	 */
+	template <typename T>
+	inline void put(uint8_t*& out, T value)
+	{
+		uint64_t bits {static_cast<uint64_t>(value)};
+		for (size_t i = 0; i < sizeof(T); ++i)
+			*out++ = static_cast<uint8_t>(bits >> 8 * i);
+	}
+
+
+	/**
+	 * @return The little endian value at in, advancing in past it.
+	 */
+	template <typename T>
+	inline T get(const uint8_t*& in)
+	{
+		uint64_t value {0};
+		for (size_t i = 0; i < sizeof(T); ++i)
+			value |= static_cast<uint64_t>(*in++) << 8 * i;
+		return static_cast<T>(value);
+	}
+}
+
+
+Chip8RomPack::Chip8RomPack(const std::string& path)
+	: _file(path)
+{
+	std::span<const uint8_t> bytes {_file.bytes()};
+	if (bytes.size() < _Header_Size
+		|| memcmp(bytes.data(), _Magic, sizeof(_Magic)))
+		throw std::ios_base::failure("Not a ROM pack.");
+	const uint8_t* in {bytes.data() + sizeof(_Magic)};
+	if (get<uint16_t>(in) != _Version)
+		throw std::ios_base::failure("Unsupported ROM pack version.");
+	in += 2;
+	uint32_t count {get<uint32_t>(in)};
+	if ((bytes.size() - _Header_Size) / _Entry_Size < count)
+		throw std::ios_base::failure("ROM pack is corrupt.");
+
+	// Check every entry now, so that lookups needn't.
+	in = bytes.data() + _Header_Size;
+	_index.resize(count);
+	for (_Entry& entry : _index)
+	{
+		entry.hash = get<uint64_t>(in);
+		entry.offset = get<uint32_t>(in);
+		entry.size = get<uint32_t>(in);
+		bool sorted {&entry == _index.data() || (&entry)[-1].hash < entry.hash};
+		if (!sorted || entry.offset > bytes.size()
+			|| entry.size > bytes.size() - entry.offset)
+			throw std::ios_base::failure("ROM pack is corrupt.");
+	}
+}
+
+
+size_t Chip8RomPack::size() const
+{
+	return _index.size();
+}
+
+
+std::span<const uint8_t> Chip8RomPack::rom(size_t i) const
+{
+	return _file.bytes().subspan(_index[i].offset, _index[i].size);
+}
+
+
+uint64_t Chip8RomPack::hash(size_t i) const
+{
+	return _index[i].hash;
+}
+
+
+bool Chip8RomPack::contains(uint64_t hash) const
+{
+	return lookup(hash);
+}
+
+
+std::span<const uint8_t> Chip8RomPack::find(uint64_t hash) const
+{
+	const _Entry* entry {lookup(hash)};
+	if (!entry) throw std::out_of_range("ROM not in pack.");
+	return _file.bytes().subspan(entry->offset, entry->size);
+}
+
+
+uint64_t Chip8RomPack::hash(std::span<const uint8_t> rom)
+{
+	uint64_t hash {0xcbf29ce484222325};
+	for (uint8_t byte : rom) hash = (hash ^ byte) * 0x100000001b3;
+	return hash;
+}
+
+
+std::ostream& Chip8RomPack::write(std::ostream& os,
+	const std::vector<std::span<const uint8_t>>& roms)
+{
+	// Sorting by hash both orders the index and drops duplicates.
+	std::map<uint64_t, std::span<const uint8_t>> unique;
+	for (std::span<const uint8_t> rom : roms) unique.emplace(hash(rom), rom);
+
+	size_t offset {_Header_Size + unique.size() * _Entry_Size};
+	std::vector<uint8_t> header(offset);
+	uint8_t* out {header.data()};
+	memcpy(out, _Magic, sizeof(_Magic));
+	out += sizeof(_Magic);
+	put<uint16_t>(out, _Version);
+	put<uint16_t>(out, 0);
+	put<uint32_t>(out, unique.size());
+	out += _Header_Size - 12;
+	for (const auto& [hash, rom] : unique)
+	{
+		if (offset + rom.size() > UINT32_MAX)
+			throw std::length_error("ROM pack too large.");
+		put<uint64_t>(out, hash);
+		put<uint32_t>(out, offset);
+		put<uint32_t>(out, rom.size());
+		offset += rom.size();
+	}
+
+	std::ios_base::iostate prev_state = os.exceptions();
+	os.exceptions(std::istream::failbit);
+	try
+	{
+		os.write(reinterpret_cast<char*>(header.data()), header.size());
+		for (const auto& [hash, rom] : unique)
+			os.write(reinterpret_cast<const char*>(rom.data()), rom.size());
+	}
+	catch (std::ios_base::failure& e)
+	{
+		os.exceptions(prev_state);
+		throw e;
+	}
+	os.exceptions(prev_state);
+	return os;
+}
+
+
+const Chip8RomPack::_Entry* Chip8RomPack::lookup(uint64_t hash) const
+{
+	auto it {std::lower_bound(_index.begin(), _index.end(), hash,
+		[](const _Entry& entry, uint64_t hash) { return entry.hash < hash; })};
+	return it != _index.end() && it->hash == hash ? &*it : nullptr;
+}
@@ -0,0 +1,113 @@
+#pragma once
+
+#include "Chip8MappedFile.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <span>
+#include <string>
+#include <vector>
+
+
+/**
+ * @brief A library of programs packed into one file, which is mapped into
+ * memory and indexed by the hash of each program's contents. Switching a VM
+ * to another program in the pack is a lookup and a single copy into its
+ * memory, with no file system calls.
+ *
+ * A pack starts with a 16 byte header of the magic number "CH8P", a 16 bit
+ * version, 16 reserved bits, and a 32 bit count of programs. An index of that
+ * many 16 byte entries follows, each a 64 bit hash, 32 bit offset from the
+ * start of the file, and 32 bit size, sorted by hash. The programs are stored
+ * after the index. All values are little endian.
+ */
+class Chip8RomPack
+{
+public:
+	/**
+	 * @brief Map a pack and check its index.
+	 *
+	 * @param path The path of the pack.
+	 * @throws std::ios_base::failure if the pack can't be mapped, or is not a
+	 * valid pack.
+	 */
+	Chip8RomPack(const std::string& path);
+
+	/**
+	 * @return The number of programs in the pack.
+	 */
+	size_t size() const;
+
+	/**
+	 * @param i The position of a program in the index, less than size().
+	 * @return The program, valid for the lifetime of the pack.
+	 */
+	std::span<const uint8_t> rom(size_t i) const;
+
+	/**
+	 * @param i The position of a program in the index, less than size().
+	 * @return The program's hash.
+	 */
+	uint64_t hash(size_t i) const;
+
+	/**
+	 * @param hash The hash of a program's contents.
+	 * @return true if the pack holds the program; false otherwise.
+	 */
+	bool contains(uint64_t hash) const;
+
+	/**
+	 * @param hash The hash of a program's contents.
+	 * @return The program, valid for the lifetime of the pack.
+	 * @throws std::out_of_range if the pack doesn't hold the program.
+	 */
+	std::span<const uint8_t> find(uint64_t hash) const;
+
+	/**
+	 * @param rom The contents of a program.
+	 * @return The hash the program is indexed by (64 bit FNV-1a).
+	 */
+	static uint64_t hash(std::span<const uint8_t> rom);
+
+	/**
+	 * @brief Write a pack of the passed programs, each stored once however
+	 * many times it is passed.
+	 *
+	 * @param os The output stream to write to.
+	 * @param roms The programs to pack.
+	 * @return std::ostream& The output stream written to.
+	 * @throws std::ios_base::failure if an error occurs while writing.
+	 * @throws std::length_error if the pack would be larger than 4 GiB.
+	 */
+	static std::ostream& write(std::ostream& os,
+		const std::vector<std::span<const uint8_t>>& roms);
+
+protected:
+	// Magic number at the start of every pack.
+	static constexpr uint8_t _Magic[4] {'C', 'H', '8', 'P'};
+	// Current pack format version.
+	static constexpr uint16_t _Version {1};
+	// Size of the pack header.
+	static constexpr size_t _Header_Size {16};
+	// Size of an index entry.
+	static constexpr size_t _Entry_Size {16};
+
+	/**
+	 * @brief An index entry, as decoded from the pack.
+	 */
+	struct _Entry
+	{
+		uint64_t hash;		// Hash of the program.
+		uint32_t offset;	// Offset of the program in the pack.
+		uint32_t size;		// Size of the program.
+	};
+
+	Chip8MappedFile _file;			// The mapped pack.
+	std::vector<_Entry> _index;		// The index, sorted by hash.
+
+	/**
+	 * @return The index entry for the hash, or nullptr if there is none.
+	 */
+	const _Entry* lookup(uint64_t hash) const;
+};
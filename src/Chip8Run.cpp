@@ -0,0 +1,442 @@
+// Headless runner for the Chip-8 VM: executes a ROM for a fixed number of
+// cycles or amount of emulated time without any GUI.
+
+#include "Chip8.hpp"
+#include "Chip8Headless.hpp"
+#include "Chip8InputLog.hpp"
+#include "Chip8MappedFile.hpp"
+#include "Chip8Pacer.hpp"
+#include "Chip8Profiler.hpp"
+#include "Chip8RomPack.hpp"
+#include "Chip8Tone.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+namespace
+{
+	const char* usage
+	{
+		"Usage: chip8-run [options] ROM\n"
+		"       chip8-run [options] --replay LOG\n"
+		"Options:\n"
+		"  --cycles N       Run for N instruction cycles (default 60000).\n"
+		"  --time MS        Run for MS milliseconds of emulated time.\n"
+		"  --freq HZ        Instruction cycle frequency, up to 1000000000\n"
+		"                   (default 1200).\n"
+		"  --seed N         Seed for the random number generator (default 0).\n"
+		"  --engine NAME    Execution engine: interpreter, block, or compiled,\n"
+		"                   which runs any code chip8-aot compiled in for\n"
+		"                   the ROM (default interpreter).\n"
+		"  --access NAME    Memory access: strict, which crashes on any\n"
+		"                   outside memory, or fast (default strict).\n"
+		"  --platform NAME  Quirks to run with: chip8, chip48, schip, xochip,\n"
+		"                   or auto to guess from the ROM (default auto). A\n"
+		"                   replay runs with the platform it was recorded\n"
+		"                   with.\n"
+		"  --speed S        realtime, a fast forward factor such as 4, or max\n"
+		"                   to run unthrottled (default max).\n"
+		"  --record         Record display, keyboard, and sound activity.\n"
+		"  --wav PATH       Write the sound the program played to PATH as a\n"
+		"                   WAV file, in step with emulated time.\n"
+		"  --screen         Print the final screen contents.\n"
+		"  --stats          Print the VM's statistics (needs a core built\n"
+		"                   with CHIP8_INSTRUMENT).\n"
+		"  --save PATH      Save the final VM state to PATH.\n"
+		"  --profile PATH   Profile the program, writing where it spent its\n"
+		"                   cycles to PATH in the callgrind format.\n"
+		"  --replay LOG     Replay a recorded input log from the state it\n"
+		"                   started at, with its frequency. Runs to the end\n"
+		"                   of the log and then for --cycles or --time longer\n"
+		"                   (default 1 cycle, to reach a crash that ended it).\n"
+		"  --pack PACK      Run the ROM from a pack made by chip8-pack, given\n"
+		"                   as the hexadecimal hash of its contents.\n"
+	};
+
+
+	/**
+	 * @brief Options given on the command line.
+	 */
+	struct Options
+	{
+		std::string		rom;					// Path of the ROM to run.
+		uint64_t		cycles {60000};			// Cycles to execute.
+		uint64_t		time_ms {0};			// Emulated time, if nonzero.
+		uint32_t		freq {1200};			// Cycle frequency.
+		uint64_t		seed {0};				// Random number seed.
+		Chip8::Engine	engine {Chip8::Engine::interpreter};
+		Chip8::Access	access {Chip8::Access::strict};
+		std::optional<Chip8::Platform> platform;	// Guessed if not set.
+		Chip8Pacer::Mode pace {Chip8Pacer::Mode::unthrottled};
+		uint16_t		factor {1};				// Fast forward factor.
+		bool			record {false};			// Use recording delegates.
+		bool			screen {false};			// Print the final screen.
+		bool			stats {false};			// Print the statistics.
+		std::string		save;					// Path for the final state.
+		std::string		profile;				// Path for the profile.
+		std::string		wav;					// Path for the sound.
+		std::string		replay;					// Path of an input log.
+		std::string		pack;					// Path of a ROM pack.
+		bool			length {false};			// Set if a length was given.
+	};
+
+
+	/**
+	 * @brief Parses the command line into an Options structure.
+	 *
+	 * @throws std::invalid_argument if the command line is malformed.
+	 */
+	Options parse_args(int argc, char** argv)
+	{
+		Options opts;
+		for (int i {1}; i < argc; ++i)
+		{
+			std::string arg {argv[i]};
+			auto value = [&]() -> std::string
+			{
+				if (i + 1 >= argc)
+					throw std::invalid_argument("Missing value for " + arg);
+				return argv[++i];
+			};
+
+			if (arg == "--cycles")
+			{
+				opts.cycles = std::stoull(value());
+				opts.length = true;
+			}
+			else if (arg == "--time")
+			{
+				opts.time_ms = std::stoull(value());
+				opts.length = true;
+			}
+			else if (arg == "--seed") opts.seed = std::stoull(value());
+			else if (arg == "--freq")
+			{
+				unsigned long freq {std::stoul(value())};
+				if (freq == 0 || freq > Chip8::max_frequency)
+					throw std::invalid_argument("Frequency out of range.");
+				opts.freq = static_cast<uint32_t>(freq);
+			}
+			else if (arg == "--engine")
+			{
+				std::string name {value()};
+				if (name == "interpreter")
+					opts.engine = Chip8::Engine::interpreter;
+				else if (name == "block")
+					opts.engine = Chip8::Engine::block_cache;
+				else if (name == "compiled")
+					opts.engine = Chip8::Engine::compiled;
+				else throw std::invalid_argument("Unknown engine: " + name);
+			}
+			else if (arg == "--access")
+			{
+				std::string name {value()};
+				if (name == "strict") opts.access = Chip8::Access::strict;
+				else if (name == "fast") opts.access = Chip8::Access::fast;
+				else throw std::invalid_argument("Unknown access: " + name);
+			}
+			else if (arg == "--platform")
+			{
+				std::string name {value()};
+				if (name == "chip8") opts.platform = Chip8::Platform::chip8;
+				else if (name == "chip48")
+					opts.platform = Chip8::Platform::chip48;
+				else if (name == "schip")
+					opts.platform = Chip8::Platform::schip;
+				else if (name == "xochip")
+					opts.platform = Chip8::Platform::xochip;
+				else if (name == "auto") opts.platform.reset();
+				else throw std::invalid_argument("Unknown platform: " + name);
+			}
+			else if (arg == "--speed")
+			{
+				std::string speed {value()};
+				if (speed == "realtime")
+					opts.pace = Chip8Pacer::Mode::realtime;
+				else if (speed == "max")
+					opts.pace = Chip8Pacer::Mode::unthrottled;
+				else
+				{
+					unsigned long factor {std::stoul(speed)};
+					if (factor == 0 || factor > UINT16_MAX)
+						throw std::invalid_argument("Speed out of range.");
+					opts.pace = Chip8Pacer::Mode::fast_forward;
+					opts.factor = static_cast<uint16_t>(factor);
+				}
+			}
+			else if (arg == "--record") opts.record = true;
+			else if (arg == "--screen") opts.screen = true;
+			else if (arg == "--stats") opts.stats = true;
+			else if (arg == "--save") opts.save = value();
+			else if (arg == "--profile") opts.profile = value();
+			else if (arg == "--wav") opts.wav = value();
+			else if (arg == "--replay") opts.replay = value();
+			else if (arg == "--pack") opts.pack = value();
+			else if (arg.starts_with("--"))
+				throw std::invalid_argument("Unknown option: " + arg);
+			else if (opts.rom.empty()) opts.rom = arg;
+			else throw std::invalid_argument("Only one ROM may be given.");
+		}
+
+		if (opts.replay.empty() == opts.rom.empty())
+			throw std::invalid_argument("Give either a ROM or an input log.");
+		if (!opts.replay.empty() && !opts.length) opts.cycles = 1;
+		if (!opts.pack.empty() && opts.rom.empty())
+			throw std::invalid_argument("--pack needs the hash of a ROM.");
+		if (opts.record && !opts.wav.empty())
+			throw std::invalid_argument(
+				"--record and --wav can't be combined.");
+		return opts;
+	}
+
+
+	/**
+	 * @brief Prints the screen to the passed stream, one character per pixel,
+	 * at the resolution it is in. Pixels set on the first plane are '#', on
+	 * the second '+', and on both '@'.
+	 */
+	void print_screen(std::ostream& os, const Chip8Screen& screen)
+	{
+		constexpr char pixels[] {'.', '#', '+', '@'};
+		for (unsigned y {0}; y < screen.height(); ++y)
+		{
+			for (unsigned x {0}; x < screen.width(); ++x)
+			{
+				unsigned colour {0};
+				for (size_t p {0}; p < Chip8Screen::planes; ++p)
+				{
+					const Chip8Screen::Plane& plane {screen.plane[p]};
+					uint64_t row {x < 64 ? plane.left[y] : plane.right[y]};
+					if (row >> (63 - x % 64) & 1) colour |= 1 << p;
+				}
+				os << pixels[colour];
+			}
+			os << '\n';
+		}
+	}
+
+
+	/**
+	 * @brief Prints the VM's statistics to the passed stream.
+	 */
+	void print_stats(std::ostream& os, const Chip8Stats& stats)
+	{
+		if (!Chip8Stats::enabled)
+		{
+			os << "Statistics are not collected by this build.\n";
+			return;
+		}
+		os << "Batches: " << stats.batches
+			<< ", wall time: " << stats.batch_ns << " ns"
+			<< ", emulated time: " << stats.budget_ns << " ns"
+			<< ", longest: " << stats.max_batch_ns << " ns\n"
+			<< "Frames: " << stats.frames << ", marks: " << stats.marks
+			<< ", draw stalls: " << stats.draw_stalls
+			<< ", key wait cycles: " << stats.key_wait_cycles
+			<< ", skipped cycles: " << stats.skipped_cycles << '\n'
+			<< "Instructions: " << stats.instructions() << '\n';
+		for (size_t i {0}; i < Chip8Stats::handlers; ++i)
+			if (stats.executed[i] != 0)
+				os << "  " << Chip8Stats::handler_names[i] << ": "
+					<< stats.executed[i] << '\n';
+	}
+}
+
+
+int main(int argc, char** argv)
+{
+	if (argc == 2 && std::string(argv[1]) == "--help")
+	{
+		std::cout << usage;
+		return 0;
+	}
+	Options opts;
+	try { opts = parse_args(argc, argv); }
+	catch (std::exception& e)
+	{
+		std::cerr << e.what() << '\n' << usage;
+		return 2;
+	}
+
+	NullDisplay null_disp;
+	NullSound null_snd;
+	RecordingKeyboard rec_key;
+	RecordingDisplay rec_disp;
+	RecordingSound rec_snd;
+	// Rendered offline, the stream never trails the VM by more than a batch.
+	Chip8Tone tone(48000, 48000);
+	Chip8Sound* sound {&null_snd};
+	if (opts.record) sound = &rec_snd;
+	else if (!opts.wav.empty()) sound = &tone;
+	// Without a keyboard delegate, no key is held on the VM's keypad.
+	Chip8 vm(opts.record ? static_cast<Chip8Keyboard*>(&rec_key) : nullptr,
+		opts.record ? static_cast<Chip8Display*>(&rec_disp) : &null_disp,
+		sound);
+	std::vector<int16_t> samples;
+	Chip8::_TimeType emulated {0};
+	Chip8InputLog log;
+
+	if (opts.replay.empty())
+	{
+		// Map the ROM, or the pack holding it, and load straight from that.
+		std::unique_ptr<Chip8MappedFile> rom_file;
+		std::unique_ptr<Chip8RomPack> pack;
+		std::span<const uint8_t> program;
+		try
+		{
+			if (opts.pack.empty())
+			{
+				rom_file = std::make_unique<Chip8MappedFile>(opts.rom);
+				program = rom_file->bytes();
+			}
+			else
+			{
+				pack = std::make_unique<Chip8RomPack>(opts.pack);
+				program = pack->find(std::stoull(opts.rom, nullptr, 16));
+			}
+		}
+		catch (std::exception& e)
+		{
+			std::cerr << "Unable to open ROM: " << opts.rom << " ("
+				<< e.what() << ")\n";
+			return 1;
+		}
+
+		vm.seed(opts.seed);
+		vm.platform(opts.platform.value_or(Chip8::detect_platform(program)));
+		try { vm.load_program(program); }
+		catch (std::invalid_argument& e)
+		{
+			std::cerr << "Failed to load program: " << e.what() << '\n';
+			return 1;
+		}
+		vm.frequency(opts.freq);
+	}
+	else
+	{
+		// The log brings its own state, frequency, and platform.
+		std::ifstream log_file(opts.replay, std::fstream::binary);
+		if (!log_file)
+		{
+			std::cerr << "Unable to open input log: " << opts.replay << '\n';
+			return 1;
+		}
+		try
+		{
+			log_file >> log;
+			log.start_replay(vm);
+		}
+		catch (std::exception& e)
+		{
+			std::cerr << "Failed to load input log: " << e.what() << '\n';
+			return 1;
+		}
+	}
+	vm.engine(opts.engine);
+	vm.access(opts.access);
+	Chip8Profiler profiler;
+	if (!opts.profile.empty()) vm.profiler(&profiler);
+
+	// Run a frame at a time, as the GUI does, so frames line up. A replay
+	// runs to the end of its log before that.
+	uint64_t cycles {opts.replay.empty() ? 0 : log.end_cycle() - vm.cycles()};
+	if (opts.time_ms == 0) cycles += opts.cycles;
+	Chip8::_TimeType remaining {vm.cycles_duration(cycles)};
+	if (opts.time_ms != 0)
+		remaining += std::chrono::milliseconds(opts.time_ms);
+	Chip8Pacer pacer;
+	pacer.mode(opts.pace);
+	pacer.factor(opts.factor);
+
+	int status {0};
+	auto start_time {std::chrono::steady_clock::now()};
+	try
+	{
+		while (remaining.count() > 0)
+		{
+			Chip8::_TimeType batch {std::min(remaining, pacer.begin_frame())};
+			vm.execute_batch(batch);
+			remaining -= batch;
+			if (!opts.wav.empty())
+			{
+				// Render the sound up to the end of the batch.
+				emulated += batch;
+				size_t rendered {samples.size()};
+				samples.resize(emulated.count() * tone.sample_rate()
+					/ Chip8::_billion);
+				tone.render(std::span(samples).subspan(rendered));
+			}
+			pacer.end_frame();
+		}
+	}
+	catch (Chip8Error& e)
+	{
+		std::cerr << "The VM has crashed with the following error: "
+			<< e.what() << '\n';
+		status = 1;
+	}
+	std::chrono::duration<double> wall
+		{std::chrono::steady_clock::now() - start_time};
+
+	std::cout << "Wall time: " << wall.count() << " s\n";
+	if (opts.record)
+	{
+		std::cout << "Display updates: " << rec_disp._marks << '\n'
+			<< "Sound starts: " << rec_snd._starts
+			<< ", stops: " << rec_snd._stops << '\n'
+			<< "Key tests:";
+		for (uint64_t tests : rec_key._tests) std::cout << ' ' << tests;
+		std::cout << '\n';
+	}
+	if (opts.screen) print_screen(std::cout, vm.get_screen());
+	if (opts.stats) print_stats(std::cout, vm.stats());
+
+	if (!opts.profile.empty())
+	{
+		vm.profiler(nullptr);
+		std::ofstream profile_file(opts.profile);
+		std::string name {opts.replay.empty() ? opts.rom : opts.replay};
+		try { profiler.write_callgrind(profile_file, name); }
+		catch (std::ios_base::failure& e)
+		{
+			std::cerr << "Failed to save profile: " << e.what() << '\n';
+			status = 1;
+		}
+	}
+
+	if (!opts.wav.empty())
+	{
+		std::ofstream wav_file(opts.wav,
+			std::ofstream::out | std::ofstream::binary);
+		try { tone.write_wav(wav_file, samples); }
+		catch (std::ios_base::failure& e)
+		{
+			std::cerr << "Failed to save sound: " << e.what() << '\n';
+			status = 1;
+		}
+	}
+
+	if (!opts.save.empty())
+	{
+		std::ofstream state_file(opts.save,
+			std::ofstream::out | std::ofstream::binary);
+		try { state_file << vm; }
+		catch (std::ios_base::failure& e)
+		{
+			std::cerr << "Failed to save state: " << e.what() << '\n';
+			status = 1;
+		}
+	}
+
+	return status;
+}
@@ -0,0 +1,128 @@
+#include "Chip8Screen.hpp"
+
+#include <algorithm>
+#include <initializer_list>
+
+
+unsigned Chip8Screen::width() const
+{
+	return hires ? 128 : 64;
+}
+
+
+unsigned Chip8Screen::height() const
+{
+	return hires ? 64 : 32;
+}
+
+
+void Chip8Screen::clear(uint8_t mask)
+{
+	for (size_t p {0}; p < planes; ++p)
+		if (mask & 1 << p) plane[p] = Plane();
+}
+
+
+bool Chip8Screen::draw(uint8_t mask, unsigned x, unsigned y,
+	const uint8_t* sprite, unsigned sprite_rows, bool wide)
+{
+	x %= width();
+	y %= height();
+	unsigned visible {std::min(sprite_rows, height() - y)};
+	unsigned stride {wide ? 2U : 1U};
+	uint64_t collided {0};
+
+	for (size_t p {0}; p < planes; ++p)
+	{
+		if (!(mask & 1 << p)) continue;
+		Plane& dst {plane[p]};
+		for (unsigned r {0}; r < visible; ++r)
+		{
+			// Line the sprite's row up with the left of the screen, then move
+			// it across the pair of words. Bits shifted past the right edge of
+			// the screen are lost, which clips the sprite.
+			uint64_t bits {wide
+				? uint64_t(sprite[r * 2]) << 56
+					| uint64_t(sprite[r * 2 + 1]) << 48
+				: uint64_t(sprite[r]) << 56};
+			uint64_t left {x < 64 ? bits >> x : 0};
+			uint64_t right {!hires || x == 0 ? 0
+				: x < 64 ? bits << (64 - x) : bits >> (x - 64)};
+			collided |= (dst.left[y + r] & left) | (dst.right[y + r] & right);
+			dst.left[y + r] ^= left;
+			dst.right[y + r] ^= right;
+		}
+		sprite += sprite_rows * stride;
+	}
+	return collided != 0;
+}
+
+
+void Chip8Screen::scroll_down(uint8_t mask, unsigned n)
+{
+	size_t h {height()};
+	n = std::min<unsigned>(n, h);
+	for (size_t p {0}; p < planes; ++p)
+	{
+		if (!(mask & 1 << p)) continue;
+		for (std::array<uint64_t, rows>* side
+			: {&plane[p].left, &plane[p].right})
+		{
+			std::copy_backward(side->begin(), side->begin() + h - n,
+				side->begin() + h);
+			std::fill_n(side->begin(), n, 0);
+		}
+	}
+}
+
+
+void Chip8Screen::scroll_up(uint8_t mask, unsigned n)
+{
+	size_t h {height()};
+	n = std::min<unsigned>(n, h);
+	for (size_t p {0}; p < planes; ++p)
+	{
+		if (!(mask & 1 << p)) continue;
+		for (std::array<uint64_t, rows>* side
+			: {&plane[p].left, &plane[p].right})
+		{
+			std::copy(side->begin() + n, side->begin() + h, side->begin());
+			std::fill_n(side->begin() + h - n, n, 0);
+		}
+	}
+}
+
+
+void Chip8Screen::scroll_right(uint8_t mask)
+{
+	for (size_t p {0}; p < planes; ++p)
+	{
+		if (!(mask & 1 << p)) continue;
+		Plane& dst {plane[p]};
+		// Low resolution rows are a single word, with nothing to carry into.
+		if (!hires)
+			for (size_t y {0}; y < 32; ++y) dst.left[y] >>= 4;
+		else for (size_t y {0}; y < rows; ++y)
+		{
+			dst.right[y] = dst.right[y] >> 4 | dst.left[y] << 60;
+			dst.left[y] >>= 4;
+		}
+	}
+}
+
+
+void Chip8Screen::scroll_left(uint8_t mask)
+{
+	for (size_t p {0}; p < planes; ++p)
+	{
+		if (!(mask & 1 << p)) continue;
+		Plane& dst {plane[p]};
+		if (!hires)
+			for (size_t y {0}; y < 32; ++y) dst.left[y] <<= 4;
+		else for (size_t y {0}; y < rows; ++y)
+		{
+			dst.left[y] = dst.left[y] << 4 | dst.right[y] >> 60;
+			dst.right[y] <<= 4;
+		}
+	}
+}
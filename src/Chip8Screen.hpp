@@ -0,0 +1,104 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+
+/**
+ * @brief Screen memory of a VM: two bitplanes of 128x64 pixels in the high
+ * resolution of SUPER-CHIP and XO-CHIP, or 64x32 in the low resolution of the
+ * original Chip-8, along with the drawing operations that work on whole rows.
+ *
+ * The left and right 64 pixels of each row are kept in separate arrays, so
+ * operations over the whole screen, such as scrolling, run over contiguous
+ * words that the compiler can vectorize. In low resolution only the left
+ * word of the first 32 rows is used, making the first plane's left array the
+ * same 32 words the original Chip-8 screen has always been.
+ */
+struct Chip8Screen
+{
+	// Number of bitplanes.
+	static constexpr size_t planes {2};
+	// Rows of screen memory, of which low resolution uses the first 32.
+	static constexpr size_t rows {64};
+
+	/**
+	 * @brief One bitplane. Bit 63 of a row's left word is its leftmost pixel.
+	 */
+	struct Plane
+	{
+		std::array<uint64_t, rows> left {};		// Left 64 pixels of each row.
+		std::array<uint64_t, rows> right {};	// Right 64 pixels of each row.
+	};
+
+	std::array<Plane, planes> plane;	// The bitplanes.
+	bool hires {false};					// Set in high resolution.
+
+	/**
+	 * @return The number of pixels across the screen.
+	 */
+	unsigned width() const;
+
+	/**
+	 * @return The number of pixels down the screen.
+	 */
+	unsigned height() const;
+
+	/**
+	 * @brief Clears planes of the screen.
+	 *
+	 * @param mask Bit p is set to clear plane p.
+	 */
+	void clear(uint8_t mask);
+
+	/**
+	 * @brief XORs a sprite onto planes of the screen, clipped at its edges.
+	 *
+	 * @param mask Bit p is set to draw on plane p.
+	 * @param x The column of the sprite's leftmost pixel, wrapped to the
+	 * width of the screen.
+	 * @param y The row of the sprite's top row, wrapped to the height of the
+	 * screen.
+	 * @param sprite The sprite's rows for the lowest plane drawn on, followed
+	 * by those for each higher one. The most significant bit of a row is its
+	 * leftmost pixel.
+	 * @param sprite_rows The number of rows the sprite has on each plane.
+	 * @param wide Set if each row is 16 pixels (two bytes), not 8.
+	 * @return true if any pixel that was set was cleared; false otherwise.
+	 */
+	bool draw(uint8_t mask, unsigned x, unsigned y, const uint8_t* sprite,
+		unsigned sprite_rows, bool wide);
+
+	/**
+	 * @brief Scrolls planes of the screen down, clearing the rows uncovered.
+	 *
+	 * @param mask Bit p is set to scroll plane p.
+	 * @param n The number of rows to scroll by.
+	 */
+	void scroll_down(uint8_t mask, unsigned n);
+
+	/**
+	 * @brief Scrolls planes of the screen up, clearing the rows uncovered.
+	 *
+	 * @param mask Bit p is set to scroll plane p.
+	 * @param n The number of rows to scroll by.
+	 */
+	void scroll_up(uint8_t mask, unsigned n);
+
+	/**
+	 * @brief Scrolls planes of the screen right by 4 pixels, clearing the
+	 * columns uncovered.
+	 *
+	 * @param mask Bit p is set to scroll plane p.
+	 */
+	void scroll_right(uint8_t mask);
+
+	/**
+	 * @brief Scrolls planes of the screen left by 4 pixels, clearing the
+	 * columns uncovered.
+	 *
+	 * @param mask Bit p is set to scroll plane p.
+	 */
+	void scroll_left(uint8_t mask);
+};
@@ -0,0 +1,42 @@
+#include "Chip8Stats.hpp"
+
+#include <numeric>
+
+
+// Ordered as Chip8's _Handler enumeration.
+const char* const Chip8Stats::handler_names[Chip8Stats::handlers]
+{
+	"in_invalid",
+	"in_clr",	"in_rts",	"in_jump",	"in_call",	"in_ske",	"in_skne",
+	"in_skre",	"in_load",	"in_add",	"in_move",	"in_or",	"in_and",
+	"in_xor",	"in_addr",	"in_sub",	"in_shr",	"in_suba",	"in_shl",
+	"in_skrne",	"in_loadi",	"in_jumpi",	"in_rand",	"in_draw",	"in_skpr",
+	"in_skup",	"in_moved",	"in_keyd",	"in_loadd",	"in_loads",	"in_addi",
+	"in_ldspr",	"in_bcd",	"in_stor",	"in_read",
+	"in_scd",	"in_scu",	"in_scr",	"in_scl",
+	"in_low",	"in_high",	"in_plane",	"in_ldbig",
+};
+
+
+uint64_t Chip8Stats::instructions() const
+{
+	return std::accumulate(executed.begin(), executed.end(), uint64_t {0});
+}
+
+
+void Chip8StatsBuffer::publish(const Chip8Stats& stats)
+{
+	_stats[_back] = stats;
+	// Releases the statistics to the reader and takes back whichever buffer
+	// it isn't holding.
+	_back = _middle.exchange(_back | _Fresh, std::memory_order_acq_rel)
+		& ~_Fresh;
+}
+
+
+const Chip8Stats& Chip8StatsBuffer::latest()
+{
+	if (_middle.load(std::memory_order_relaxed) & _Fresh)
+		_front = _middle.exchange(_front, std::memory_order_acq_rel) & ~_Fresh;
+	return _stats[_front];
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+
+/**
+ * @brief Counters of what a VM has done since it was constructed, collected
+ * only when the core is built with CHIP8_INSTRUMENT defined (the
+ * CHIP8_INSTRUMENT CMake option). Otherwise every counter stays 0 and none of
+ * them costs anything to maintain.
+ */
+struct Chip8Stats
+{
+#ifdef CHIP8_INSTRUMENT
+	// Set if the core collects statistics.
+	static constexpr bool enabled {true};
+#else
+	// Set if the core collects statistics.
+	static constexpr bool enabled {false};
+#endif
+	// Number of instruction implementing functions counted in executed.
+	static constexpr size_t handlers {43};
+	// Name of each instruction implementing function, in executed's order.
+	static const char* const handler_names[handlers];
+
+	// Times each instruction implementing function was called.
+	std::array<uint64_t, handlers> executed {};
+	uint64_t batches {0};			// Calls to execute_batch().
+	uint64_t batch_ns {0};			// Wall time spent executing batches.
+	uint64_t budget_ns {0};			// Emulated time given to those batches.
+	uint64_t last_batch_ns {0};		// Wall time of the latest batch.
+	uint64_t last_budget_ns {0};	// Emulated time given to the latest batch.
+	uint64_t max_batch_ns {0};		// Wall time of the longest batch.
+	uint64_t frames {0};			// 60Hz timer ticks, which end frames.
+	uint64_t marks {0};				// Calls to the display's mark().
+	uint64_t draw_stalls {0};		// DXYN retried to wait for a tick.
+	uint64_t key_wait_cycles {0};	// Cycles spent waiting in FX0A.
+	uint64_t skipped_cycles {0};	// Idle cycles fast forwarded through.
+
+	/**
+	 * @return The number of instructions executed.
+	 */
+	uint64_t instructions() const;
+};
+
+
+/**
+ * @brief Hands statistics from the thread running a VM to a single reader,
+ * without either side ever blocking the other. Triple buffered in the same
+ * way as Chip8FrameBuffer.
+ */
+class Chip8StatsBuffer
+{
+public:
+	/**
+	 * @brief Publishes statistics. Must not be called by more than one thread
+	 * at a time.
+	 *
+	 * @param stats The statistics to publish.
+	 */
+	void publish(const Chip8Stats& stats);
+
+	/**
+	 * @brief Takes the most recently published statistics. Must not be called
+	 * by more than one thread at a time.
+	 *
+	 * @return The statistics, which are left untouched by the writer until the
+	 * next call.
+	 */
+	const Chip8Stats& latest();
+
+protected:
+	// Set in _middle if it holds statistics the reader hasn't taken.
+	static constexpr uint8_t _Fresh {0x4};
+
+	std::array<Chip8Stats, 3> _stats;		// The three buffers.
+	uint8_t _back {0};						// Buffer owned by the writer.
+	std::atomic<uint8_t> _middle {1};		// Buffer being handed over.
+	uint8_t _front {2};						// Buffer owned by the reader.
+};
@@ -0,0 +1,158 @@
+#include "Chip8Stream.hpp"
+
+#include <stdexcept>
+
+
+namespace
+{
+	/**
+	 * @brief Appends value to out as little endian.
+	 */
+	template <typename T>
+	inline void put(std::vector<uint8_t>& out, T value)
+	{
+		uint64_t bits {static_cast<uint64_t>(value)};
+		for (size_t i = 0; i < sizeof(T); ++i)
+			out.push_back(static_cast<uint8_t>(bits >> 8 * i));
+	}
+
+
+	/**
+	 * @return The little endian value at in, advancing in past it.
+	 */
+	template <typename T>
+	inline T get(const uint8_t*& in)
+	{
+		uint64_t value {0};
+		for (size_t i = 0; i < sizeof(T); ++i)
+			value |= static_cast<uint64_t>(*in++) << 8 * i;
+		return static_cast<T>(value);
+	}
+
+
+	// Bit of a row's index set for the second plane.
+	constexpr uint8_t plane_bit {0x80};
+	// Bit of a row's index set for the right half of the row.
+	constexpr uint8_t right_bit {0x40};
+	// Bit of a key message's key set if it was pressed.
+	constexpr uint8_t pressed_bit {0x80};
+}
+
+
+Chip8Stream::Chip8Stream(unsigned keyframe_interval)
+	: _interval(keyframe_interval)
+{
+	if (keyframe_interval == 0)
+		throw std::invalid_argument("Invalid keyframe interval.");
+}
+
+
+bool Chip8Stream::encode(const Chip8Screen& screen, uint64_t tick,
+	std::vector<uint8_t>& out)
+{
+	// Changing resolution clears the screen, so is sent as a keyframe.
+	bool key {_key_wanted.exchange(false, std::memory_order_relaxed)
+		|| ++_since_key >= _interval || screen.hires != _sent.hires};
+	if (key)
+	{
+		_since_key = 0;
+		_sent = Chip8Screen();
+	}
+
+	out.clear();
+	out.push_back(frame_type);
+	out.push_back(static_cast<uint8_t>((key ? _Keyframe : 0)
+		| (screen.hires ? _Hires : 0)));
+	put<uint64_t>(out, tick);
+	put<uint16_t>(out, 0);	// Filled in once the rows are counted.
+	uint16_t count {0};
+	for (size_t p {0}; p < Chip8Screen::planes; ++p)
+	{
+		const Chip8Screen::Plane& plane {screen.plane[p]};
+		const Chip8Screen::Plane& sent {_sent.plane[p]};
+		for (uint8_t y {0}; y < Chip8Screen::rows; ++y)
+		{
+			uint8_t index {static_cast<uint8_t>(y | (p ? plane_bit : 0))};
+			if (plane.left[y] != sent.left[y])
+			{
+				out.push_back(index);
+				put<uint64_t>(out, plane.left[y]);
+				++count;
+			}
+			if (plane.right[y] != sent.right[y])
+			{
+				out.push_back(index | right_bit);
+				put<uint64_t>(out, plane.right[y]);
+				++count;
+			}
+		}
+	}
+	_sent = screen;
+	if (count == 0 && !key)
+	{
+		out.clear();
+		return false;
+	}
+	out[frame_header_size - 2] = static_cast<uint8_t>(count);
+	out[frame_header_size - 1] = static_cast<uint8_t>(count >> 8);
+	return true;
+}
+
+
+void Chip8Stream::request_keyframe()
+{
+	_key_wanted.store(true, std::memory_order_relaxed);
+}
+
+
+size_t Chip8Stream::decode_frame(std::span<const uint8_t> in,
+	Chip8Screen& screen, uint64_t& tick)
+{
+	if (!in.empty() && in[0] != frame_type)
+		throw std::invalid_argument("Not a frame message.");
+	if (in.size() < frame_header_size) return 0;
+	const uint8_t* pos {in.data() + 1};
+	uint8_t flags {*pos++};
+	uint64_t frame_tick {get<uint64_t>(pos)};
+	uint16_t count {get<uint16_t>(pos)};
+	if (count > (max_frame_size - frame_header_size) / row_size)
+		throw std::invalid_argument("Frame has too many rows.");
+	size_t size {frame_header_size + count * row_size};
+	if (in.size() < size) return 0;
+
+	if (flags & _Keyframe) screen = Chip8Screen();
+	screen.hires = (flags & _Hires) != 0;
+	for (uint16_t i {0}; i < count; ++i)
+	{
+		uint8_t index {*pos++};
+		uint64_t row {get<uint64_t>(pos)};
+		Chip8Screen::Plane& plane {screen.plane[index & plane_bit ? 1 : 0]};
+		uint8_t y {static_cast<uint8_t>(index & (Chip8Screen::rows - 1))};
+		if (index & right_bit) plane.right[y] = row;
+		else plane.left[y] = row;
+	}
+	tick = frame_tick;
+	return size;
+}
+
+
+void Chip8Stream::encode_key(uint8_t key, bool pressed,
+	std::vector<uint8_t>& out)
+{
+	out.push_back(key_type);
+	out.push_back(static_cast<uint8_t>(key | (pressed ? pressed_bit : 0)));
+}
+
+
+size_t Chip8Stream::decode_key(std::span<const uint8_t> in, uint8_t& key,
+	bool& pressed)
+{
+	if (!in.empty() && in[0] != key_type)
+		throw std::invalid_argument("Not a key message.");
+	if (in.size() < key_size) return 0;
+	if ((in[1] & ~pressed_bit) > 0xf)
+		throw std::invalid_argument("Key value too large.");
+	key = in[1] & ~pressed_bit;
+	pressed = (in[1] & pressed_bit) != 0;
+	return key_size;
+}
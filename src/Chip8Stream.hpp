@@ -0,0 +1,118 @@
+#pragma once
+
+#include "Chip8Screen.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+
+/**
+ * @brief Encodes the frames of a VM's screen for remote viewers as the rows
+ * that changed since the frame before, and decodes the key presses viewers
+ * send back. Has no dependency on how the messages are carried.
+ *
+ * A frame message is the byte 'F', a byte of flags (bit 0 set for a
+ * keyframe, bit 1 in high resolution), the 64 bit tick the frame ended on,
+ * and a 16 bit count of rows, each a byte of its index (bit 7 set for the
+ * second plane, bit 6 for the right half of the row, and bits 0-5 its row)
+ * followed by its 64 bits of pixels as in Chip8Screen. A keyframe clears the
+ * screen before its rows are drawn, so lists only those with pixels set; any
+ * other frame lists every row that changed. A key message is the byte 'K'
+ * followed by a byte of the key, with bit 7 set if it was pressed or unset if
+ * released. Values are little endian.
+ */
+class Chip8Stream
+{
+public:
+	// First byte of a frame message.
+	static constexpr uint8_t frame_type {'F'};
+	// First byte of a key message.
+	static constexpr uint8_t key_type {'K'};
+	// Size of a frame message before its rows.
+	static constexpr size_t frame_header_size {12};
+	// Size of each row of a frame message.
+	static constexpr size_t row_size {9};
+	// Size of a key message.
+	static constexpr size_t key_size {2};
+	// Size of the largest frame message, a keyframe with every row set.
+	static constexpr size_t max_frame_size {frame_header_size
+		+ Chip8Screen::planes * Chip8Screen::rows * 2 * row_size};
+
+	/**
+	 * @brief Construct a new Chip8Stream.
+	 *
+	 * @param keyframe_interval The number of frames encoded from one
+	 * keyframe to the next, so a viewer that missed a frame catches up.
+	 * @throws std::invalid_argument if keyframe_interval is 0.
+	 */
+	Chip8Stream(unsigned keyframe_interval = 60);
+
+	/**
+	 * @brief Encodes a frame as the changes from the last one encoded, or as
+	 * a keyframe if one is due. Must not be called by more than one thread at
+	 * a time.
+	 *
+	 * @param screen The screen at the end of the frame.
+	 * @param tick The 60Hz tick the frame ended on, as from Chip8::ticks().
+	 * @param out Set to the message, leaving its capacity to be reused.
+	 * @return true if a message was encoded; false if nothing changed.
+	 */
+	bool encode(const Chip8Screen& screen, uint64_t tick,
+		std::vector<uint8_t>& out);
+
+	/**
+	 * @brief Makes the next frame encoded a keyframe, such as when a viewer
+	 * joins or frames have been dropped. May be called from any thread.
+	 */
+	void request_keyframe();
+
+	/**
+	 * @brief Applies the frame message at the start of the passed bytes to a
+	 * screen.
+	 *
+	 * @param in The bytes received, which may end partway through a message.
+	 * @param screen The screen to apply the frame to.
+	 * @param tick Set to the tick the frame ended on.
+	 * @return The size of the message, or 0 if in doesn't hold all of it, in
+	 * which case the screen is untouched.
+	 * @throws std::invalid_argument if the bytes aren't a valid frame message.
+	 */
+	static size_t decode_frame(std::span<const uint8_t> in,
+		Chip8Screen& screen, uint64_t& tick);
+
+	/**
+	 * @brief Appends a key message to the passed bytes.
+	 *
+	 * @param key The value of the key.
+	 * @param pressed Set if the key was pressed; unset if released.
+	 * @param out The bytes to append to.
+	 */
+	static void encode_key(uint8_t key, bool pressed,
+		std::vector<uint8_t>& out);
+
+	/**
+	 * @brief Reads the key message at the start of the passed bytes.
+	 *
+	 * @param in The bytes received, which may end partway through a message.
+	 * @param key Set to the value of the key.
+	 * @param pressed Set if the key was pressed; unset if released.
+	 * @return The size of the message, or 0 if in doesn't hold all of it.
+	 * @throws std::invalid_argument if the bytes aren't a valid key message.
+	 */
+	static size_t decode_key(std::span<const uint8_t> in, uint8_t& key,
+		bool& pressed);
+
+protected:
+	// Set in the flags of a keyframe.
+	static constexpr uint8_t _Keyframe {0x1};
+	// Set in the flags of a frame in high resolution.
+	static constexpr uint8_t _Hires {0x2};
+
+	unsigned _interval;			// Frames from one keyframe to the next.
+	unsigned _since_key {0};	// Frames encoded since the last keyframe.
+	Chip8Screen _sent;			// The screen as of the last frame encoded.
+	std::atomic<bool> _key_wanted {true};	// Set if a keyframe is due.
+};
@@ -0,0 +1,232 @@
+#include "Chip8Tone.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+
+namespace
+{
+	/**
+	 * @brief Stores value at out as little endian and advances out past it.
+	 */
+	template <typename T>
+	inline void put(uint8_t*& out, T value)
+	{
+		uint64_t bits {static_cast<uint64_t>(value)};
+		for (size_t i = 0; i < sizeof(T); ++i)
+			*out++ = static_cast<uint8_t>(bits >> 8 * i);
+	}
+
+
+	// Size of the header of a WAV file with a single PCM format chunk.
+	constexpr size_t wav_header_size {44};
+}
+
+
+Chip8Tone::Chip8Tone(unsigned sample_rate, unsigned latency)
+	: _rate(sample_rate), _latency(latency)
+{
+	if (sample_rate == 0 || latency == 0)
+		throw std::invalid_argument("Invalid sample rate or latency.");
+	// Four bits high and four low, eight times over.
+	_bits.fill(0xf0);
+	_bits_rate = 3520.0f;
+	_voice.bits = _bits;
+	_voice.step = double(_bits_rate) / _rate;
+}
+
+
+void Chip8Tone::start_sound()
+{
+	_sounding.store(true, std::memory_order_relaxed);
+	push(Event::start);
+}
+
+
+void Chip8Tone::stop_sound()
+{
+	_sounding.store(false, std::memory_order_relaxed);
+	push(Event::stop);
+}
+
+
+void Chip8Tone::pattern(const Pattern& bits, float rate)
+{
+	_bits = bits;
+	_bits_rate = rate;
+	push(Event::change);
+}
+
+
+float Chip8Tone::pitch_rate(uint8_t pitch)
+{
+	return 4000.0f * std::exp2((pitch - 64) / 48.0f);
+}
+
+
+void Chip8Tone::render(std::span<int16_t> out)
+{
+	// Events were dropped, so only whether the tone is on can be caught up.
+	if (_overflow.exchange(false, std::memory_order_acquire))
+	{
+		_tail.store(_head.load(std::memory_order_acquire),
+			std::memory_order_release);
+		_voice.on = _sounding.load(std::memory_order_relaxed);
+	}
+
+	size_t done {0};
+	while (done < out.size())
+	{
+		uint64_t count {out.size() - done};
+		size_t tail {_tail.load(std::memory_order_relaxed)};
+		if (tail != _head.load(std::memory_order_acquire))
+		{
+			const Event& event {_ring[tail % _Ring_Size]};
+			uint64_t at {tick_sample(event.tick)};
+			if (at < _position || at - _position > 2 * _latency)
+				_position = at - std::min(at, _latency);
+			if (at == _position)
+			{
+				apply(_voice, event);
+				_tail.store(tail + 1, std::memory_order_release);
+				continue;
+			}
+			count = std::min(count, at - _position);
+		}
+
+		std::span<int16_t> part {out.subspan(done, count)};
+		if (_voice.on && !_paused.load(std::memory_order_relaxed))
+			synthesize(_voice, part);
+		else std::fill(part.begin(), part.end(), 0);
+		done += count;
+		_position += count;
+	}
+}
+
+
+void Chip8Tone::pause(bool value)
+{
+	_paused.store(value, std::memory_order_relaxed);
+}
+
+
+bool Chip8Tone::sounding()
+{
+	return _sounding.load(std::memory_order_relaxed);
+}
+
+
+unsigned Chip8Tone::sample_rate()
+{
+	return _rate;
+}
+
+
+std::vector<int16_t> Chip8Tone::loop(size_t samples)
+{
+	Voice voice;
+	voice.bits = _bits;
+	voice.step = double(_bits_rate) / _rate;
+	std::vector<int16_t> out(samples);
+	synthesize(voice, out);
+	return out;
+}
+
+
+void Chip8Tone::write_wav(std::ostream& os, std::span<const int16_t> samples)
+{
+	size_t data_size {samples.size() * sizeof(int16_t)};
+	std::vector<uint8_t> buffer(wav_header_size + data_size);
+	uint8_t* out {buffer.data()};
+	auto tag = [&](const char* name)
+	{
+		std::copy_n(name, 4, out);
+		out += 4;
+	};
+	tag("RIFF");
+	put<uint32_t>(out, wav_header_size - 8 + data_size);
+	tag("WAVE");
+	tag("fmt ");
+	put<uint32_t>(out, 16);				// Size of the format chunk.
+	put<uint16_t>(out, 1);				// PCM.
+	put<uint16_t>(out, 1);				// Mono.
+	put<uint32_t>(out, _rate);
+	put<uint32_t>(out, _rate * sizeof(int16_t));	// Bytes per second.
+	put<uint16_t>(out, sizeof(int16_t));			// Bytes per sample.
+	put<uint16_t>(out, 16);				// Bits per sample.
+	tag("data");
+	put<uint32_t>(out, data_size);
+	for (int16_t sample : samples) put<uint16_t>(out, sample);
+
+	std::ios_base::iostate prev_state = os.exceptions();
+	os.exceptions(std::istream::failbit);
+	try
+	{
+		os.write(reinterpret_cast<char*>(buffer.data()), buffer.size());
+	}
+	catch (std::ios_base::failure& e)
+	{
+		os.exceptions(prev_state);
+		throw e;
+	}
+	os.exceptions(prev_state);
+}
+
+
+void Chip8Tone::push(Event::Kind kind)
+{
+	size_t head {_head.load(std::memory_order_relaxed)};
+	if (head - _tail.load(std::memory_order_acquire) == _Ring_Size)
+	{
+		_overflow.store(true, std::memory_order_release);
+		return;
+	}
+	Event& event {_ring[head % _Ring_Size]};
+	event.tick = _vm->ticks();
+	event.kind = kind;
+	if (kind == Event::change)
+	{
+		event.rate = _bits_rate;
+		event.bits = _bits;
+	}
+	_head.store(head + 1, std::memory_order_release);
+}
+
+
+void Chip8Tone::apply(Voice& voice, const Event& event)
+{
+	switch (event.kind)
+	{
+		case Event::start:
+			voice.on = true;
+			break;
+		case Event::stop:
+			voice.on = false;
+			break;
+		default:
+			voice.bits = event.bits;
+			voice.step = double(event.rate) / _rate;
+			break;
+	}
+}
+
+
+void Chip8Tone::synthesize(Voice& voice, std::span<int16_t> out)
+{
+	constexpr double period {pattern_size * 8};
+	for (int16_t& sample : out)
+	{
+		size_t bit {static_cast<size_t>(voice.phase)};
+		bool high {(voice.bits[bit / 8] >> (7 - bit % 8) & 1) != 0};
+		sample = high ? _Amplitude : -_Amplitude;
+		voice.phase += voice.step;
+		while (voice.phase >= period) voice.phase -= period;
+	}
+}
+
+
+uint64_t Chip8Tone::tick_sample(uint64_t tick)
+{
+	return tick * _rate / 60;
+}
@@ -0,0 +1,188 @@
+#pragma once
+
+#include "Chip8.hpp"
+#include "Chip8Observers.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+#include <span>
+#include <vector>
+
+
+/**
+ * @brief Sound output for the Chip-8 VM that synthesizes its tone on the fly,
+ * as a stream of 16-bit mono samples pulled by an audio callback.
+ *
+ * The tone is a pattern of 128 bits played back at a given rate, which is a
+ * square wave by default and can be swapped for XO-CHIP's pattern buffer and
+ * pitch. Starting and stopping the tone, and changing its pattern, are passed
+ * from the VM's thread to the callback through a fixed ring of events, each
+ * stamped with the timer tick it happened on. The callback applies each at
+ * the sample that tick maps to, so sounds last exactly as long as the VM
+ * played them for, however the batches that played them were split.
+ *
+ * The stream is kept a fixed latency behind the VM's ticks. An event that
+ * arrives too late for its sample, as after the VM was paused or fell behind,
+ * or too far ahead, as when running faster than real time, moves the stream
+ * to that latency from it.
+ *
+ * start_sound(), stop_sound(), and pattern() must be called from the thread
+ * running the VM, render() from a single audio thread, and the rest from
+ * either.
+ */
+class Chip8Tone : public Chip8Sound
+{
+public:
+	// Bytes in a tone pattern, as in XO-CHIP's pattern buffer.
+	static constexpr size_t pattern_size {16};
+
+	typedef std::array<uint8_t, pattern_size> Pattern;
+
+	/**
+	 * @brief Construct a new Chip8Tone, playing a 440Hz square wave.
+	 *
+	 * @param sample_rate The rate samples are rendered at, in Hz.
+	 * @param latency How many samples the stream is kept behind the VM. Must
+	 * cover a frame of batches and the audio device's buffer.
+	 * @throws std::invalid_argument if either is 0.
+	 */
+	Chip8Tone(unsigned sample_rate = 48000, unsigned latency = 1200);
+
+	/**
+	 * @brief Start producing the tone, from the VM's current tick.
+	 */
+	void start_sound() override;
+
+	/**
+	 * @brief Stop producing the tone, from the VM's current tick.
+	 */
+	void stop_sound() override;
+
+	/**
+	 * @brief Change the tone played from the VM's current tick.
+	 *
+	 * @param bits The pattern to play, most significant bit of the first byte
+	 * first, with set bits high and unset bits low.
+	 * @param rate The number of bits played per second.
+	 */
+	void pattern(const Pattern& bits, float rate);
+
+	/**
+	 * @return The playback rate XO-CHIP's pitch register selects:
+	 * 4000 * 2 ^ ((pitch - 64) / 48) bits per second.
+	 */
+	static float pitch_rate(uint8_t pitch);
+
+	/**
+	 * @brief Fills a buffer with the next samples of the stream, as an audio
+	 * callback does. Never blocks or allocates.
+	 *
+	 * @param out The buffer to fill.
+	 */
+	void render(std::span<int16_t> out);
+
+	/**
+	 * @brief Pause or resume the stream, which renders silence while paused.
+	 *
+	 * @param value Set to pause; unset to resume.
+	 */
+	void pause(bool value);
+
+	/**
+	 * @return true if the VM last started the tone; false if it last stopped
+	 * it.
+	 */
+	bool sounding();
+
+	/**
+	 * @return The rate samples are rendered at, in Hz.
+	 */
+	unsigned sample_rate();
+
+	/**
+	 * @brief Renders the current tone for as long as it is on, starting at
+	 * the beginning of its pattern, for hosts that can only loop a buffer.
+	 * Doesn't affect the stream.
+	 *
+	 * @param samples The number of samples to render.
+	 * @return The samples.
+	 */
+	std::vector<int16_t> loop(size_t samples);
+
+	/**
+	 * @brief Writes samples to a stream as a 16-bit mono WAV file at the
+	 * sample rate.
+	 *
+	 * @param os The stream to write to.
+	 * @param samples The samples to write.
+	 * @throws std::ios_base::failure if writing to the stream failed.
+	 */
+	void write_wav(std::ostream& os, std::span<const int16_t> samples);
+
+protected:
+	/**
+	 * @brief A change to the tone at a timer tick.
+	 */
+	struct Event
+	{
+		enum Kind : uint8_t { start, stop, change };
+
+		uint64_t	tick;	// Tick of the VM the change happened on.
+		Kind		kind;	// What changed.
+		float		rate;	// The new playback rate, for a change.
+		Pattern		bits;	// The new pattern, for a change.
+	};
+
+	/**
+	 * @brief The tone as the audio thread plays it.
+	 */
+	struct Voice
+	{
+		Pattern	bits;			// Pattern being played.
+		double	step {0};		// Pattern bits advanced per sample.
+		double	phase {0};		// Position in the pattern, in bits.
+		bool	on {false};		// Set while the tone is started.
+	};
+
+	// Number of events the ring holds. A power of two.
+	static constexpr size_t _Ring_Size {64};
+	// Amplitude of the tone's samples.
+	static constexpr int16_t _Amplitude {0x1800};
+
+	const unsigned _rate;			// Samples per second.
+	const uint64_t _latency;		// Samples the stream trails the VM by.
+	std::array<Event, _Ring_Size> _ring;	// Events not yet applied.
+	std::atomic<size_t> _head {0};	// Events pushed, written by the VM.
+	std::atomic<size_t> _tail {0};	// Events applied, written by render().
+	std::atomic<bool> _overflow {false};	// Set if an event was dropped.
+	std::atomic<bool> _paused {false};		// Set while rendering silence.
+	std::atomic<bool> _sounding {false};	// Set if the tone was started.
+	Pattern _bits;					// Latest pattern, kept by the VM side.
+	float _bits_rate;				// Latest playback rate.
+	Voice _voice;					// Owned by render().
+	uint64_t _position {0};			// Sample render() is at.
+
+	/**
+	 * @brief Adds an event to the ring, stamped with the VM's current tick.
+	 * If the ring is full the event is dropped, and render() is told to catch
+	 * up with the latest state instead.
+	 */
+	void push(Event::Kind kind);
+
+	/**
+	 * @brief Applies an event to a voice.
+	 */
+	void apply(Voice& voice, const Event& event);
+
+	/**
+	 * @brief Synthesizes samples of a voice, advancing its phase.
+	 */
+	void synthesize(Voice& voice, std::span<int16_t> out);
+
+	/**
+	 * @return The sample a tick of the VM maps to.
+	 */
+	uint64_t tick_sample(uint64_t tick);
+};
@@ -0,0 +1,344 @@
+// Conformance checker for the Chip-8 VM. Runs every ROM listed in a manifest
+// for a fixed number of cycles on each engine, in parallel on a
+// Chip8BatchRunner, and compares the fingerprint of the screen and registers
+// each leaves behind against the known good one.
+
+#include "Chip8.hpp"
+#include "Chip8BatchRunner.hpp"
+#include "Chip8Compiled.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+namespace
+{
+	const char* usage
+	{
+		"Usage: chip8-verify [options] MANIFEST\n"
+		"Options:\n"
+		"  --freq HZ        Instruction cycle frequency, up to 1000000000\n"
+		"                   (default 1200).\n"
+		"  --threads N      Threads to run on (default one per hardware\n"
+		"                   thread).\n"
+		"  --update         Print the manifest with the fingerprints each\n"
+		"                   ROM produced, to replace it once they are known\n"
+		"                   to be good.\n"
+		"Each line of the manifest is a check, of the form\n"
+		"  FINGERPRINT CYCLES PLATFORM [+K@N|-K@N]... PATH\n"
+		"where FINGERPRINT is in hexadecimal (or - if not yet known),\n"
+		"PLATFORM is chip8, chip48, schip, xochip, or auto, +K@N and -K@N\n"
+		"press and release hexadecimal key K once N cycles have run, and\n"
+		"PATH is relative to the manifest. Blank lines and lines starting\n"
+		"with # are ignored.\n"
+	};
+
+
+	/**
+	 * @brief A ROM of the manifest and the fingerprint it should leave.
+	 */
+	struct Check
+	{
+		size_t		line {0};			// Index of its line in the manifest.
+		std::string	path;				// Path of the ROM, as written.
+		bool		known {false};		// Set if expected is known.
+		uint64_t	expected {0};		// The fingerprint to match.
+		Chip8Job	job;				// The job run for each engine.
+	};
+
+
+	/**
+	 * @return The platform of the passed name, or of the ROM if it is auto.
+	 * @throws std::invalid_argument if the name isn't that of a platform.
+	 */
+	Chip8::Platform parse_platform(const std::string& name,
+		const std::string& rom)
+	{
+		if (name == "chip8") return Chip8::Platform::chip8;
+		if (name == "chip48") return Chip8::Platform::chip48;
+		if (name == "schip") return Chip8::Platform::schip;
+		if (name == "xochip") return Chip8::Platform::xochip;
+		if (name == "auto")
+			return Chip8::detect_platform(std::span<const uint8_t>(
+				reinterpret_cast<const uint8_t*>(rom.data()), rom.size()));
+		throw std::invalid_argument("Unknown platform: " + name);
+	}
+
+
+	/**
+	 * @brief Parses a key event of the form +K@N or -K@N.
+	 * @throws std::invalid_argument if the event is malformed.
+	 */
+	Chip8KeyEvent parse_key(const std::string& token)
+	{
+		if (token.size() < 4 || (token[0] != '+' && token[0] != '-')
+			|| !std::isxdigit(static_cast<unsigned char>(token[1]))
+			|| token[2] != '@'
+			|| !std::isdigit(static_cast<unsigned char>(token[3])))
+			throw std::invalid_argument("Malformed key event: " + token);
+		size_t end;
+		uint64_t cycle {std::stoull(token.substr(3), &end)};
+		if (end != token.size() - 3)
+			throw std::invalid_argument("Malformed key event: " + token);
+		uint8_t key {static_cast<uint8_t>(std::stoul(token.substr(1, 1),
+			nullptr, 16))};
+		return {cycle, key, token[0] == '+'};
+	}
+
+
+	/**
+	 * @brief Reads the checks of a manifest, loading each ROM it names.
+	 *
+	 * @param path The path of the manifest.
+	 * @param freq The frequency to run each ROM at.
+	 * @param lines Set to the lines of the manifest, for --update.
+	 * @return The checks, in the order they are listed.
+	 * @throws std::invalid_argument if the manifest is malformed or a ROM
+	 * can't be read.
+	 */
+	std::vector<Check> read_manifest(const std::string& path, uint32_t freq,
+		std::vector<std::string>& lines)
+	{
+		std::ifstream manifest(path);
+		if (!manifest)
+			throw std::invalid_argument("Unable to open manifest: " + path);
+		std::filesystem::path base {std::filesystem::path(path).parent_path()};
+
+		std::vector<Check> checks;
+		std::string line;
+		while (std::getline(manifest, line))
+		{
+			lines.push_back(line);
+			size_t number {lines.size()};
+			std::istringstream fields(line);
+			std::string fingerprint;
+			if (!(fields >> fingerprint) || fingerprint.starts_with('#'))
+				continue;
+
+			auto fail = [&](const std::string& reason)
+			{
+				return std::invalid_argument(path + ":"
+					+ std::to_string(number) + ": " + reason);
+			};
+			Check check;
+			check.line = number - 1;
+			std::string cycles, platform;
+			if (!(fields >> cycles >> platform))
+				throw fail("Expected a fingerprint, cycles, and platform.");
+			try
+			{
+				if (fingerprint != "-")
+				{
+					size_t end;
+					check.expected = std::stoull(fingerprint, &end, 16);
+					if (end != fingerprint.size())
+						throw std::invalid_argument(fingerprint);
+					check.known = true;
+				}
+				check.job.cycles = std::stoull(cycles);
+			}
+			catch (std::logic_error&)
+			{
+				throw fail("Malformed fingerprint or cycles.");
+			}
+
+			// Key events come before the path, which takes up the rest of the
+			// line.
+			fields >> std::ws;
+			while (fields.peek() == '+' || fields.peek() == '-')
+			{
+				std::string token;
+				fields >> token >> std::ws;
+				try { check.job.input.push_back(parse_key(token)); }
+				catch (std::logic_error&)
+				{
+					throw fail("Malformed key event: " + token);
+				}
+			}
+			std::getline(fields, check.path);
+			while (!check.path.empty() && std::isspace(
+				static_cast<unsigned char>(check.path.back())))
+				check.path.pop_back();
+			if (check.path.empty()) throw fail("Missing the path of a ROM.");
+			std::stable_sort(check.job.input.begin(), check.job.input.end(),
+				[](const Chip8KeyEvent& a, const Chip8KeyEvent& b)
+				{
+					return a.cycle < b.cycle;
+				});
+
+			std::ifstream rom_file(base / check.path, std::fstream::binary);
+			if (!rom_file) throw fail("Unable to open ROM: " + check.path);
+			std::stringstream sstr;
+			sstr << rom_file.rdbuf();
+			auto program {std::make_shared<const std::string>(sstr.str())};
+			try { check.job.platform = parse_platform(platform, *program); }
+			catch (std::invalid_argument& e) { throw fail(e.what()); }
+			check.job.program = program;
+			check.job.freq = freq;
+			checks.push_back(std::move(check));
+		}
+		return checks;
+	}
+
+
+	/**
+	 * @return The fingerprint formatted as it is in a manifest.
+	 */
+	std::string hex(uint64_t fingerprint)
+	{
+		std::ostringstream os;
+		os << std::hex << std::setw(16) << std::setfill('0') << fingerprint;
+		return os.str();
+	}
+
+
+	/**
+	 * @return The name of an engine, as in the output.
+	 */
+	const char* engine_name(Chip8::Engine engine)
+	{
+		switch (engine)
+		{
+			case Chip8::Engine::block_cache: return "block";
+			case Chip8::Engine::compiled: return "compiled";
+			default: return "interpreter";
+		}
+	}
+}
+
+
+int main(int argc, char** argv)
+{
+	if (argc == 2 && std::string(argv[1]) == "--help")
+	{
+		std::cout << usage;
+		return 0;
+	}
+	std::string manifest;
+	uint32_t freq {1200};
+	size_t threads {0};
+	bool update {false};
+	std::vector<Check> checks;
+	std::vector<std::string> lines;
+
+	try
+	{
+		for (int i {1}; i < argc; ++i)
+		{
+			std::string arg {argv[i]};
+			auto value = [&]() -> std::string
+			{
+				if (i + 1 >= argc)
+					throw std::invalid_argument("Missing value for " + arg);
+				return argv[++i];
+			};
+
+			if (arg == "--freq")
+			{
+				unsigned long value_hz {std::stoul(value())};
+				if (value_hz == 0 || value_hz > Chip8::max_frequency)
+					throw std::invalid_argument("Frequency out of range.");
+				freq = static_cast<uint32_t>(value_hz);
+			}
+			else if (arg == "--threads") threads = std::stoul(value());
+			else if (arg == "--update") update = true;
+			else if (arg.starts_with("--"))
+				throw std::invalid_argument("Unknown option: " + arg);
+			else if (manifest.empty()) manifest = arg;
+			else throw std::invalid_argument("Only one manifest may be given.");
+		}
+		if (manifest.empty())
+			throw std::invalid_argument("Missing the manifest.");
+	}
+	catch (std::exception& e)
+	{
+		std::cerr << e.what() << '\n' << usage;
+		return 2;
+	}
+
+	try { checks = read_manifest(manifest, freq, lines); }
+	catch (std::invalid_argument& e)
+	{
+		std::cerr << e.what() << '\n';
+		return 2;
+	}
+
+	// Every check runs once on each engine, which all have to agree. Without
+	// any compiled code, the compiled engine just interprets.
+	std::vector<Chip8::Engine> engines
+		{Chip8::Engine::interpreter, Chip8::Engine::block_cache};
+	if (!Chip8Compiled::programs().empty())
+		engines.push_back(Chip8::Engine::compiled);
+	std::vector<Chip8Job> jobs;
+	for (const Check& check : checks)
+	{
+		for (Chip8::Engine engine : engines)
+		{
+			jobs.push_back(check.job);
+			jobs.back().engine = engine;
+		}
+	}
+
+	auto start_time {std::chrono::steady_clock::now()};
+	Chip8BatchRunner runner(threads);
+	std::vector<Chip8JobResult> results {runner.run(jobs)};
+	std::chrono::duration<double> wall
+		{std::chrono::steady_clock::now() - start_time};
+
+	size_t failed {0};
+	for (size_t c {0}; c < checks.size(); ++c)
+	{
+		const Check& check {checks[c]};
+		const Chip8JobResult* first {&results[c * engines.size()]};
+		if (!check.known && !update)
+		{
+			std::cerr << "FAIL " << check.path
+				<< ": no fingerprint to check against\n";
+			++failed;
+			continue;
+		}
+
+		// Updating takes the interpreter's result as the one to match.
+		uint64_t expected {update ? first[0].fingerprint : check.expected};
+		bool passed {true};
+		for (size_t e {0}; e < engines.size(); ++e)
+		{
+			const Chip8JobResult& result {first[e]};
+			if (result.fingerprint == expected) continue;
+			passed = false;
+			std::cerr << "FAIL " << check.path << " ("
+				<< engine_name(engines[e]) << "): expected " << hex(expected)
+				<< ", got " << hex(result.fingerprint);
+			if (result.crashed) std::cerr << ", crashed: " << result.error;
+			std::cerr << '\n';
+		}
+		if (!passed) ++failed;
+
+		if (update)
+		{
+			std::string& line {lines[check.line]};
+			size_t start {line.find_first_not_of(" \t")};
+			size_t end {line.find_first_of(" \t", start)};
+			line.replace(start, end - start, hex(expected));
+		}
+	}
+
+	if (update)
+		for (const std::string& line : lines) std::cout << line << '\n';
+	std::cerr << checks.size() - failed << " of " << checks.size()
+		<< " checks passed in " << wall.count() << " s on "
+		<< runner.threads() << (runner.threads() == 1 ? " thread.\n"
+			: " threads.\n");
+	return failed == 0 ? 0 : 1;
+}
@@ -1,28 +1,44 @@
 #include "Main.hpp"
 
-#include "beep.hpp"
+#include "Chip8MappedFile.hpp"
 
-#include <chrono>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <sstream>
+#include <stdexcept>
 #include <wx/colordlg.h>
 #include <wx/msgdlg.h>
 #include <wx/numdlg.h>
 
 
-// Maps wxWidget key input characters to numerical values for the Chip-8 VM.
-const std::map<wxChar, uint8_t> key_map
+// Maps wxWidget key input characters to numerical values for the Chip-8 VM,
+// indexed by character. Characters that aren't keys map to 0xff.
+constexpr std::array<uint8_t, 128> key_map {[]
 {
-	{'x', 0x0},		{'1', 0x1},
-	{'2', 0x2},		{'3', 0x3},
-	{'Q', 0x4},		{'W', 0x5},
-	{'E', 0x6},		{'A', 0x7},
-	{'S', 0x8},		{'D', 0x9},
-	{'Z', 0xa},		{'C', 0xb},
-	{'4', 0xc},		{'R', 0xd},
-	{'F', 0xe},		{'V', 0xf},
-};
+	std::array<uint8_t, 128> map {};
+	map.fill(0xff);
+	// The characters of the keys in order of their values.
+	constexpr char keys[] {"X123QWEASDZC4RFV"};
+	for (uint8_t key {0}; key <= 0xf; ++key) map[keys[key]] = key;
+	return map;
+}()};
+
+
+namespace
+{
+	/**
+	 * @return The Chip-8 key value for a key event's character, or 0xff if
+	 * it isn't one of the keys.
+	 */
+	uint8_t map_key(const wxKeyEvent& event)
+	{
+		wxChar c {event.GetUnicodeKey()};
+		return c < key_map.size() ? key_map[c] : 0xff;
+	}
+}
 
 
 bool Chip8CPP::OnInit()
@@ -44,9 +60,11 @@ Chip8ScreenPanel::Chip8ScreenPanel(wxFrame* parent)
 {
 	SetSize(2, 1); // Set the size to enforce the aspect ratio.
 	// Initialize the data structures for the screen image.
-	_image_buf = (uint8_t*) calloc(64 * 32, 3);
-	_image = new wxImage(64, 32, _image_buf, true);
-	_update = false;
+	_image_buf = (uint8_t*) calloc(_Image_W * _Image_H, 3);
+	_update = true;
+	_sequence = UINT64_MAX;
+	// Every pixel is painted, so there's no need to erase the background.
+	SetBackgroundStyle(wxBG_STYLE_PAINT);
 	// Bind the paint and resize events.
 	Bind(wxEVT_PAINT, &Chip8ScreenPanel::paint_event, this);
 	Bind(wxEVT_SIZE, &Chip8ScreenPanel::on_size, this);
@@ -55,7 +73,7 @@ Chip8ScreenPanel::Chip8ScreenPanel(wxFrame* parent)
 
 Chip8ScreenPanel::~Chip8ScreenPanel()
 {
-	delete _image;
+	free(_image_buf);
 }
 
 
@@ -66,26 +84,44 @@ bool Chip8ScreenPanel::AcceptsFocus() const
 
 
 void Chip8ScreenPanel::mark()
+{}
+
+
+void Chip8ScreenPanel::repaint()
 {
 	_update = true;
 	Refresh(false); // Causes EVT_PAINT to be fired (handled by paint_event).
 }
 
 
+void Chip8ScreenPanel::present()
+{
+	// Causes EVT_PAINT to be fired (handled by paint_event).
+	if (_vm->frame_sequence() != _sequence) Refresh(false);
+}
+
+
 void Chip8ScreenPanel::paint_event(wxPaintEvent& e)
 {
-	if (_update)
-	{
-		publish_buffer();
-		_update = false;
-	}
+	_stale_rows |= publish_buffer();
 	// Grab the size of the panel.
 	int w;
 	int h;
 	wxPaintDC dc(this);
 	dc.GetSize(&w, &h);
-	// Obtain a bitmap of the image object with the same size; render it.
-	_resized = wxBitmap(_image->Scale(w, h /*, wxIMAGE_QUALITY_HIGH*/));
+	if (w <= 0 || h <= 0) return;
+	if (w != _scaled_w || h != _scaled_h)
+	{
+		resize_scaled(w, h);
+		_stale_rows = UINT64_MAX;
+	}
+	// Rebuild the bitmap only if the image has changed since it was built.
+	if (_stale_rows != 0)
+	{
+		scale_rows(_stale_rows);
+		_stale_rows = 0;
+		_resized = wxBitmap(_scaled);
+	}
 	dc.DrawBitmap(_resized, 0, 0, false);
 }
 
@@ -97,46 +133,108 @@ void Chip8ScreenPanel::on_size(wxSizeEvent& event)
 }
 
 
-void Chip8ScreenPanel::clear_buffer()
+uint64_t Chip8ScreenPanel::publish_buffer()
 {
-	size_t i {0};
-	while (i < sizeof(_image_buf))
+	// Grab a consistent copy of the screen, without stopping the VM.
+	const Chip8FrameBuffer::Frame& frame {_vm->latest_frame()};
+	uint64_t dirty {frame.dirty};
+	if (_update.exchange(false))
 	{
-		_image_buf[i++] = _backR;
-		_image_buf[i++] = _backG;
-		_image_buf[i++] = _backB;
+		build_palette();
+		dirty = UINT64_MAX;
 	}
+	else if (frame.sequence == _sequence) return 0;
+	// The rows changed by any frames that were skipped are unknown.
+	else if (frame.sequence != _sequence + 1) dirty = UINT64_MAX;
+	_sequence = frame.sequence;
+
+	uint64_t redrawn {0};
+	for (unsigned y {0}; y < frame.screen.height(); ++y)
+		if (dirty & (1ULL << y)) redrawn |= expand_row(frame.screen, y);
+	return redrawn;
 }
 
 
-void Chip8ScreenPanel::publish_buffer()
+void Chip8ScreenPanel::build_palette()
 {
-	uint64_t* screen {_vm->get_screen_buf()};
-	size_t offset {0}; // The image buffer offset.
+	const uint8_t back[3] {_backR, _backG, _backB};
+	const uint8_t fore[3] {_foreR, _foreG, _foreB};
+	for (int c {0}; c < 3; ++c)
+	{
+		int step {(fore[c] - back[c]) / 3};
+		_palette[0][c] = back[c];
+		_palette[1][c] = fore[c];
+		_palette[2][c] = static_cast<uint8_t>(back[c] + step);
+		_palette[3][c] = static_cast<uint8_t>(back[c] + 2 * step);
+	}
+}
 
-	// Iterate over the VM's screen.
-	for (int y {0}; y < 32; ++y)
+
+uint64_t Chip8ScreenPanel::expand_row(const Chip8Screen& screen, unsigned y)
+{
+	unsigned scale {_Image_W / screen.width()};
+	uint8_t* out {&_image_buf[y * scale * _Image_W * 3]};
+	for (unsigned x {0}; x < screen.width(); ++x)
 	{
-		// Initialize a mask to test pixels in the screen.
-		uint64_t mask {1ULL << 63};
-		for (int x {0}; x < 64; ++x)
+		// The most significant bit is the leftmost pixel.
+		unsigned planes {0};
+		for (size_t p {0}; p < Chip8Screen::planes; ++p)
 		{
-			// Set the values in the buffer.
-			if (mask & screen[y])
-			{
-				_image_buf[offset++] = _foreR;
-				_image_buf[offset++] = _foreG;
-				_image_buf[offset++] = _foreB;
-			}
-			else
-			{
-				_image_buf[offset++] = _backR;
-				_image_buf[offset++] = _backG;
-				_image_buf[offset++] = _backB;
-			}
+			const Chip8Screen::Plane& plane {screen.plane[p]};
+			uint64_t row {x < 64 ? plane.left[y] : plane.right[y]};
+			planes |= (row >> (63 - x % 64) & 1) << p;
+		}
+		for (unsigned i {0}; i < scale; ++i)
+		{
+			memcpy(out, _palette[planes].data(), 3);
+			out += 3;
+		}
+	}
+	// Low resolution rows are doubled down the image too.
+	if (scale == 2) memcpy(out, out - _Image_W * 3, _Image_W * 3);
+	return (scale == 2 ? 3ULL : 1ULL) << (y * scale);
+}
+
 
-			// Shuffle the bitmask along one bit.
-			mask = mask >> 1;
+void Chip8ScreenPanel::resize_scaled(int w, int h)
+{
+	_scaled_buf.resize(static_cast<size_t>(w) * h * 3);
+	_scaled = wxImage(w, h, _scaled_buf.data(), true);
+	_scaled_w = w;
+	_scaled_h = h;
+	_src_x.resize(w);
+	for (int x {0}; x < w; ++x) _src_x[x] = x * _Image_W / w;
+}
+
+
+void Chip8ScreenPanel::scale_rows(uint64_t rows)
+{
+	int w {_scaled_w};
+	int h {_scaled_h};
+	size_t stride {static_cast<size_t>(w) * 3};
+	int prev_src_y {-1};
+
+	for (int y {0}; y < h; ++y)
+	{
+		int src_y {y * _Image_H / h};
+		bool repeat {src_y == prev_src_y};
+		prev_src_y = src_y;
+		if (!(rows & (1ULL << src_y))) continue;
+
+		uint8_t* out {&_scaled_buf[y * stride]};
+		// Rows sampling the same row of the image are identical.
+		if (repeat)
+		{
+			memcpy(out, out - stride, stride);
+			continue;
+		}
+		const uint8_t* in {&_image_buf[src_y * _Image_W * 3]};
+		for (int x {0}; x < w; ++x)
+		{
+			const uint8_t* pixel {&in[_src_x[x] * 3]};
+			*out++ = pixel[0];
+			*out++ = pixel[1];
+			*out++ = pixel[2];
 		}
 	}
 }
@@ -155,13 +253,48 @@ MainFrame::MainFrame()
 	menu_file->Append(
 		ID_FILE_LOAD, "&Load State\tCtrl-L", "Load an emulator state");
 	menu_file->AppendSeparator();
+	menu_file->AppendCheckItem(ID_FILE_RECORD, "Record &Input\tCtrl-I",
+		"Record the input given to the emulator, to be replayed exactly");
+	menu_file->Append(ID_FILE_REPLAY, "Re&play Input",
+		"Replay recorded input from the state it was recorded from");
+	menu_file->AppendCheckItem(ID_FILE_STREAM, "S&tream Screen",
+		"Stream the screen to viewers over TCP, who can also press keys");
+	menu_file->AppendSeparator();
 	menu_file->Append(wxID_EXIT);
 	// Set up the "Emulation" menu dropdown.
 	wxMenu* menu_emu = new wxMenu;
 	menu_emu->Append(ID_EMU_RUN, "&Run\tCtrl-R", "Run the emulator");
 	menu_emu->Append(ID_EMU_STOP, "&Stop\tCtrl-T", "Stop the emulator");
+	menu_emu->Append(ID_EMU_REWIND, "Re&wind\tCtrl-Z",
+		"Step the emulator back by a second");
 	menu_emu->Append(ID_EMU_SET_FREQ, "&Set Frequency\t"
 		"Ctrl-F", "Set the instruction frequency of the emulator");
+	wxMenu* menu_speed = new wxMenu;
+	menu_speed->AppendRadioItem(ID_EMU_SPEED_1X, "&Normal\tCtrl-1",
+		"Run the emulator in real time");
+	menu_speed->AppendRadioItem(ID_EMU_SPEED_2X, "Fast Forward x&2\tCtrl-2",
+		"Run the emulator at twice real time");
+	menu_speed->AppendRadioItem(ID_EMU_SPEED_4X, "Fast Forward x&4\tCtrl-4",
+		"Run the emulator at four times real time");
+	menu_speed->AppendRadioItem(ID_EMU_SPEED_8X, "Fast Forward x&8\tCtrl-8",
+		"Run the emulator at eight times real time");
+	menu_speed->AppendRadioItem(ID_EMU_SPEED_MAX, "&Unthrottled\tCtrl-U",
+		"Run the emulator as fast as possible");
+	menu_emu->AppendSubMenu(menu_speed, "S&peed",
+		"Set the speed of the emulator relative to real time");
+	wxMenu* menu_platform = new wxMenu;
+	menu_platform->AppendRadioItem(ID_EMU_PLATFORM_AUTO, "&Automatic",
+		"Guess the platform of each program opened");
+	menu_platform->AppendRadioItem(ID_EMU_PLATFORM_CHIP8, "&CHIP-8",
+		"Run programs with the quirks of the original COSMAC VIP Chip-8");
+	menu_platform->AppendRadioItem(ID_EMU_PLATFORM_CHIP48, "CHIP-&48",
+		"Run programs with the quirks of CHIP-48");
+	menu_platform->AppendRadioItem(ID_EMU_PLATFORM_SCHIP, "&SUPER-CHIP",
+		"Run programs with the quirks of SUPER-CHIP 1.1");
+	menu_platform->AppendRadioItem(ID_EMU_PLATFORM_XOCHIP, "&XO-CHIP",
+		"Run programs with the quirks of XO-CHIP");
+	menu_emu->AppendSubMenu(menu_platform, "P&latform",
+		"Set the platform whose quirks programs are run with");
 	menu_emu->AppendSeparator();
 	menu_emu->Append(ID_EMU_SET_FORE, "Set Foreground Color",
 		"Set the display's forground color.");
@@ -178,8 +311,29 @@ MainFrame::MainFrame()
 	SetMenuBar(menuBar);
 	CreateStatusBar();
 	SetStatusText("No program loaded, idle.");
-	// Set up the sound and display.
-	_sound = new wxSound(sizeof(beep), beep);
+	// Set up the sound and display. Nothing is heard until the VM runs.
+	_tone.pause(true);
+#ifdef CHIP8_SDL_AUDIO
+	if (SDL_InitSubSystem(SDL_INIT_AUDIO) == 0)
+	{
+		SDL_AudioSpec spec {};
+		spec.freq = static_cast<int>(_tone.sample_rate());
+		spec.format = AUDIO_S16SYS;
+		spec.channels = 1;
+		spec.samples = 256;
+		spec.callback = &MainFrame::render_audio;
+		spec.userdata = &_tone;
+		// SDL converts the stream if the device wants another format.
+		_audio = SDL_OpenAudioDevice(nullptr, 0, &spec, nullptr, 0);
+		if (_audio != 0) SDL_PauseAudioDevice(_audio, 0);
+	}
+#else
+	// Half a second holds a whole number of periods of the tone.
+	std::ostringstream wav;
+	_tone.write_wav(wav, _tone.loop(_tone.sample_rate() / 2));
+	_beep = wav.str();
+	_sound = new wxSound(_beep.size(), _beep.data());
+#endif
 	wxBoxSizer* sizer = new wxBoxSizer(wxHORIZONTAL);
 	sizer->Add(_screen, 1, wxSHAPED | wxALIGN_CENTER);
 	SetSizer(sizer);
@@ -189,102 +343,96 @@ MainFrame::MainFrame()
 	Bind(wxEVT_MENU, &MainFrame::on_open, this, ID_FILE_OPEN);
 	Bind(wxEVT_MENU, &MainFrame::on_save, this, ID_FILE_SAVE);
 	Bind(wxEVT_MENU, &MainFrame::on_load, this, ID_FILE_LOAD);
+	Bind(wxEVT_MENU, &MainFrame::on_record, this, ID_FILE_RECORD);
+	Bind(wxEVT_MENU, &MainFrame::on_replay, this, ID_FILE_REPLAY);
+	Bind(wxEVT_MENU, &MainFrame::on_stream, this, ID_FILE_STREAM);
 	Bind(wxEVT_MENU, &MainFrame::on_run, this, ID_EMU_RUN);
 	Bind(wxEVT_MENU, &MainFrame::on_stop, this, ID_EMU_STOP);
+	Bind(wxEVT_MENU, &MainFrame::on_rewind, this, ID_EMU_REWIND);
 	Bind(wxEVT_MENU, &MainFrame::on_set_freq, this, ID_EMU_SET_FREQ);
+	Bind(wxEVT_MENU, &MainFrame::on_set_speed, this, ID_EMU_SPEED_1X,
+		ID_EMU_SPEED_MAX);
+	Bind(wxEVT_MENU, &MainFrame::on_set_platform, this, ID_EMU_PLATFORM_AUTO,
+		ID_EMU_PLATFORM_XOCHIP);
 	Bind(wxEVT_MENU, &MainFrame::on_set_color, this, ID_EMU_SET_FORE);
 	Bind(wxEVT_MENU, &MainFrame::on_set_color, this, ID_EMU_SET_BACK);
 	Bind(wxEVT_MENU, &MainFrame::on_about, this, wxID_ABOUT);
 	Bind(wxEVT_MENU, &MainFrame::on_exit, this, wxID_EXIT);
 	Bind(wxEVT_THREAD, &MainFrame::on_crash, this, ID_VM_CRASH);
+	Bind(wxEVT_THREAD, &MainFrame::on_vm_error, this, ID_VM_ERROR);
+	Bind(wxEVT_TIMER, &MainFrame::on_stats_timer, this, ID_STATS_TIMER);
+	Bind(wxEVT_SOCKET, &MainFrame::on_stream_server, this, ID_STREAM_SERVER);
+	Bind(wxEVT_SOCKET, &MainFrame::on_stream_socket, this, ID_STREAM_SOCKET);
+	Bind(wxEVT_TIMER, &MainFrame::on_stream_timer, this, ID_STREAM_TIMER);
 	Bind(wxEVT_CLOSE_WINDOW, &MainFrame::on_close, this, wxID_ANY);
-	// Initialize the keyboard key states.
-	for (int i = 0; i < 16; ++i) _key_states[i] = false;
-
 	// Configure the window size and position and create the VM.
 	SetSize(1280, 720);
 	Center();
 	SetFocus();
-	_vm = new Chip8(this, _screen, this);
-	_run_lock.lock();
-	_die = false;
-	_runner = std::thread(&MainFrame::run_vm, this);
+	// Keys are held on the VM's own keypad, so no keyboard delegate is used.
+	_vm = new Chip8(nullptr, _screen, &_tone);
+	_vm->rewind(&_rewind);
+	// No checks are needed to play programs, only to debug them.
+	_vm->access(Chip8::Access::fast);
+	_freq = _vm->frequency();
 	_running = false;
+	_runner = std::thread(&MainFrame::run_vm, this);
+	// Statistics are refreshed twice a second if there are any to show.
+	_stats_timer.SetOwner(this, ID_STATS_TIMER);
+	if (Chip8Stats::enabled) _stats_timer.Start(500);
+	_stream_timer.SetOwner(this, ID_STREAM_TIMER);
 }
 
 
-bool MainFrame::test_key(uint8_t key)
-{
-	return _key_states.at(key);
-}
-
-
-void MainFrame::start_sound()
+#ifdef CHIP8_SDL_AUDIO
+void MainFrame::render_audio(void* tone, Uint8* stream, int len)
 {
-	_sound->Play(wxSOUND_ASYNC | wxSOUND_LOOP);
+	static_cast<Chip8Tone*>(tone)->render(std::span(
+		reinterpret_cast<int16_t*>(stream), len / sizeof(int16_t)));
 }
-
-
-void MainFrame::stop_sound()
+#else
+void MainFrame::follow_tone()
 {
-	_sound->Stop();
+	bool sounding {_tone.sounding()};
+	if (sounding == _beeping) return;
+	if (sounding) _sound->Play(wxSOUND_ASYNC | wxSOUND_LOOP);
+	else _sound->Stop();
+	_beeping = sounding;
 }
+#endif
 
 
 void MainFrame::on_key_up(wxKeyEvent& event)
 {
-	// Unset the key in the map if it is valid.
-	try
-	{
-		uint8_t key_val {key_map.at(event.GetUnicodeKey())};
-		_key_states[key_val] = false;
-		_vm->key_released(key_val);
-	}
-	catch (std::out_of_range& e) { return; }
+	// Release the key on the VM's keypad if it is valid.
+	uint8_t key_val {map_key(event)};
+	if (key_val <= 0xf) _commands.push({Command::key_up, key_val});
 }
 
 
 void MainFrame::on_key_down(wxKeyEvent& event)
 {
-	// Set the key in the map if it is valid.
-	try
-	{
-		uint8_t key_val {key_map.at(event.GetUnicodeKey())};
-		_key_states[key_val] = true;
-		_vm->key_pressed(key_val);
-	}
-	catch (std::out_of_range& e) { return; }
+	// Hold the key on the VM's keypad if it is valid.
+	uint8_t key_val {map_key(event)};
+	if (key_val <= 0xf) _commands.push({Command::key_down, key_val});
 }
 
 
 void MainFrame::on_open(wxCommandEvent& event)
 {
 	stop_vm();
+	stop_input();
 
 	// Construct a dialog to select the file path to open.
 	wxFileDialog openDialog(this, "Load Chip-8 Program", "", "",
 		"Chip-8 ROMs (*.ch8)|*.ch8|All files (*.*)|*.*", wxFD_OPEN);
 	// Return if the user doesn't select a file.
 	if (openDialog.ShowModal() == wxID_CANCEL) return;
-	// Grab the selected file path.
+	// Grab the selected file path, for the runner to load the program from.
 	std::string path {openDialog.GetPath()};
-	// Open the file and read it into a string.
-	std::ifstream program_file(path, std::fstream::binary);
-	std::stringstream sstr;
-	sstr << program_file.rdbuf();
-	std::string program {sstr.str()};
-	
-	// Pass the string of the program to the VM.
-	try { _vm->load_program(program); }
-	catch (std::invalid_argument& e)
-	{
-		wxMessageBox(e.what(), "Failed to load program",
-			wxOK | wxICON_ERROR | wxCENTER);
-	}
+	_commands.push({Command::open, _detect_platform, path});
 	
 	SetStatusText("Idle.");
-	_screen->clear_buffer();
-	_screen->mark();
 	SetFocus();
 }
 
@@ -298,19 +446,9 @@ void MainFrame::on_save(wxCommandEvent& event)
 	// Do nothing if the user doesn't select a file.
 	if (saveDalog.ShowModal() == wxID_CANCEL) return;
 
+	// The state is saved between batches, so the VM needn't stop.
 	std::string path {saveDalog.GetPath()};
-	std::ofstream state_file;
-	state_file.open(path, std::ofstream::out | std::ofstream::binary);
-	try { state_file << *_vm; }
-	catch (std::ios_base::failure& e)
-	{
-		std::string msg {"Failed to save state: "};
-		msg.append(e.what());
-		wxMessageDialog errorDialog(this, msg, "Error Saving State",
-			wxOK | wxICON_ERROR | wxCENTRE);
-		errorDialog.ShowModal();
-	}
-	state_file.close();
+	_commands.push({Command::save, 0, path});
 	SetFocus();
 }
 
@@ -318,6 +456,7 @@ void MainFrame::on_save(wxCommandEvent& event)
 void MainFrame::on_load(wxCommandEvent& event)
 {
 	stop_vm();
+	stop_input();
 
 	// Construct a dialog to select the file path to open.
 	wxFileDialog saveDalog(this, "Open Chip-8 State", "", "",
@@ -326,31 +465,219 @@ void MainFrame::on_load(wxCommandEvent& event)
 	if (saveDalog.ShowModal() == wxID_CANCEL) return;
 
 	std::string path {saveDalog.GetPath()};
-	std::ifstream state_file(path, std::fstream::binary);
-	try { state_file >> *_vm; }
-	catch (std::ios_base::failure& e)
+	_commands.push({Command::load, 0, path});
+	SetFocus();
+}
+
+
+void MainFrame::on_record(wxCommandEvent& event)
+{
+	if (event.IsChecked())
 	{
-		std::string msg {"Failed to load state: "};
-		msg.append(e.what());
-		wxMessageDialog errorDialog(this, msg, "Error Loading State",
-			wxOK | wxICON_ERROR | wxCENTRE);
-		errorDialog.ShowModal();
+		// Changing the frequency or platform would stop the recording
+		// replaying exactly.
+		_commands.push({Command::record});
+		GetMenuBar()->Enable(ID_EMU_SET_FREQ, false);
+		for (int id {ID_EMU_PLATFORM_AUTO}; id <= ID_EMU_PLATFORM_XOCHIP; ++id)
+			GetMenuBar()->Enable(id, false);
+		SetFocus();
+		return;
 	}
-	state_file.close();
+	stop_input();
 
-	_screen->mark();
+	// Construct a dialog to select the file path to save to.
+	wxFileDialog saveDalog(this, "Save Input Log", "", "",
+		"Input logs (*.input8)|*.input8|All files (*.*)|*.*",
+		wxFD_SAVE | wxFD_OVERWRITE_PROMPT);
+	// Do nothing if the user doesn't select a file.
+	if (saveDalog.ShowModal() == wxID_CANCEL) return;
+
+	std::string path {saveDalog.GetPath()};
+	_commands.push({Command::save_input, 0, path});
 	SetFocus();
 }
 
 
-void MainFrame::on_run(wxCommandEvent& event)
+void MainFrame::on_replay(wxCommandEvent& event)
+{
+	stop_vm();
+	stop_input();
+
+	// Construct a dialog to select the file path to open.
+	wxFileDialog openDialog(this, "Open Input Log", "", "",
+		"Input logs (*.input8)|*.input8|All files (*.*)|*.*", wxFD_OPEN);
+	// Do nothing if the user doesn't select a file.
+	if (openDialog.ShowModal() == wxID_CANCEL) return;
+
+	std::string path {openDialog.GetPath()};
+	_commands.push({Command::replay, 0, path});
+	SetFocus();
+}
+
+
+void MainFrame::stop_input()
 {
-	if (!_vm->is_programmed())
+	_commands.push({Command::stop_input});
+	GetMenuBar()->Check(ID_FILE_RECORD, false);
+	GetMenuBar()->Enable(ID_EMU_SET_FREQ, true);
+	for (int id {ID_EMU_PLATFORM_AUTO}; id <= ID_EMU_PLATFORM_XOCHIP; ++id)
+		GetMenuBar()->Enable(id, true);
+}
+
+
+void MainFrame::on_stream(wxCommandEvent& event)
+{
+	if (!event.IsChecked())
+	{
+		stop_stream();
+		SetFocus();
+		return;
+	}
+
+	// Construct a dialog to select the port to listen on.
+	wxNumberEntryDialog portDialog(
+		this, "Stream the screen to viewers on TCP port", "Port:",
+		"Stream Screen", 8064, 1, 65535);
+	if (portDialog.ShowModal() == wxID_CANCEL)
 	{
-		wxMessageBox("Unable to start the VM without loading a program.",
-			"Error", wxOK | wxICON_ERROR | wxCENTRE, this);
+		GetMenuBar()->Check(ID_FILE_STREAM, false);
 		return;
 	}
+
+	wxIPV4address address;
+	address.Service(static_cast<unsigned short>(portDialog.GetValue()));
+	_stream_server = new wxSocketServer(address,
+		wxSOCKET_NOWAIT | wxSOCKET_REUSEADDR);
+	if (!_stream_server->IsOk())
+	{
+		stop_stream();
+		GetMenuBar()->Check(ID_FILE_STREAM, false);
+		wxMessageDialog errorDialog(this, "Unable to listen on the port.",
+			"Error Streaming Screen", wxOK | wxICON_ERROR | wxCENTRE);
+		errorDialog.ShowModal();
+		return;
+	}
+	_stream_server->SetEventHandler(*this, ID_STREAM_SERVER);
+	_stream_server->SetNotify(wxSOCKET_CONNECTION_FLAG);
+	_stream_server->Notify(true);
+	// Frames are sent on at the rate the VM ticks.
+	_stream_timer.Start(1000 / 60);
+	SetFocus();
+}
+
+
+void MainFrame::on_stream_server(wxSocketEvent& event)
+{
+	wxSocketBase* socket {_stream_server->Accept(false)};
+	if (socket == nullptr) return;
+	// Neither reads nor writes ever wait, nor does the runner on them.
+	socket->SetFlags(wxSOCKET_NOWAIT);
+	socket->SetEventHandler(*this, ID_STREAM_SOCKET);
+	socket->SetNotify(wxSOCKET_INPUT_FLAG | wxSOCKET_LOST_FLAG);
+	socket->Notify(true);
+	_viewers.push_back({socket});
+	_streaming = true;
+	// Also wakes the runner to send it, if the VM is paused.
+	_commands.push({Command::keyframe});
+}
+
+
+void MainFrame::on_stream_socket(wxSocketEvent& event)
+{
+	wxSocketBase* socket {event.GetSocket()};
+	auto viewer {std::find_if(_viewers.begin(), _viewers.end(),
+		[&](const Viewer& v) { return v.socket == socket; })};
+	if (viewer == _viewers.end()) return;
+	if (event.GetSocketEvent() == wxSOCKET_LOST)
+	{
+		drop_viewer(socket);
+		return;
+	}
+
+	uint8_t buffer[256];
+	socket->Read(buffer, sizeof(buffer));
+	viewer->input.insert(viewer->input.end(), buffer,
+		buffer + socket->LastReadCount());
+	size_t used {0};
+	try
+	{
+		uint8_t key;
+		bool pressed;
+		std::span<const uint8_t> input {viewer->input};
+		while (size_t size {Chip8Stream::decode_key(input.subspan(used), key,
+			pressed)})
+		{
+			_commands.push({pressed ? Command::key_down : Command::key_up,
+				key});
+			used += size;
+		}
+	}
+	catch (std::invalid_argument& e)
+	{
+		// Whatever the viewer is, it isn't speaking the protocol.
+		drop_viewer(socket);
+		return;
+	}
+	viewer->input.erase(viewer->input.begin(), viewer->input.begin() + used);
+}
+
+
+void MainFrame::on_stream_timer(wxTimerEvent& event)
+{
+	while (_stream_frames.pop(_stream_in))
+		for (Viewer& viewer : _viewers)
+			viewer.backlog.insert(viewer.backlog.end(), _stream_in.begin(),
+				_stream_in.end());
+
+	// Each viewer is sent as much as its socket takes without waiting.
+	std::vector<wxSocketBase*> behind;
+	for (Viewer& viewer : _viewers)
+	{
+		if (viewer.backlog.empty()) continue;
+		viewer.socket->Write(viewer.backlog.data(), viewer.backlog.size());
+		viewer.backlog.erase(viewer.backlog.begin(),
+			viewer.backlog.begin() + viewer.socket->LastWriteCount());
+		if (viewer.backlog.size() > _Max_Backlog)
+			behind.push_back(viewer.socket);
+	}
+	for (wxSocketBase* socket : behind) drop_viewer(socket);
+}
+
+
+void MainFrame::stop_stream()
+{
+	_stream_timer.Stop();
+	while (!_viewers.empty()) drop_viewer(_viewers.back().socket);
+	if (_stream_server != nullptr)
+	{
+		_stream_server->Destroy();
+		_stream_server = nullptr;
+	}
+}
+
+
+void MainFrame::drop_viewer(wxSocketBase* socket)
+{
+	auto viewer {std::find_if(_viewers.begin(), _viewers.end(),
+		[&](const Viewer& v) { return v.socket == socket; })};
+	if (viewer == _viewers.end()) return;
+	socket->Destroy();
+	_viewers.erase(viewer);
+	_streaming = !_viewers.empty();
+}
+
+
+void MainFrame::capture_stream()
+{
+	if (!_streaming.load(std::memory_order_relaxed)) return;
+	if (!_stream.encode(_vm->get_screen(), _vm->ticks(), _stream_out)) return;
+	// The viewers would miss the frame, so the next puts them right.
+	if (!_stream_frames.try_push(_stream_out)) _stream.request_keyframe();
+}
+
+
+void MainFrame::on_run(wxCommandEvent& event)
+{
 	start_vm();
 }
 
@@ -361,15 +688,29 @@ void MainFrame::on_stop(wxCommandEvent& event)
 }
 
 
+void MainFrame::on_rewind(wxCommandEvent& event)
+{
+	stop_vm();
+	stop_input();
+	_commands.push({Command::rewind, 60});
+	SetFocus();
+}
+
+
 void MainFrame::on_set_freq(wxCommandEvent& event)
 {
 	// Construct a dialog to select the desired frequency,
 	wxNumberEntryDialog freqDialog(
-		this, "Set Emulation Frequency", "", "", _vm->frequency(), 1, 10000);
+		this, "Set Emulation Frequency", "", "", _freq, 1,
+		Chip8::max_frequency);
 
 	// If the user accepts, set the frequency.
 	if (freqDialog.ShowModal() != wxID_CANCEL)
-		_vm->frequency((uint16_t) freqDialog.GetValue());
+	{
+		uint32_t freq {(uint32_t) freqDialog.GetValue()};
+		_commands.push({Command::frequency, freq});
+		_freq = freq;
+	}
 
 	if (_running) show_running_status();
 	
@@ -377,6 +718,58 @@ void MainFrame::on_set_freq(wxCommandEvent& event)
 }
 
 
+void MainFrame::on_set_speed(wxCommandEvent& event)
+{
+	switch (event.GetId())
+	{
+		case ID_EMU_SPEED_1X:
+			_pacer.mode(Chip8Pacer::Mode::realtime);
+			break;
+		case ID_EMU_SPEED_MAX:
+			_pacer.mode(Chip8Pacer::Mode::unthrottled);
+			break;
+		default:
+			_pacer.factor(event.GetId() == ID_EMU_SPEED_2X ? 2
+				: event.GetId() == ID_EMU_SPEED_4X ? 4 : 8);
+			_pacer.mode(Chip8Pacer::Mode::fast_forward);
+			break;
+	}
+
+	if (_running) show_running_status();
+
+	SetFocus();
+}
+
+
+void MainFrame::on_set_platform(wxCommandEvent& event)
+{
+	// Guessing takes effect from the next program opened.
+	_detect_platform = event.GetId() == ID_EMU_PLATFORM_AUTO;
+	Chip8::Platform platform;
+	switch (event.GetId())
+	{
+		case ID_EMU_PLATFORM_CHIP8:
+			platform = Chip8::Platform::chip8;
+			break;
+		case ID_EMU_PLATFORM_CHIP48:
+			platform = Chip8::Platform::chip48;
+			break;
+		case ID_EMU_PLATFORM_SCHIP:
+			platform = Chip8::Platform::schip;
+			break;
+		case ID_EMU_PLATFORM_XOCHIP:
+			platform = Chip8::Platform::xochip;
+			break;
+		default:
+			SetFocus();
+			return;
+	}
+	_commands.push({Command::platform, static_cast<uint32_t>(platform)});
+
+	SetFocus();
+}
+
+
 void MainFrame::on_set_color(wxCommandEvent& event)
 {
 	// Construct a dialog to select the desired color,
@@ -397,7 +790,7 @@ void MainFrame::on_set_color(wxCommandEvent& event)
 			_screen->_backG = c.GetGreen();
 			_screen->_backB = c.GetBlue();
 		}
-		_screen->mark();
+		_screen->repaint();
 	}
 	SetFocus();
 }
@@ -417,18 +810,67 @@ void MainFrame::on_close(wxCloseEvent& event)
 
 void MainFrame::on_crash(wxThreadEvent& event)
 {
-	_running = true;
-	stop_vm();
-	_runner.detach();
-	_runner = std::thread(&MainFrame::run_vm, this);
+	// The runner has already paused itself.
+	_running = false;
+	SetStatusText("Idle.");
+	std::string msg {"The VM has crashed with the following error: "};
+	msg.append(event.GetString());
+	wxMessageDialog errorDialog(this, msg, "Error",
+		wxOK | wxICON_ERROR | wxCENTRE);
+	errorDialog.ShowModal();
+}
+
+
+void MainFrame::on_vm_error(wxThreadEvent& event)
+{
+	std::string title {"Error"};
+	std::string msg;
+	switch (event.GetInt())
+	{
+		case Command::run:
+			// The VM never started.
+			_running = false;
+			SetStatusText("Idle.");
+			break;
+		case Command::open:
+			title = "Failed to load program";
+			break;
+		case Command::save:
+			title = "Error Saving State";
+			msg = "Failed to save state: ";
+			break;
+		case Command::load:
+			title = "Error Loading State";
+			msg = "Failed to load state: ";
+			break;
+		case Command::save_input:
+			title = "Error Saving Input Log";
+			msg = "Failed to save input log: ";
+			break;
+		case Command::replay:
+			title = "Error Loading Input Log";
+			msg = "Failed to replay input log: ";
+			break;
+	}
+	msg.append(event.GetString());
+	wxMessageDialog errorDialog(this, msg, title,
+		wxOK | wxICON_ERROR | wxCENTRE);
+	errorDialog.ShowModal();
 }
 
 
 void MainFrame::close()
 {
-	_die = true;
-	start_vm();
+	_stats_timer.Stop();
+	stop_stream();
+	// Commands are carried out in order, so the runner finishes any before.
+	_commands.push({Command::quit});
 	_runner.join();
+#ifdef CHIP8_SDL_AUDIO
+	// The device stops calling back once closed.
+	if (_audio != 0) SDL_CloseAudioDevice(_audio);
+	SDL_QuitSubSystem(SDL_INIT_AUDIO);
+#endif
 	delete _vm;
 	this->Destroy();
 }
@@ -445,56 +887,167 @@ void MainFrame::on_about(wxCommandEvent& event)
 
 void MainFrame::run_vm(MainFrame* frame)
 {
-	using clock = std::chrono::steady_clock;
-	static constexpr Chip8::_TimeType batch_period {Chip8::_billion / 60U};
-	
+	Command command;
 	while (true)
 	{
-		Chip8::_TimeType start_time {clock::now().time_since_epoch()};
-		frame->_run_lock.lock();
-
-		if (frame->_die)
+		while (frame->_commands.pop(command))
 		{
-			frame->_run_lock.unlock();
-			break;
+			if (command.kind == Command::quit) return;
+			try { frame->apply(command); }
+			catch (Chip8Error& e)
+			{
+				frame->apply({Command::pause});
+				frame->report(ID_VM_CRASH, command.kind, e.what());
+			}
+			catch (std::exception& e)
+			{
+				frame->report(ID_VM_ERROR, command.kind, e.what());
+			}
+		}
+		// The frame just run, or whatever the commands did to the screen.
+		frame->capture_stream();
+
+		// A program waiting on a key with its timers stopped does nothing
+		// until one is pressed, which is a command, so there's no need to run
+		// it until the next. A replay presses its own keys, so still runs.
+		if (!frame->_executing || (frame->_vm->idle() == Chip8::Idle::key
+			&& frame->_input.mode() != Chip8InputLog::Mode::replaying))
+		{
+			frame->_commands.wait();
+			frame->_pacer.reset();
+			continue;
 		}
 
-		try { frame->_vm->execute_batch(batch_period); }
+		try { frame->_vm->execute_batch(frame->_pacer.begin_frame()); }
 		catch (Chip8Error& e)
 		{
-			frame->_run_lock.unlock();
-			wxThreadEvent* evt {new wxThreadEvent(wxEVT_THREAD, ID_VM_CRASH)};
-			frame->QueueEvent(evt);
-			std::string msg {"The VM has crashed with the following error: "};
-			msg.append(e.what());
-			wxMessageDialog errorDialog(frame, msg, "Error",
-				wxOK | wxICON_ERROR | wxCENTRE);
-			errorDialog.ShowModal();
-			break;
+			// Stay paused, ready for whatever is loaded next.
+			frame->apply({Command::pause});
+			frame->report(ID_VM_CRASH, Command::run, e.what());
+			continue;
 		}
 
-		frame->_run_lock.unlock();
-		Chip8::_TimeType delta {clock::now().time_since_epoch() - start_time};
-		Chip8::_TimeType sleep_period {batch_period - delta};
-		if (sleep_period.count() > 0)
-			std::this_thread::sleep_for(batch_period - delta);
+#ifndef CHIP8_SDL_AUDIO
+		frame->follow_tone();
+#endif
+		// Sleeps until the frame's deadline, unless running unthrottled.
+		if (frame->_pacer.end_frame()) frame->_screen->present();
 	}
 }
 
 
-void MainFrame::start_vm()
+void MainFrame::apply(const Command& command)
 {
-	if (_running) return;
-	if (_vm->is_crashed() && !_die)
+	switch (command.kind)
 	{
-		wxMessageDialog errorDialog(this,
-			"The VM has crashed and cannot be restarted.", "Error",
-			wxOK | wxICON_ERROR | wxCENTRE);
-		errorDialog.ShowModal();
-		return;
+		case Command::run:
+			if (_executing) break;
+			if (!_vm->is_programmed())
+				throw std::logic_error(
+					"Unable to start the VM without loading a program.");
+			if (_vm->is_crashed())
+				throw std::logic_error(
+					"The VM has crashed and cannot be restarted.");
+			_tone.pause(false);
+			_executing = true;
+			break;
+		case Command::pause:
+			if (!_executing) break;
+			_tone.pause(true);
+#ifndef CHIP8_SDL_AUDIO
+			_sound->Stop();
+			_beeping = false;
+#endif
+			_executing = false;
+			break;
+		case Command::open:
+		{
+			// Map the file and copy the program straight from it into the VM.
+			Chip8MappedFile program(command.path);
+			if (command.value)
+				_vm->platform(Chip8::detect_platform(program.bytes()));
+			_vm->load_program(program.bytes());
+			_screen->present();
+			break;
+		}
+		case Command::save:
+		{
+			std::ofstream state_file;
+			state_file.open(command.path,
+				std::ofstream::out | std::ofstream::binary);
+			state_file << *_vm;
+			break;
+		}
+		case Command::load:
+		{
+			std::ifstream state_file(command.path, std::fstream::binary);
+			state_file >> *_vm;
+			_freq = _vm->frequency();
+			_screen->present();
+			break;
+		}
+		case Command::record:
+			_input.start_recording(*_vm);
+			break;
+		case Command::stop_input:
+			_input.stop(*_vm);
+			break;
+		case Command::save_input:
+		{
+			std::ofstream log_file;
+			log_file.open(command.path,
+				std::ofstream::out | std::ofstream::binary);
+			log_file << _input;
+			break;
+		}
+		case Command::replay:
+		{
+			std::ifstream log_file(command.path, std::fstream::binary);
+			log_file >> _input;
+			_input.start_replay(*_vm);
+			_freq = _vm->frequency();
+			_screen->present();
+			break;
+		}
+		case Command::rewind:
+			_rewind.rewind(*_vm, command.value);
+			_screen->present();
+			break;
+		case Command::frequency:
+			_vm->frequency(command.value);
+			break;
+		case Command::platform:
+			_vm->platform(static_cast<Chip8::Platform>(command.value));
+			break;
+		case Command::key_down:
+			_vm->key_pressed(static_cast<uint8_t>(command.value));
+			break;
+		case Command::key_up:
+			_vm->key_released(static_cast<uint8_t>(command.value));
+			break;
+		case Command::keyframe:
+			_stream.request_keyframe();
+			break;
+		case Command::quit:
+			break;
 	}
-	_run_lock.unlock();
-	if (_vm->is_sounding()) _sound->Play(wxSOUND_ASYNC | wxSOUND_LOOP);
+}
+
+
+void MainFrame::report(int id, Command::Kind kind, const std::string& msg)
+{
+	wxThreadEvent* evt {new wxThreadEvent(wxEVT_THREAD, id)};
+	evt->SetInt(kind);
+	evt->SetString(msg);
+	QueueEvent(evt);
+}
+
+
+void MainFrame::start_vm()
+{
+	if (_running) return;
+	// The runner reports an error if the VM can't be run.
+	_commands.push({Command::run});
 	_running = true;
 	show_running_status();
 }
@@ -503,8 +1056,7 @@ void MainFrame::start_vm()
 void MainFrame::stop_vm()
 {
 	if (!_running) return;
-	_sound->Stop();
-	_run_lock.lock();
+	_commands.push({Command::pause});
 	_running = false;
 	SetStatusText("Idle.");
 }
@@ -512,6 +1064,47 @@ void MainFrame::stop_vm()
 
 void MainFrame::show_running_status()
 {
-	std::string msg {"VM Running @" + std::to_string(_vm->frequency()) + "Hz."};
-	SetStatusText(msg);
+	std::string msg {"VM Running @" + std::to_string(_freq) + "Hz"};
+	switch (_pacer.mode())
+	{
+		case Chip8Pacer::Mode::realtime:
+			break;
+		case Chip8Pacer::Mode::fast_forward:
+			msg.append(" x" + std::to_string(_pacer.factor()));
+			break;
+		case Chip8Pacer::Mode::unthrottled:
+			msg.append(", unthrottled");
+			break;
+	}
+
+	if (Chip8Stats::enabled)
+	{
+		// Show the rates over the batches run since the status last changed.
+		const Chip8Stats& stats {_vm->stats()};
+		double wall = stats.batch_ns - _shown_stats.batch_ns;
+		double budget = stats.budget_ns - _shown_stats.budget_ns;
+		double frames = stats.frames - _shown_stats.frames;
+		double cycles = stats.instructions() - _shown_stats.instructions()
+			+ stats.key_wait_cycles - _shown_stats.key_wait_cycles;
+		if (budget > 0 && frames > 0 && cycles > 0)
+		{
+			char rates[128];
+			snprintf(rates, sizeof(rates), ". Load %.1f%%, %.1f marks/frame, "
+				"%.1f draw stalls/frame, %.0f%% waiting for a key",
+				100 * wall / budget,
+				(stats.marks - _shown_stats.marks) / frames,
+				(stats.draw_stalls - _shown_stats.draw_stalls) / frames,
+				100 * (stats.key_wait_cycles - _shown_stats.key_wait_cycles)
+					/ cycles);
+			msg.append(rates);
+		}
+		_shown_stats = stats;
+	}
+	SetStatusText(msg + ".");
+}
+
+
+void MainFrame::on_stats_timer(wxTimerEvent& event)
+{
+	if (_running) show_running_status();
 }
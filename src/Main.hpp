@@ -1,18 +1,34 @@
 #pragma once
 
 #include "Chip8.hpp"
-
+#include "Chip8InputLog.hpp"
+#include "Chip8Pacer.hpp"
+#include "Chip8Queue.hpp"
+#include "Chip8Rewind.hpp"
+#include "Chip8Stream.hpp"
+#include "Chip8Tone.hpp"
+
+#ifdef CHIP8_SDL_AUDIO
+	// The application's entry point is wxWidgets', not SDL's.
+	#define SDL_MAIN_HANDLED
+	#include <SDL.h>
+#else
+	#include <wx/sound.h>
+#endif
 // For compilers that support precompilation, includes "wx/wx.h".
-#include <wx/sound.h>
+#include <wx/socket.h>
+#include <wx/timer.h>
 #include <wx/wxprec.h>
 #ifndef WX_PRECOMP
 	#include <wx/wx.h>
 #endif
 
+#include <array>
 #include <atomic>
-#include <mutex>
 #include <fstream>
+#include <string>
 #include <thread>
+#include <vector>
 
 
 /**
@@ -23,13 +39,32 @@ enum
 	ID_FILE_OPEN = 0,
 	ID_FILE_SAVE,
 	ID_FILE_LOAD,
+	ID_FILE_RECORD,
+	ID_FILE_REPLAY,
+	ID_FILE_STREAM,
 	ID_FILE_EXIT,
 	ID_EMU_RUN,
 	ID_EMU_STOP,
+	ID_EMU_REWIND,
 	ID_EMU_SET_FREQ,
+	ID_EMU_SPEED_1X,
+	ID_EMU_SPEED_2X,
+	ID_EMU_SPEED_4X,
+	ID_EMU_SPEED_8X,
+	ID_EMU_SPEED_MAX,
+	ID_EMU_PLATFORM_AUTO,
+	ID_EMU_PLATFORM_CHIP8,
+	ID_EMU_PLATFORM_CHIP48,
+	ID_EMU_PLATFORM_SCHIP,
+	ID_EMU_PLATFORM_XOCHIP,
 	ID_EMU_SET_FORE,
 	ID_EMU_SET_BACK,
-	ID_VM_CRASH
+	ID_VM_CRASH,
+	ID_VM_ERROR,
+	ID_STATS_TIMER,
+	ID_STREAM_SERVER,
+	ID_STREAM_SOCKET,
+	ID_STREAM_TIMER
 };
 
 
@@ -37,10 +72,52 @@ class Chip8ScreenPanel
 	: public wxPanel, public Chip8Display
 {
 private:
+	static constexpr int _Image_W {128};	// Width of the image in pixels.
+	static constexpr int _Image_H {64};		// Height of the image in pixels.
 	uint8_t*	_image_buf;	// Space to store the image before passing to WX.
-	wxImage*	_image;		// The image that will contain the screen data.
 	wxBitmap	_resized;	// Stores the resized screen to be rendered.
-	bool		_update;	// The next update should redraw the buffer.
+	std::vector<uint8_t> _scaled_buf;	// Pixels of _scaled.
+	wxImage		_scaled;	// The image scaled to the size of the panel.
+	int			_scaled_w {0};	// Width of _scaled.
+	int			_scaled_h {0};	// Height of _scaled.
+	std::vector<int> _src_x;	// Column of the image for each of _scaled.
+	uint64_t	_stale_rows {UINT64_MAX};	// Image rows not yet in _resized.
+	std::atomic<bool> _update;	// The next update should redraw the buffer.
+	std::atomic<uint64_t> _sequence;	// The frame held in the buffer.
+	// RGB colour of a pixel, indexed by the planes it is set on.
+	std::array<std::array<uint8_t, 3>, 4> _palette;
+
+	/**
+	 * @brief Fills in _palette with the current colours. Pixels set on just
+	 * one plane, or both, are shades between the background and foreground.
+	 */
+	void build_palette();
+
+	/**
+	 * @brief Expands a row of the screen into the 128x64 image buffer, which
+	 * takes two rows of it, each pixel doubled, in low resolution.
+	 * 
+	 * @param screen The screen.
+	 * @param y The index of the row.
+	 * @return Bit y is set if row y of the image was redrawn.
+	 */
+	uint64_t expand_row(const Chip8Screen& screen, unsigned y);
+
+	/**
+	 * @brief Resizes _scaled, for which every row must then be rescaled.
+	 * 
+	 * @param w The new width.
+	 * @param h The new height.
+	 */
+	void resize_scaled(int w, int h);
+
+	/**
+	 * @brief Scales rows of the image into _scaled with nearest neighbour
+	 * sampling.
+	 * 
+	 * @param rows Bit y is set if row y of the image is to be scaled.
+	 */
+	void scale_rows(uint64_t rows);
 
 public:
 	uint8_t	_foreR {0xff};	// Foreground red value.
@@ -68,13 +145,27 @@ public:
 	bool AcceptsFocus() const override;
 
 	/**
-	 * @brief Indicates the screen is to be updated and redrawn.
+	 * @brief Called as the VM draws. Nothing needs to be done, as completed
+	 * frames are picked up from the VM by present().
 	 */
 	void mark() override;
 
+	/**
+	 * @brief Rebuilds and redraws the whole image, such as after a change of
+	 * colour.
+	 */
+	void repaint();
+
+	/**
+	 * @brief Redraws the panel if the VM has completed a new frame since it
+	 * was last drawn.
+	 */
+	void present();
+
 	/**
 	 * @brief Handles the paint events for the panel by having the image
-	 * rendered to the panel.
+	 * rendered to the panel. The scaled bitmap is kept between paints, and
+	 * only the rows of it that have changed are rescaled.
 	 * 
 	 * @param event The paint event being passed down.
 	 */
@@ -89,14 +180,13 @@ public:
 	void on_size(wxSizeEvent& event);
 
 	/**
-	 * @brief Clears the screen buffer.
-	 */
-	void clear_buffer();
-
-	/**
-	 * @brief Redraws the image shown on the panel with the data in the buffer.
+	 * @brief Updates the image shown on the panel with the VM's latest frame.
+	 * Only the rows that have changed since the frame already shown are
+	 * redrawn, unless repaint() was called.
+	 * 
+	 * @return Bit y is set if row y of the image was redrawn.
 	 */
-	void publish_buffer();
+	uint64_t publish_buffer();
 };
 
 
@@ -104,7 +194,7 @@ public:
  * @brief Frame class for the primary window UI of the emulator.
  */
 class MainFrame
-	: public wxFrame, public Chip8Keyboard, public Chip8Sound
+	: public wxFrame
 {
 public:
 	/**
@@ -113,33 +203,98 @@ public:
 	MainFrame();
 
 private:
-	Chip8* 				_vm;		// Chip-8 VM.
+	/**
+	 * @brief Something for the runner thread to do to the VM between batches.
+	 */
+	struct Command
+	{
+		enum Kind : uint8_t
+		{
+			run,		// Start executing batches.
+			pause,		// Stop executing batches.
+			open,		// Load the program at path, guessing its platform if
+						// value is set.
+			save,		// Save the VM's state to path.
+			load,		// Load the VM's state from path.
+			record,		// Start recording input.
+			stop_input,	// Stop recording or replaying input.
+			save_input,	// Save the recorded input to path.
+			replay,		// Replay the input log at path.
+			rewind,		// Rewind the VM by value frames.
+			frequency,	// Set the frequency to value.
+			platform,	// Set the platform to the Chip8::Platform in value.
+			key_down,	// Press the key in value.
+			key_up,		// Release the key in value.
+			keyframe,	// Send stream viewers the whole screen.
+			quit,		// Exit the runner thread.
+		};
+
+		Kind		kind {run};	// What to do.
+		uint32_t	value {0};	// Argument, if the command takes one.
+		std::string	path {};	// File to use, if the command takes one.
+	};
+
+	Chip8* 				_vm;		// Chip-8 VM, only used by _runner.
 	std::thread			_runner;	// Thread to run the VM.
-	std::mutex			_run_lock;	// To control the running of the VM thread.
+	Chip8Queue<Command, 256> _commands;	// From the UI to _runner.
 	bool				_running;	// Indicates the the VM is running.
-	std::atomic<bool>	_die;		// Indicates the thread should exit.
+	bool _executing {false};		// Set while _runner executes batches.
+	std::atomic<uint32_t> _freq;	// The VM's frequency, for the UI.
+	Chip8Pacer			_pacer;		// Paces the VM thread's batches.
+	Chip8Rewind			_rewind;	// Recent frames the VM can rewind to.
+	Chip8InputLog		_input;		// Records or replays the VM's input.
 	Chip8ScreenPanel* 	_screen;	// Chip-8 screen.
-	std::map<uint8_t, bool> _key_states; // Stores the state of each Chip-8 key.
-	wxSound* _sound;				// Emits the tone played by the Chip-8 VM.
-
-	/**
-	 * @brief Test if the specifed key is currently pressed.
-	 * 
-	 * @param key A hexadecimal key value to test.
-	 * @return true if the key is pressed; false otherwise.
-	 * 
-	 */
-	bool test_key(uint8_t key) override;
-
-	/**
-	 * @brief Start producing a tone for the VM.
-	 */
-	void start_sound() override;
-
-	/**
-	 * @brief Stop producing a tone for the VM.
-	 */
-	void stop_sound() override;
+	Chip8Tone _tone;				// Synthesizes the VM's sound.
+#ifdef CHIP8_SDL_AUDIO
+	SDL_AudioDeviceID _audio {0};	// Streams _tone, if it could be opened.
+#else
+	std::string _beep;				// The tone, as a WAV file.
+	wxSound* _sound;				// Loops _beep while the VM sounds.
+	bool _beeping {false};			// Set while _sound is playing.
+#endif
+	wxTimer _stats_timer;			// Refreshes the statistics shown.
+	Chip8Stats _shown_stats;		// Statistics last shown in the status.
+	bool _detect_platform {true};	// Set to guess each program's platform.
+
+	/**
+	 * @brief A remote viewer of the stream of the VM's screen.
+	 */
+	struct Viewer
+	{
+		wxSocketBase* socket;			// Connection to the viewer.
+		std::vector<uint8_t> backlog;	// Frames not yet sent.
+		std::vector<uint8_t> input;		// Bytes received but not yet read.
+	};
+
+	// Most a viewer can fall behind by, in bytes, before it is dropped.
+	static constexpr size_t _Max_Backlog {64 * 1024};
+	Chip8Stream _stream;				// Encodes frames, on _runner.
+	std::atomic<bool> _streaming {false};	// Set while there are viewers.
+	std::vector<uint8_t> _stream_out;	// Frame encoded by _runner.
+	std::vector<uint8_t> _stream_in;	// Frame taken by the UI.
+	// Encoded frames, from _runner to the UI. Frames are dropped rather than
+	// wait for room.
+	Chip8Queue<std::vector<uint8_t>, 16> _stream_frames;
+	wxSocketServer* _stream_server {nullptr};	// Accepts viewers.
+	std::vector<Viewer> _viewers;		// Viewers connected.
+	wxTimer _stream_timer;				// Sends frames to viewers.
+
+#ifdef CHIP8_SDL_AUDIO
+	/**
+	 * @brief Audio callback rendering the VM's sound for the device.
+	 *
+	 * @param tone The Chip8Tone to render.
+	 * @param stream The device's buffer to fill.
+	 * @param len The size of the buffer in bytes.
+	 */
+	static void render_audio(void* tone, Uint8* stream, int len);
+#else
+	/**
+	 * @brief Starts or stops looping the tone to follow the VM's sound, which
+	 * without an audio stream is done once per frame.
+	 */
+	void follow_tone();
+#endif
 
 	/**
 	 * @brief Handles instances where the user presses a key on the keyboard. If
@@ -184,6 +339,87 @@ private:
 	 */
 	void on_load(wxCommandEvent& event);
 
+	/**
+	 * @brief Handles the "File->Record Input" check item on the menu bar,
+	 * starting a recording of the input given to the VM when checked, and
+	 * allowing the user to save it to the location they specify when
+	 * unchecked.
+	 * 
+ 	 * @param event The event produced when the user presses
+	 * "File->Record Input".
+	 */
+	void on_record(wxCommandEvent& event);
+
+	/**
+	 * @brief Handles the "File->Replay Input" button on the menu bar, opening
+	 * a dialog for the user to select an input log, and restoring the VM to
+	 * where it starts to replay it.
+	 * 
+ 	 * @param event The event produced when the user presses
+	 * "File->Replay Input".
+	 */
+	void on_replay(wxCommandEvent& event);
+
+	/**
+	 * @brief Stops any recording or replay of input, and allows the frequency
+	 * and platform to be changed again.
+	 */
+	void stop_input();
+
+	/**
+	 * @brief Handles the "File->Stream Screen" check item on the menu bar,
+	 * listening for viewers on the TCP port the user specifies when checked,
+	 * and disconnecting them when unchecked.
+	 * 
+ 	 * @param event The event produced when the user presses
+	 * "File->Stream Screen".
+	 */
+	void on_stream(wxCommandEvent& event);
+
+	/**
+	 * @brief Accepts a viewer of the stream, which is sent a keyframe to
+	 * start from.
+	 * 
+	 * @param event The event produced by _stream_server.
+	 */
+	void on_stream_server(wxSocketEvent& event);
+
+	/**
+	 * @brief Reads the keys a viewer pressed or released, passing them to the
+	 * VM as if they were pressed here, or drops a viewer that disconnected.
+	 * 
+	 * @param event The event produced by the viewer's socket.
+	 */
+	void on_stream_socket(wxSocketEvent& event);
+
+	/**
+	 * @brief Sends the frames encoded by the runner thread to every viewer,
+	 * dropping any that have fallen too far behind.
+	 * 
+	 * @param event The event produced by _stream_timer.
+	 */
+	void on_stream_timer(wxTimerEvent& event);
+
+	/**
+	 * @brief Disconnects every viewer and stops listening for more.
+	 */
+	void stop_stream();
+
+	/**
+	 * @brief Disconnects a viewer.
+	 * 
+	 * @param socket The viewer's socket.
+	 */
+	void drop_viewer(wxSocketBase* socket);
+
+	/**
+	 * @brief Encodes the screen for the stream, if there are viewers, and
+	 * hands it to the UI. Called by the runner thread after each batch and
+	 * command; never waits, so a frame is dropped if the UI is behind, and
+	 * the next sent as a keyframe.
+	 */
+	void capture_stream();
+
 	/**
 	 * @brief Handles the "File->Exit" button on the menu bar, closing the
 	 * program.
@@ -208,6 +444,15 @@ private:
 	 */
 	void on_stop(wxCommandEvent& event);
 
+	/**
+	 * @brief Handles the "Emulation->Rewind" button on the menu bar, stopping
+	 * the VM and stepping it back by a second of recorded frames.
+	 * 
+ 	 * @param event The event produced when the user presses
+	 * "Emulation->Rewind".
+	 */
+	void on_rewind(wxCommandEvent& event);
+
 	/**
 	 * @brief Handles the "Emulation->Set Frequency" button on the menu bar,
 	 * setting the instruction cycle frequency to the value specified by the
@@ -218,6 +463,23 @@ private:
 	 */
 	void on_set_freq(wxCommandEvent& event);
 
+	/**
+	 * @brief Handles the buttons of the "Emulation->Speed" menu, setting how
+	 * fast the VM runs relative to real time.
+	 * 
+	 * @param event The event produced when the user selects a speed.
+	 */
+	void on_set_speed(wxCommandEvent& event);
+
+	/**
+	 * @brief Handles the buttons of the "Emulation->Platform" menu, setting
+	 * whose quirks the VM runs programs with, or to guess them from each
+	 * program opened.
+	 * 
+	 * @param event The event produced when the user selects a platform.
+	 */
+	void on_set_platform(wxCommandEvent& event);
+
 	/**
 	 * @brief Handles the "Emulation->Set Foreground" or "Emulation->Set
 	 * Background" button on the menu bar, promting the user to select a colour
@@ -245,13 +507,30 @@ private:
 	void on_close(wxCloseEvent& event);
 
 	/**
-	 * @brief Handles crashes in the virtual machine.
+	 * @brief Handles crashes in the virtual machine, which the runner thread
+	 * survives, paused, so can go on to load another program.
 	 * 
 	 * @param event The event produced by the runner thread to indicate the VM
-	 * has crashed.
+	 * has crashed, with the error as its string.
 	 */
 	void on_crash(wxThreadEvent& event);
 
+	/**
+	 * @brief Handles commands the runner thread failed to carry out.
+	 * 
+	 * @param event The event produced by the runner thread, with the kind of
+	 * command as its int and the error as its string.
+	 */
+	void on_vm_error(wxThreadEvent& event);
+
+	/**
+	 * @brief Refreshes the VM's statistics shown in the status bar, if it is
+	 * running.
+	 * 
+	 * @param event The event produced by _stats_timer.
+	 */
+	void on_stats_timer(wxTimerEvent& event);
+
 	/**
 	 * @brief Closes the application by making the runner thread exit and
 	 * closing the window.
@@ -259,26 +538,47 @@ private:
 	void close();
 
 	/**
-	 * @brief Main loop to operate the VM at the specified frequency. If able to
-	 * lock the _runner_lock mutex, a batch of VM cycles will be run. If a batch
-	 * is run, the thread sleeps for a sixtieth of a second. Execution is paused
-	 * by locking the mutex from the main thread. If _die is set, then the
-	 * thread exits when able to lock the mutex.
+	 * @brief Main loop to operate the VM at the specified frequency. The VM is
+	 * only ever used by this thread, which carries out every command in
+	 * _commands before each batch of VM cycles. Each batch is a frame as
+	 * paced by _pacer, after which the screen is presented if the pacer
+	 * allows. While paused, or while the VM can do nothing until a key is
+	 * pressed, the thread sleeps until the next command.
 	 */
 	static void run_vm(MainFrame* frame);
 
 	/**
-	 * @brief Allows the VM to execute cycles by unlocking _runner_lock.
+	 * @brief Carries out a command on the runner thread.
+	 * 
+	 * @param command The command.
+	 * @throws Chip8Error if the VM crashed.
+	 * @throws std::exception if the command failed.
+	 */
+	void apply(const Command& command);
+
+	/**
+	 * @brief Passes an event from the runner thread to the UI.
+	 * 
+	 * @param id The ID of the event.
+	 * @param kind The kind of command it concerns.
+	 * @param msg The error message it carries.
+	 */
+	void report(int id, Command::Kind kind, const std::string& msg);
+
+	/**
+	 * @brief Has the runner thread start executing batches. It reports an
+	 * error instead if the VM can't be run.
 	 */
 	void start_vm();
 
 	/**
-	 * @brief Prevents the VM to execute cycles by locking _runner_lock.
+	 * @brief Has the runner thread stop executing batches, from the next.
 	 */
 	void stop_vm();
 
 	/**
-	 * @brief Sets the status to indicate the VM is running.
+	 * @brief Sets the status to indicate the VM is running, followed by its
+	 * statistics since they were last shown if they are collected.
 	 */
 	void show_running_status();
 };
@@ -1,1341 +0,0 @@
-// Embedded .wav file to store the beep tone for the Chip-8 VM. 440Hz triangle.
-unsigned char beep[]
-{
-	0x52, 0x49, 0x46, 0x46, 0xa4, 0x3e, 0x00, 0x00, 0x57, 0x41, 0x56, 0x45,
-	0x66, 0x6d, 0x74, 0x20, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
-	0x80, 0x3e, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x02, 0x00, 0x10, 0x00,
-	0x64, 0x61, 0x74, 0x61, 0x80, 0x3e, 0x00, 0x00, 0x6e, 0x01, 0xc3, 0x0d,
-	0x5e, 0x1c, 0x11, 0x2a, 0x7a, 0x38, 0x41, 0x46, 0x9f, 0x54, 0x68, 0x62,
-	0xe4, 0x70, 0x1a, 0x7d, 0xe7, 0x73, 0xbe, 0x64, 0x4f, 0x57, 0xbf, 0x48,
-	0x0f, 0x3b, 0xa6, 0x2c, 0xd9, 0x1e, 0x87, 0x10, 0xab, 0x02, 0x60, 0xf4,
-	0x81, 0xe6, 0x38, 0xd8, 0x57, 0xca, 0x0d, 0xbc, 0x37, 0xae, 0xd3, 0x9f,
-	0x29, 0x92, 0xda, 0x83, 0x4d, 0x89, 0xce, 0x98, 0x11, 0xa6, 0xbf, 0xb4,
-	0x55, 0xc2, 0xd7, 0xd0, 0x8b, 0xde, 0xf6, 0xec, 0xba, 0xfa, 0x1d, 0x09,
-	0xe2, 0x16, 0x49, 0x25, 0x06, 0x33, 0x7b, 0x41, 0x1e, 0x4f, 0xc1, 0x5d,
-	0x10, 0x6b, 0x5c, 0x7a, 0x3a, 0x79, 0xbb, 0x69, 0x80, 0x5c, 0xd3, 0x4d,
-	0x36, 0x40, 0xbd, 0x31, 0x00, 0x24, 0x9c, 0x15, 0xd5, 0x07, 0x71, 0xf9,
-	0xb0, 0xeb, 0x42, 0xdd, 0x8f, 0xcf, 0x0f, 0xc1, 0x77, 0xb3, 0xc7, 0xa4,
-	0x8b, 0x97, 0xff, 0x87, 0xc9, 0x84, 0x91, 0x93, 0x04, 0xa1, 0x90, 0xaf,
-	0x47, 0xbd, 0xa8, 0xcb, 0x7a, 0xd9, 0xcc, 0xe7, 0xa5, 0xf5, 0xf6, 0x03,
-	0xcc, 0x11, 0x20, 0x20, 0xf2, 0x2d, 0x50, 0x3c, 0x0f, 0x4a, 0x8f, 0x58,
-	0x09, 0x66, 0x3d, 0x75, 0x81, 0x7c, 0x52, 0x6f, 0x5a, 0x61, 0x23, 0x53,
-	0x2d, 0x45, 0xfd, 0x36, 0x03, 0x29, 0xd4, 0x1a, 0xd9, 0x0c, 0xac, 0xfe,
-	0xb2, 0xf0, 0x80, 0xe2, 0x8b, 0xd4, 0x55, 0xc6, 0x65, 0xb8, 0x26, 0xaa,
-	0x4e, 0x9c, 0xba, 0x8d, 0x03, 0x83, 0xb4, 0x8d, 0x50, 0x9c, 0x26, 0xaa,
-	0x64, 0xb8, 0x56, 0xc6, 0x8a, 0xd4, 0x82, 0xe2, 0xb0, 0xf0, 0xad, 0xfe,
-	0xd8, 0x0c, 0xd5, 0x1a, 0x04, 0x29, 0xf9, 0x36, 0x33, 0x45, 0x1c, 0x53,
-	0x62, 0x61, 0x48, 0x6f, 0x98, 0x7c, 0x4b, 0x75, 0x02, 0x66, 0x94, 0x58,
-	0x0b, 0x4a, 0x53, 0x3c, 0xef, 0x2d, 0x22, 0x20, 0xcd, 0x11, 0xf4, 0x03,
-	0xa5, 0xf5, 0xce, 0xe7, 0x76, 0xd9, 0xad, 0xcb, 0x44, 0xbd, 0x92, 0xaf,
-	0x00, 0xa1, 0x9c, 0x93, 0x9f, 0x84, 0xe5, 0x87, 0x93, 0x97, 0xc5, 0xa4,
-	0x77, 0xb3, 0x10, 0xc1, 0x8c, 0xcf, 0x45, 0xdd, 0xaf, 0xeb, 0x72, 0xf9,
-	0xd5, 0x07, 0x9a, 0x15, 0x02, 0x24, 0xbc, 0x31, 0x39, 0x40, 0xcd, 0x4d,
-	0x89, 0x5c, 0xaa, 0x69, 0x6d, 0x79, 0x93, 0x7a, 0xfa, 0x6a, 0xce, 0x5d,
-	0x16, 0x4f, 0x80, 0x41, 0x04, 0x33, 0x48, 0x25, 0xe4, 0x16, 0x1b, 0x09,
-	0xbc, 0xfa, 0xf4, 0xec, 0x8e, 0xde, 0xd2, 0xd0, 0x5b, 0xc2, 0xba, 0xb4,
-	0x13, 0xa6, 0xd2, 0x98, 0x38, 0x89, 0xc4, 0x83, 0x35, 0x92, 0xc9, 0x9f,
-	0x40, 0xae, 0x04, 0xbc, 0x5e, 0xca, 0x34, 0xd8, 0x82, 0xe6, 0x62, 0xf4,
-	0xa6, 0x02, 0x8f, 0x10, 0xcd, 0x1e, 0xb6, 0x2c, 0xfc, 0x3a, 0xd4, 0x48,
-	0x39, 0x57, 0xd5, 0x64, 0xd2, 0x73, 0x03, 0x7d, 0xc2, 0x70, 0x8d, 0x62,
-	0x78, 0x54, 0x6b, 0x46, 0x4d, 0x38, 0x42, 0x2a, 0x25, 0x1c, 0x17, 0x0e,
-	0x00, 0x00, 0xe9, 0xf1, 0xdb, 0xe3, 0xbe, 0xd5, 0xb2, 0xc7, 0x97, 0xb9,
-	0x85, 0xab, 0x77, 0x9d, 0x36, 0x8f, 0x12, 0x83, 0x40, 0x8c, 0x21, 0x9b,
-	0xcc, 0xa8, 0x2a, 0xb7, 0x05, 0xc5, 0x4a, 0xd3, 0x33, 0xe1, 0x70, 0xef,
-	0x5c, 0xfd, 0x9b, 0x0b, 0x83, 0x19, 0xc5, 0x27, 0xaa, 0x35, 0xf3, 0x43,
-	0xca, 0x51, 0x2b, 0x60, 0xde, 0x6d, 0xf9, 0x7b, 0xa4, 0x76, 0x3d, 0x67,
-	0xe5, 0x59, 0x4b, 0x4b, 0xa2, 0x3d, 0x30, 0x2f, 0x70, 0x21, 0x0d, 0x13,
-	0x45, 0x05, 0xe4, 0xf6, 0x1c, 0xe9, 0xb9, 0xda, 0xf8, 0xcc, 0x88, 0xbe,
-	0xdf, 0xb0, 0x41, 0xa2, 0xed, 0x94, 0xb9, 0x85, 0xcb, 0x86, 0x42, 0x96,
-	0x80, 0xa3, 0x2f, 0xb2, 0xc8, 0xbf, 0x44, 0xce, 0xff, 0xdb, 0x65, 0xea,
-	0x2b, 0xf8, 0x8e, 0x06, 0x52, 0x14, 0xba, 0x22, 0x76, 0x30, 0xec, 0x3e,
-	0x8f, 0x4c, 0x33, 0x5b, 0x7a, 0x68, 0xf7, 0x77, 0x45, 0x7b, 0x6d, 0x6c,
-	0xfe, 0x5e, 0x6d, 0x50, 0xbd, 0x42, 0x54, 0x34, 0x88, 0x26, 0x34, 0x18,
-	0x59, 0x0a, 0x0f, 0xfc, 0x2f, 0xee, 0xe3, 0xdf, 0x0c, 0xd2, 0xb2, 0xc3,
-	0xef, 0xb5, 0x73, 0xa7, 0xf6, 0x99, 0xc5, 0x8a, 0x59, 0x83, 0xb5, 0x90,
-	0x9f, 0x9e, 0xe4, 0xac, 0xcf, 0xba, 0x03, 0xc9, 0xff, 0xd6, 0x2a, 0xe5,
-	0x27, 0xf3, 0x55, 0x01, 0x4e, 0x0f, 0x7f, 0x1d, 0x76, 0x2b, 0xa9, 0x39,
-	0x9d, 0x47, 0xd9, 0x55, 0xb2, 0x63, 0x45, 0x72, 0x38, 0x7d, 0x4f, 0x72,
-	0xae, 0x63, 0xda, 0x55, 0x9e, 0x47, 0xa7, 0x39, 0x79, 0x2b, 0x7d, 0x1d,
-	0x4f, 0x0f, 0x55, 0x01, 0x26, 0xf3, 0x2c, 0xe5, 0xfc, 0xd6, 0x06, 0xc9,
-	0xce, 0xba, 0xe5, 0xac, 0x99, 0x9e, 0xc5, 0x90, 0x0f, 0x83, 0xab, 0x8a,
-	0x05, 0x9a, 0x65, 0xa7, 0xfc, 0xb5, 0xa7, 0xc3, 0x15, 0xd2, 0xdc, 0xdf,
-	0x35, 0xee, 0x0a, 0xfc, 0x5c, 0x0a, 0x32, 0x18, 0x8a, 0x26, 0x53, 0x34,
-	0xbe, 0x42, 0x6a, 0x50, 0x04, 0x5f, 0x60, 0x6c, 0x79, 0x7b, 0x15, 0x78,
-	0x6d, 0x68, 0x3c, 0x5b, 0x88, 0x4c, 0xf2, 0x3e, 0x71, 0x30, 0xbe, 0x22,
-	0x4f, 0x14, 0x90, 0x06, 0x2a, 0xf8, 0x66, 0xea, 0xfe, 0xdb, 0x44, 0xce,
-	0xc8, 0xbf, 0x31, 0xb2, 0x7b, 0xa3, 0x4c, 0x96, 0xae, 0x86, 0xa4, 0x85,
-	0xf6, 0x94, 0x3a, 0xa2, 0xe6, 0xb0, 0x83, 0xbe, 0xfa, 0xcc, 0xb9, 0xda,
-	0x1a, 0xe9, 0xe8, 0xf6, 0x41, 0x05, 0x0f, 0x13, 0x6f, 0x21, 0x31, 0x2f,
-	0xa2, 0x3d, 0x49, 0x4b, 0xe8, 0x59, 0x38, 0x67, 0xb1, 0x76, 0xfd, 0x7b,
-	0xd8, 0x6d, 0x31, 0x60, 0xc4, 0x51, 0xf9, 0x43, 0xa5, 0x35, 0xc7, 0x27,
-	0x84, 0x19, 0x99, 0x0b, 0x5e, 0xfd, 0x70, 0xef, 0x31, 0xe1, 0x4d, 0xd3,
-	0x01, 0xc5, 0x2e, 0xb7, 0xc8, 0xa8, 0x26, 0x9b, 0x39, 0x8c, 0x23, 0x83,
-	0x3b, 0x8f, 0x74, 0x9d, 0x86, 0xab, 0x9a, 0xb9, 0xab, 0xc7, 0xc6, 0xd5,
-	0xd5, 0xe3, 0xec, 0xf1, 0x01, 0x00, 0x13, 0x0e, 0x29, 0x1c, 0x3f, 0x2a,
-	0x50, 0x38, 0x68, 0x46, 0x7c, 0x54, 0x86, 0x62, 0xce, 0x70, 0xd4, 0x7c,
-	0xce, 0x73, 0xd6, 0x64, 0x38, 0x57, 0xd5, 0x48, 0xfb, 0x3a, 0xb8, 0x2c,
-	0xcb, 0x1e, 0x91, 0x10, 0xa3, 0x02, 0x66, 0xf4, 0x7e, 0xe6, 0x38, 0xd8,
-	0x5a, 0xca, 0x08, 0xbc, 0x3c, 0xae, 0xce, 0x9f, 0x2c, 0x92, 0xfd, 0x83,
-	0x54, 0x89, 0xc4, 0x98, 0x1b, 0xa6, 0xb6, 0xb4, 0x5d, 0xc2, 0xd0, 0xd0,
-	0x90, 0xde, 0xf3, 0xec, 0xbc, 0xfa, 0x1b, 0x09, 0xe4, 0x16, 0x48, 0x25,
-	0x04, 0x33, 0x7f, 0x41, 0x1a, 0x4f, 0xc6, 0x5d, 0x0a, 0x6b, 0x5b, 0x7a,
-	0x53, 0x79, 0xb3, 0x69, 0x87, 0x5c, 0xcc, 0x4d, 0x3c, 0x40, 0xb7, 0x31,
-	0x06, 0x24, 0x97, 0x15, 0xd8, 0x07, 0x70, 0xf9, 0xb0, 0xeb, 0x43, 0xdd,
-	0x8e, 0xcf, 0x0f, 0xc1, 0x78, 0xb3, 0xc3, 0xa4, 0x95, 0x97, 0xe8, 0x87,
-	0x8b, 0x84, 0x9c, 0x93, 0xff, 0xa0, 0x93, 0xaf, 0x45, 0xbd, 0xaa, 0xcb,
-	0x79, 0xd9, 0xcc, 0xe7, 0xa5, 0xf5, 0xf5, 0x03, 0xce, 0x11, 0x1f, 0x20,
-	0xf2, 0x2d, 0x51, 0x3c, 0x0b, 0x4a, 0x97, 0x58, 0xfc, 0x65, 0x57, 0x75,
-	0xec, 0x7c, 0x41, 0x6f, 0x63, 0x61, 0x1d, 0x53, 0x31, 0x45, 0xfa, 0x36,
-	0x04, 0x29, 0xd5, 0x1a, 0xd8, 0x0c, 0xae, 0xfe, 0xae, 0xf0, 0x84, 0xe2,
-	0x88, 0xd4, 0x57, 0xc6, 0x65, 0xb8, 0x23, 0xaa, 0x54, 0x9c, 0xb0, 0x8d,
-	0xc9, 0x82, 0xba, 0x8d, 0x4e, 0x9c, 0x27, 0xaa, 0x63, 0xb8, 0x59, 0xc6,
-	0x86, 0xd4, 0x84, 0xe2, 0xaf, 0xf0, 0xad, 0xfe, 0xda, 0x0c, 0xd4, 0x1a,
-	0x02, 0x29, 0xfe, 0x36, 0x2d, 0x45, 0x21, 0x53, 0x5d, 0x61, 0x4f, 0x6f,
-	0xa3, 0x7c, 0x40, 0x75, 0x04, 0x66, 0x92, 0x58, 0x0e, 0x4a, 0x50, 0x3c,
-	0xf2, 0x2d, 0x20, 0x20, 0xcd, 0x11, 0xf5, 0x03, 0xa4, 0xf5, 0xce, 0xe7,
-	0x76, 0xd9, 0xae, 0xcb, 0x42, 0xbd, 0x93, 0xaf, 0x03, 0xa1, 0x91, 0x93,
-	0xbd, 0x84, 0x07, 0x88, 0x87, 0x97, 0xcc, 0xa4, 0x73, 0xb3, 0x12, 0xc1,
-	0x8b, 0xcf, 0x46, 0xdd, 0xad, 0xeb, 0x74, 0xf9, 0xd2, 0x07, 0x9f, 0x15,
-	0xfc, 0x23, 0xc3, 0x31, 0x31, 0x40, 0xd6, 0x4d, 0x7d, 0x5c, 0xbf, 0x69,
-	0x34, 0x79, 0x49, 0x7a, 0x12, 0x6b, 0xbf, 0x5d, 0x20, 0x4f, 0x79, 0x41,
-	0x09, 0x33, 0x45, 0x25, 0xe7, 0x16, 0x17, 0x09, 0xc0, 0xfa, 0xef, 0xec,
-	0x94, 0xde, 0xcc, 0xd0, 0x61, 0xc2, 0xb4, 0xb4, 0x1b, 0xa6, 0xc3, 0x98,
-	0x5c, 0x89, 0x07, 0x84, 0x23, 0x92, 0xd4, 0x9f, 0x36, 0xae, 0x0d, 0xbc,
-	0x57, 0xca, 0x3b, 0xd8, 0x7b, 0xe6, 0x67, 0xf4, 0xa2, 0x02, 0x92, 0x10,
-	0xcc, 0x1e, 0xb6, 0x2c, 0xfb, 0x3a, 0xd7, 0x48, 0x33, 0x57, 0xdf, 0x64,
-	0xc0, 0x73, 0xee, 0x7c, 0xcb, 0x70, 0x87, 0x62, 0x7d, 0x54, 0x66, 0x46,
-	0x53, 0x38, 0x3b, 0x2a, 0x2b, 0x1c, 0x13, 0x0e, 0x02, 0x00, 0xe9, 0xf1,
-	0xd9, 0xe3, 0xc1, 0xd5, 0xb0, 0xc7, 0x98, 0xb9, 0x86, 0xab, 0x74, 0x9d,
-	0x3f, 0x8f, 0xfa, 0x82, 0x31, 0x8c, 0x28, 0x9b, 0xca, 0xa8, 0x2a, 0xb7,
-	0x05, 0xc5, 0x4a, 0xd3, 0x31, 0xe1, 0x74, 0xef, 0x58, 0xfd, 0x9e, 0x0b,
-	0x80, 0x19, 0xca, 0x27, 0xa3, 0x35, 0xfc, 0x43, 0xbe, 0x51, 0x3a, 0x60,
-	0xc8, 0x6d, 0x3f, 0x7c, 0xc5, 0x76, 0x30, 0x67, 0xec, 0x59, 0x47, 0x4b,
-	0xa4, 0x3d, 0x30, 0x2f, 0x6e, 0x21, 0x11, 0x13, 0x3f, 0x05, 0xeb, 0xf6,
-	0x17, 0xe9, 0xbb, 0xda, 0xfa, 0xcc, 0x82, 0xbe, 0xe8, 0xb0, 0x33, 0xa2,
-	0x06, 0x95, 0x6c, 0x85, 0x95, 0x86, 0x55, 0x96, 0x75, 0xa3, 0x36, 0xb2,
-	0xc4, 0xbf, 0x47, 0xce, 0xfd, 0xdb, 0x65, 0xea, 0x2c, 0xf8, 0x8e, 0x06,
-	0x51, 0x14, 0xbc, 0x22, 0x72, 0x30, 0xf2, 0x3e, 0x87, 0x4c, 0x3d, 0x5b,
-	0x6c, 0x68, 0x1b, 0x78, 0x62, 0x7b, 0x62, 0x6c, 0x03, 0x5f, 0x6a, 0x50,
-	0xbf, 0x42, 0x52, 0x34, 0x8b, 0x26, 0x30, 0x18, 0x5e, 0x0a, 0x08, 0xfc,
-	0x36, 0xee, 0xde, 0xdf, 0x0f, 0xd2, 0xb0, 0xc3, 0xf1, 0xb5, 0x70, 0xa7,
-	0xfb, 0x99, 0xb7, 0x8a, 0x67, 0x83, 0xb7, 0x90, 0xa0, 0x9e, 0xe2, 0xac,
-	0xce, 0xba, 0x07, 0xc9, 0xfc, 0xd6, 0x2a, 0xe5, 0x2b, 0xf3, 0x4e, 0x01,
-	0x56, 0x0f, 0x78, 0x1d, 0x7b, 0x2b, 0xa7, 0x39, 0x9e, 0x47, 0xd9, 0x55,
-	0xb0, 0x63, 0x4b, 0x72, 0xff, 0x7c, 0x44, 0x72, 0xb5, 0x63, 0xd6, 0x55,
-	0xa0, 0x47, 0xa4, 0x39, 0x7d, 0x2b, 0x78, 0x1d, 0x54, 0x0f, 0x52, 0x01,
-	0x27, 0xf3, 0x2b, 0xe5, 0xff, 0xd6, 0x00, 0xc9, 0xd7, 0xba, 0xda, 0xac,
-	0xa7, 0x9e, 0xae, 0x90, 0x7f, 0x83, 0xc3, 0x8a, 0xf7, 0x99, 0x71, 0xa7,
-	0xf0, 0xb5, 0xb2, 0xc3, 0x0d, 0xd2, 0xe0, 0xdf, 0x33, 0xee, 0x0b, 0xfc,
-	0x5c, 0x0a, 0x33, 0x18, 0x87, 0x26, 0x57, 0x34, 0xb9, 0x42, 0x70, 0x50,
-	0xfc, 0x5e, 0x70, 0x6c, 0x36, 0x7b, 0x02, 0x78, 0x74, 0x68, 0x37, 0x5b,
-	0x8d, 0x4c, 0xed, 0x3e, 0x76, 0x30, 0xb9, 0x22, 0x53, 0x14, 0x8d, 0x06,
-	0x2c, 0xf8, 0x65, 0xea, 0xfe, 0xdb, 0x45, 0xce, 0xc7, 0xbf, 0x31, 0xb2,
-	0x7c, 0xa3, 0x47, 0x96, 0xc6, 0x86, 0xa2, 0x85, 0xf3, 0x94, 0x3d, 0xa2,
-	0xe3, 0xb0, 0x83, 0xbe, 0xfc, 0xcc, 0xb6, 0xda, 0x1f, 0xe9, 0xe3, 0xf6,
-	0x45, 0x05, 0x0b, 0x13, 0x72, 0x21, 0x2f, 0x2f, 0xa4, 0x3d, 0x48, 0x4b,
-	0xe8, 0x59, 0x38, 0x67, 0xaf, 0x76, 0x29, 0x7c, 0xd2, 0x6d, 0x33, 0x60,
-	0xc4, 0x51, 0xf7, 0x43, 0xa8, 0x35, 0xc5, 0x27, 0x84, 0x19, 0x9a, 0x0b,
-	0x5c, 0xfd, 0x72, 0xef, 0x30, 0xe1, 0x4d, 0xd3, 0x01, 0xc5, 0x2e, 0xb7,
-	0xc8, 0xa8, 0x28, 0x9b, 0x33, 0x8c, 0xcb, 0x82, 0x3a, 0x8f, 0x77, 0x9d,
-	0x85, 0xab, 0x97, 0xb9, 0xb1, 0xc7, 0xc1, 0xd5, 0xd7, 0xe3, 0xed, 0xf1,
-	0xfd, 0xff, 0x18, 0x0e, 0x26, 0x1c, 0x3f, 0x2a, 0x52, 0x38, 0x66, 0x46,
-	0x7b, 0x54, 0x8b, 0x62, 0xc4, 0x70, 0x36, 0x7d, 0xce, 0x73, 0xd5, 0x64,
-	0x3b, 0x57, 0xd1, 0x48, 0xff, 0x3a, 0xb3, 0x2c, 0xd0, 0x1e, 0x8d, 0x10,
-	0xa6, 0x02, 0x64, 0xf4, 0x7f, 0xe6, 0x37, 0xd8, 0x5b, 0xca, 0x07, 0xbc,
-	0x3d, 0xae, 0xce, 0x9f, 0x2c, 0x92, 0xd8, 0x83, 0x50, 0x89, 0xc9, 0x98,
-	0x19, 0xa6, 0xb4, 0xb4, 0x61, 0xc2, 0xcc, 0xd0, 0x93, 0xde, 0xf1, 0xec,
-	0xbe, 0xfa, 0x18, 0x09, 0xe8, 0x16, 0x43, 0x25, 0x0a, 0x33, 0x7a, 0x41,
-	0x1d, 0x4f, 0xc4, 0x5d, 0x0b, 0x6b, 0x60, 0x7a, 0x38, 0x79, 0xbc, 0x69,
-	0x80, 0x5c, 0xd2, 0x4d, 0x37, 0x40, 0xbc, 0x31, 0x02, 0x24, 0x99, 0x15,
-	0xd7, 0x07, 0x71, 0xf9, 0xaf, 0xeb, 0x44, 0xdd, 0x8d, 0xcf, 0x10, 0xc1,
-	0x77, 0xb3, 0xc6, 0xa4, 0x8d, 0x97, 0xfd, 0x87, 0xcb, 0x84, 0x8f, 0x93,
-	0x05, 0xa1, 0x90, 0xaf, 0x47, 0xbd, 0xa8, 0xcb, 0x7a, 0xd9, 0xcc, 0xe7,
-	0xa5, 0xf5, 0xf5, 0x03, 0xcc, 0x11, 0x21, 0x20, 0xf1, 0x2d, 0x51, 0x3c,
-	0x0d, 0x4a, 0x92, 0x58, 0x05, 0x66, 0x40, 0x75, 0x80, 0x7c, 0x52, 0x6f,
-	0x5b, 0x61, 0x22, 0x53, 0x2d, 0x45, 0xfd, 0x36, 0x04, 0x29, 0xd2, 0x1a,
-	0xdc, 0x0c, 0xaa, 0xfe, 0xb0, 0xf0, 0x85, 0xe2, 0x85, 0xd4, 0x5b, 0xc6,
-	0x60, 0xb8, 0x29, 0xaa, 0x4d, 0x9c, 0xb9, 0x8d, 0x05, 0x83, 0xb1, 0x8d,
-	0x54, 0x9c, 0x22, 0xaa, 0x66, 0xb8, 0x56, 0xc6, 0x89, 0xd4, 0x84, 0xe2,
-	0xae, 0xf0, 0xae, 0xfe, 0xd7, 0x0c, 0xd7, 0x1a, 0x02, 0x29, 0xfc, 0x36,
-	0x30, 0x45, 0x1d, 0x53, 0x62, 0x61, 0x47, 0x6f, 0x9a, 0x7c, 0x49, 0x75,
-	0x04, 0x66, 0x92, 0x58, 0x0c, 0x4a, 0x52, 0x3c, 0xf0, 0x2d, 0x22, 0x20,
-	0xcc, 0x11, 0xf5, 0x03, 0xa5, 0xf5, 0xcc, 0xe7, 0x79, 0xd9, 0xaa, 0xcb,
-	0x46, 0xbd, 0x91, 0xaf, 0x01, 0xa1, 0x9a, 0x93, 0xa1, 0x84, 0xe4, 0x87,
-	0x94, 0x97, 0xc3, 0xa4, 0x79, 0xb3, 0x0f, 0xc1, 0x8d, 0xcf, 0x45, 0xdd,
-	0xad, 0xeb, 0x72, 0xf9, 0xd7, 0x07, 0x98, 0x15, 0x06, 0x24, 0xb7, 0x31,
-	0x3b, 0x40, 0xcc, 0x4d, 0x8b, 0x5c, 0xa9, 0x69, 0x6f, 0x79, 0x8e, 0x7a,
-	0x01, 0x6b, 0xc7, 0x5d, 0x1c, 0x4f, 0x7c, 0x41, 0x06, 0x33, 0x47, 0x25,
-	0xe5, 0x16, 0x19, 0x09, 0xbf, 0xfa, 0xf1, 0xec, 0x90, 0xde, 0xd2, 0xd0,
-	0x59, 0xc2, 0xbd, 0xb4, 0x10, 0xa6, 0xd4, 0x98, 0x39, 0x89, 0xc1, 0x83,
-	0x38, 0x92, 0xc6, 0x9f, 0x42, 0xae, 0x04, 0xbc, 0x5d, 0xca, 0x35, 0xd8,
-	0x81, 0xe6, 0x62, 0xf4, 0xa7, 0x02, 0x8d, 0x10, 0xcf, 0x1e, 0xb5, 0x2c,
-	0xfc, 0x3a, 0xd5, 0x48, 0x38, 0x57, 0xd5, 0x64, 0xd3, 0x73, 0x02, 0x7d,
-	0xc2, 0x70, 0x8f, 0x62, 0x75, 0x54, 0x6d, 0x46, 0x4d, 0x38, 0x40, 0x2a,
-	0x27, 0x1c, 0x17, 0x0e, 0xfd, 0xff, 0xef, 0xf1, 0xd4, 0xe3, 0xc4, 0xd5,
-	0xae, 0xc7, 0x99, 0xb9, 0x85, 0xab, 0x78, 0x9d, 0x33, 0x8f, 0x16, 0x83,
-	0x3c, 0x8c, 0x24, 0x9b, 0xcb, 0xa8, 0x2a, 0xb7, 0x05, 0xc5, 0x4a, 0xd3,
-	0x33, 0xe1, 0x6f, 0xef, 0x5f, 0xfd, 0x97, 0x0b, 0x85, 0x19, 0xc6, 0x27,
-	0xa8, 0x35, 0xf5, 0x43, 0xc9, 0x51, 0x2a, 0x60, 0xe0, 0x6d, 0xf7, 0x7b,
-	0xa6, 0x76, 0x3c, 0x67, 0xe4, 0x59, 0x4e, 0x4b, 0x9d, 0x3d, 0x36, 0x2f,
-	0x6b, 0x21, 0x10, 0x13, 0x42, 0x05, 0xe7, 0xf6, 0x1b, 0xe9, 0xb9, 0xda,
-	0xf9, 0xcc, 0x84, 0xbe, 0xe4, 0xb0, 0x3d, 0xa2, 0xf1, 0x94, 0xb5, 0x85,
-	0xce, 0x86, 0x3f, 0x96, 0x84, 0xa3, 0x2b, 0xb2, 0xcb, 0xbf, 0x43, 0xce,
-	0xff, 0xdb, 0x65, 0xea, 0x2c, 0xf8, 0x8c, 0x06, 0x54, 0x14, 0xb9, 0x22,
-	0x76, 0x30, 0xee, 0x3e, 0x8b, 0x4c, 0x36, 0x5b, 0x79, 0x68, 0xf7, 0x77,
-	0x46, 0x7b, 0x6c, 0x6c, 0xfe, 0x5e, 0x6e, 0x50, 0xbc, 0x42, 0x54, 0x34,
-	0x8a, 0x26, 0x31, 0x18, 0x5c, 0x0a, 0x0c, 0xfc, 0x31, 0xee, 0xe3, 0xdf,
-	0x0b, 0xd2, 0xb3, 0xc3, 0xee, 0xb5, 0x74, 0xa7, 0xf5, 0x99, 0xc5, 0x8a,
-	0x5b, 0x83, 0xb2, 0x90, 0xa2, 0x9e, 0xe2, 0xac, 0xce, 0xba, 0x07, 0xc9,
-	0xfb, 0xd6, 0x2c, 0xe5, 0x28, 0xf3, 0x52, 0x01, 0x51, 0x0f, 0x7c, 0x1d,
-	0x7a, 0x2b, 0xa6, 0x39, 0x9f, 0x47, 0xd7, 0x55, 0xb4, 0x63, 0x43, 0x72,
-	0x3b, 0x7d, 0x4b, 0x72, 0xb1, 0x63, 0xd9, 0x55, 0x9e, 0x47, 0xa7, 0x39,
-	0x79, 0x2b, 0x7b, 0x1d, 0x53, 0x0f, 0x52, 0x01, 0x27, 0xf3, 0x2c, 0xe5,
-	0xfb, 0xd6, 0x07, 0xc9, 0xcf, 0xba, 0xe2, 0xac, 0x9d, 0x9e, 0xc0, 0x90,
-	0x13, 0x83, 0xaa, 0x8a, 0x04, 0x9a, 0x68, 0xa7, 0xf8, 0xb5, 0xab, 0xc3,
-	0x12, 0xd2, 0xdc, 0xdf, 0x39, 0xee, 0x04, 0xfc, 0x62, 0x0a, 0x2d, 0x18,
-	0x8d, 0x26, 0x52, 0x34, 0xbe, 0x42, 0x69, 0x50, 0x06, 0x5f, 0x5e, 0x6c,
-	0x7b, 0x7b, 0x14, 0x78, 0x6d, 0x68, 0x3c, 0x5b, 0x88, 0x4c, 0xf1, 0x3e,
-	0x73, 0x30, 0xbc, 0x22, 0x51, 0x14, 0x8e, 0x06, 0x2b, 0xf8, 0x66, 0xea,
-	0xfe, 0xdb, 0x43, 0xce, 0xcb, 0xbf, 0x2c, 0xb2, 0x81, 0xa3, 0x47, 0x96,
-	0xb1, 0x86, 0xa3, 0x85, 0xf5, 0x94, 0x3c, 0xa2, 0xe4, 0xb0, 0x84, 0xbe,
-	0xfa, 0xcc, 0xb8, 0xda, 0x1c, 0xe9, 0xe6, 0xf6, 0x42, 0x05, 0x10, 0x13,
-	0x6d, 0x21, 0x33, 0x2f, 0xa1, 0x3d, 0x49, 0x4b, 0xe9, 0x59, 0x37, 0x67,
-	0xb1, 0x76, 0xff, 0x7b, 0xd6, 0x6d, 0x31, 0x60, 0xc6, 0x51, 0xf5, 0x43,
-	0xa9, 0x35, 0xc6, 0x27, 0x82, 0x19, 0x9d, 0x0b, 0x59, 0xfd, 0x74, 0xef,
-	0x2f, 0xe1, 0x4d, 0xd3, 0x03, 0xc5, 0x2b, 0xb7, 0xcb, 0xa8, 0x24, 0x9b,
-	0x39, 0x8c, 0x26, 0x83, 0x36, 0x8f, 0x78, 0x9d, 0x84, 0xab, 0x99, 0xb9,
-	0xb0, 0xc7, 0xbf, 0xd5, 0xdb, 0xe3, 0xe8, 0xf1, 0x03, 0x00, 0x13, 0x0e,
-	0x28, 0x1c, 0x40, 0x2a, 0x50, 0x38, 0x67, 0x46, 0x7c, 0x54, 0x88, 0x62,
-	0xcb, 0x70, 0xd6, 0x7c, 0xcc, 0x73, 0xd8, 0x64, 0x38, 0x57, 0xd3, 0x48,
-	0xfe, 0x3a, 0xb3, 0x2c, 0xd1, 0x1e, 0x8d, 0x10, 0xa4, 0x02, 0x67, 0xf4,
-	0x7c, 0xe6, 0x39, 0xd8, 0x5b, 0xca, 0x06, 0xbc, 0x3d, 0xae, 0xcf, 0x9f,
-	0x28, 0x92, 0x03, 0x84, 0x4e, 0x89, 0xca, 0x98, 0x17, 0xa6, 0xb7, 0xb4,
-	0x5e, 0xc2, 0xce, 0xd0, 0x93, 0xde, 0xf0, 0xec, 0xbf, 0xfa, 0x18, 0x09,
-	0xe6, 0x16, 0x46, 0x25, 0x07, 0x33, 0x7c, 0x41, 0x1b, 0x4f, 0xc6, 0x5d,
-	0x08, 0x6b, 0x5f, 0x7a, 0x50, 0x79, 0xb4, 0x69, 0x86, 0x5c, 0xce, 0x4d,
-	0x39, 0x40, 0xbb, 0x31, 0x03, 0x24, 0x99, 0x15, 0xd6, 0x07, 0x73, 0xf9,
-	0xac, 0xeb, 0x47, 0xdd, 0x8a, 0xcf, 0x13, 0xc1, 0x74, 0xb3, 0xc7, 0xa4,
-	0x92, 0x97, 0xe9, 0x87, 0x8b, 0x84, 0x9b, 0x93, 0x01, 0xa1, 0x93, 0xaf,
-	0x43, 0xbd, 0xad, 0xcb, 0x74, 0xd9, 0xd2, 0xe7, 0xa0, 0xf5, 0xfa, 0x03,
-	0xc8, 0x11, 0x24, 0x20, 0xed, 0x2d, 0x56, 0x3c, 0x07, 0x4a, 0x99, 0x58,
-	0xfc, 0x65, 0x55, 0x75, 0xf0, 0x7c, 0x3c, 0x6f, 0x66, 0x61, 0x1c, 0x53,
-	0x31, 0x45, 0xfb, 0x36, 0x04, 0x29, 0xd3, 0x1a, 0xda, 0x0c, 0xad, 0xfe,
-	0xae, 0xf0, 0x85, 0xe2, 0x86, 0xd4, 0x5a, 0xc6, 0x62, 0xb8, 0x27, 0xaa,
-	0x4f, 0x9c, 0xb4, 0x8d, 0xc7, 0x82, 0xbb, 0x8d, 0x4f, 0x9c, 0x25, 0xaa,
-	0x64, 0xb8, 0x58, 0xc6, 0x87, 0xd4, 0x85, 0xe2, 0xad, 0xf0, 0xb0, 0xfe,
-	0xd4, 0x0c, 0xdb, 0x1a, 0xfd, 0x28, 0xff, 0x36, 0x2f, 0x45, 0x1d, 0x53,
-	0x63, 0x61, 0x48, 0x6f, 0xa8, 0x7c, 0x3b, 0x75, 0x09, 0x66, 0x8f, 0x58,
-	0x10, 0x4a, 0x4d, 0x3c, 0xf6, 0x2d, 0x1b, 0x20, 0xd2, 0x11, 0xf1, 0x03,
-	0xa7, 0xf5, 0xcd, 0xe7, 0x77, 0xd9, 0xab, 0xcb, 0x45, 0xbd, 0x91, 0xaf,
-	0x04, 0xa1, 0x91, 0x93, 0xbd, 0x84, 0x07, 0x88, 0x88, 0x97, 0xcb, 0xa4,
-	0x72, 0xb3, 0x15, 0xc1, 0x88, 0xcf, 0x49, 0xdd, 0xab, 0xeb, 0x74, 0xf9,
-	0xd4, 0x07, 0x9b, 0x15, 0x01, 0x24, 0xbe, 0x31, 0x34, 0x40, 0xd5, 0x4d,
-	0x7c, 0x5c, 0xc2, 0x69, 0x31, 0x79, 0x4a, 0x7a, 0x11, 0x6b, 0xc1, 0x5d,
-	0x1f, 0x4f, 0x79, 0x41, 0x09, 0x33, 0x44, 0x25, 0xe8, 0x16, 0x17, 0x09,
-	0xc0, 0xfa, 0xf0, 0xec, 0x91, 0xde, 0xcf, 0xd0, 0x5f, 0xc2, 0xb5, 0xb4,
-	0x1b, 0xa6, 0xc3, 0x98, 0x5b, 0x89, 0x08, 0x84, 0x22, 0x92, 0xd4, 0x9f,
-	0x38, 0xae, 0x0b, 0xbc, 0x57, 0xca, 0x3c, 0xd8, 0x7a, 0xe6, 0x68, 0xf4,
-	0xa3, 0x02, 0x8f, 0x10, 0xcf, 0x1e, 0xb4, 0x2c, 0xfc, 0x3a, 0xd7, 0x48,
-	0x33, 0x57, 0xde, 0x64, 0xc2, 0x73, 0xeb, 0x7c, 0xce, 0x70, 0x86, 0x62,
-	0x7d, 0x54, 0x66, 0x46, 0x52, 0x38, 0x3d, 0x2a, 0x2a, 0x1c, 0x14, 0x0e,
-	0x00, 0x00, 0xea, 0xf1, 0xdb, 0xe3, 0xbd, 0xd5, 0xb5, 0xc7, 0x92, 0xb9,
-	0x8b, 0xab, 0x71, 0x9d, 0x40, 0x8f, 0xfb, 0x82, 0x2f, 0x8c, 0x2b, 0x9b,
-	0xc6, 0xa8, 0x2e, 0xb7, 0x02, 0xc5, 0x4c, 0xd3, 0x31, 0xe1, 0x72, 0xef,
-	0x5b, 0xfd, 0x9b, 0x0b, 0x83, 0x19, 0xc7, 0x27, 0xa6, 0x35, 0xfa, 0x43,
-	0xbf, 0x51, 0x3a, 0x60, 0xc8, 0x6d, 0x3f, 0x7c, 0xc5, 0x76, 0x30, 0x67,
-	0xec, 0x59, 0x47, 0x4b, 0xa5, 0x3d, 0x2c, 0x2f, 0x75, 0x21, 0x08, 0x13,
-	0x48, 0x05, 0xe2, 0xf6, 0x1e, 0xe9, 0xb7, 0xda, 0xfd, 0xcc, 0x7e, 0xbe,
-	0xec, 0xb0, 0x30, 0xa2, 0x07, 0x95, 0x6d, 0x85, 0x92, 0x86, 0x59, 0x96,
-	0x72, 0xa3, 0x37, 0xb2, 0xc3, 0xbf, 0x49, 0xce, 0xfb, 0xdb, 0x67, 0xea,
-	0x2a, 0xf8, 0x8e, 0x06, 0x52, 0x14, 0xbc, 0x22, 0x72, 0x30, 0xf2, 0x3e,
-	0x86, 0x4c, 0x3e, 0x5b, 0x6b, 0x68, 0x1c, 0x78, 0x61, 0x7b, 0x63, 0x6c,
-	0x01, 0x5f, 0x6d, 0x50, 0xbc, 0x42, 0x55, 0x34, 0x88, 0x26, 0x33, 0x18,
-	0x5b, 0x0a, 0x0a, 0xfc, 0x36, 0xee, 0xdd, 0xdf, 0x11, 0xd2, 0xad, 0xc3,
-	0xf4, 0xb5, 0x6d, 0xa7, 0xff, 0x99, 0xb3, 0x8a, 0x6b, 0x83, 0xb3, 0x90,
-	0xa4, 0x9e, 0xdf, 0xac, 0xd1, 0xba, 0x04, 0xc9, 0xfe, 0xd6, 0x2a, 0xe5,
-	0x29, 0xf3, 0x51, 0x01, 0x53, 0x0f, 0x79, 0x1d, 0x7d, 0x2b, 0xa4, 0x39,
-	0xa0, 0x47, 0xd7, 0x55, 0xb2, 0x63, 0x4b, 0x72, 0xfe, 0x7c, 0x45, 0x72,
-	0xb3, 0x63, 0xd8, 0x55, 0x9e, 0x47, 0xa8, 0x39, 0x78, 0x2b, 0x7c, 0x1d,
-	0x52, 0x0f, 0x51, 0x01, 0x2b, 0xf3, 0x26, 0xe5, 0x03, 0xd7, 0xfe, 0xc8,
-	0xd7, 0xba, 0xda, 0xac, 0xa7, 0x9e, 0xae, 0x90, 0x80, 0x83, 0xc1, 0x8a,
-	0xf9, 0x99, 0x6f, 0xa7, 0xf2, 0xb5, 0xb1, 0xc3, 0x0d, 0xd2, 0xe1, 0xdf,
-	0x32, 0xee, 0x0b, 0xfc, 0x5c, 0x0a, 0x33, 0x18, 0x87, 0x26, 0x57, 0x34,
-	0xb8, 0x42, 0x73, 0x50, 0xf8, 0x5e, 0x73, 0x6c, 0x34, 0x7b, 0x03, 0x78,
-	0x74, 0x68, 0x38, 0x5b, 0x8b, 0x4c, 0xef, 0x3e, 0x74, 0x30, 0xba, 0x22,
-	0x53, 0x14, 0x8d, 0x06, 0x2c, 0xf8, 0x64, 0xea, 0xff, 0xdb, 0x43, 0xce,
-	0xcc, 0xbf, 0x2a, 0xb2, 0x84, 0xa3, 0x3f, 0x96, 0xcd, 0x86, 0x9d, 0x85,
-	0xf6, 0x94, 0x3b, 0xa2, 0xe4, 0xb0, 0x84, 0xbe, 0xfa, 0xcc, 0xb9, 0xda,
-	0x1a, 0xe9, 0xe8, 0xf6, 0x41, 0x05, 0x10, 0x13, 0x6e, 0x21, 0x31, 0x2f,
-	0xa2, 0x3d, 0x4a, 0x4b, 0xe8, 0x59, 0x38, 0x67, 0xae, 0x76, 0x2a, 0x7c,
-	0xd1, 0x6d, 0x35, 0x60, 0xc2, 0x51, 0xf8, 0x43, 0xa8, 0x35, 0xc4, 0x27,
-	0x86, 0x19, 0x98, 0x0b, 0x5d, 0xfd, 0x71, 0xef, 0x31, 0xe1, 0x4d, 0xd3,
-	0x01, 0xc5, 0x2d, 0xb7, 0xc9, 0xa8, 0x26, 0x9b, 0x38, 0x8c, 0xc5, 0x82,
-	0x3e, 0x8f, 0x75, 0x9d, 0x84, 0xab, 0x9c, 0xb9, 0xab, 0xc7, 0xc5, 0xd5,
-	0xd5, 0xe3, 0xee, 0xf1, 0xfe, 0xff, 0x15, 0x0e, 0x2a, 0x1c, 0x3b, 0x2a,
-	0x55, 0x38, 0x64, 0x46, 0x7d, 0x54, 0x89, 0x62, 0xc5, 0x70, 0x36, 0x7d,
-	0xce, 0x73, 0xd5, 0x64, 0x3a, 0x57, 0xd2, 0x48, 0xff, 0x3a, 0xb3, 0x2c,
-	0xd0, 0x1e, 0x8d, 0x10, 0xa5, 0x02, 0x66, 0xf4, 0x7c, 0xe6, 0x3a, 0xd8,
-	0x59, 0xca, 0x09, 0xbc, 0x3b, 0xae, 0xcf, 0x9f, 0x2b, 0x92, 0xd9, 0x83,
-	0x50, 0x89, 0xca, 0x98, 0x16, 0xa6, 0xb8, 0xb4, 0x5d, 0xc2, 0xd0, 0xd0,
-	0x90, 0xde, 0xf3, 0xec, 0xbc, 0xfa, 0x1b, 0x09, 0xe5, 0x16, 0x46, 0x25,
-	0x07, 0x33, 0x7b, 0x41, 0x1e, 0x4f, 0xc3, 0x5d, 0x0c, 0x6b, 0x60, 0x7a,
-	0x36, 0x79, 0xbf, 0x69, 0x7e, 0x5c, 0xd4, 0x4d, 0x34, 0x40, 0xbe, 0x31,
-	0x00, 0x24, 0x9e, 0x15, 0xd1, 0x07, 0x75, 0xf9, 0xac, 0xeb, 0x46, 0xdd,
-	0x8c, 0xcf, 0x11, 0xc1, 0x75, 0xb3, 0xc9, 0xa4, 0x8a, 0x97, 0xff, 0x87,
-	0xca, 0x84, 0x90, 0x93, 0x04, 0xa1, 0x91, 0xaf, 0x44, 0xbd, 0xad, 0xcb,
-	0x76, 0xd9, 0xce, 0xe7, 0xa5, 0xf5, 0xf3, 0x03, 0xd0, 0x11, 0x1d, 0x20,
-	0xf4, 0x2d, 0x4e, 0x3c, 0x11, 0x4a, 0x8d, 0x58, 0x0b, 0x66, 0x3a, 0x75,
-	0x84, 0x7c, 0x50, 0x6f, 0x5c, 0x61, 0x21, 0x53, 0x2e, 0x45, 0xfd, 0x36,
-	0x03, 0x29, 0xd3, 0x1a, 0xdb, 0x0c, 0xab, 0xfe, 0xb1, 0xf0, 0x82, 0xe2,
-	0x89, 0xd4, 0x56, 0xc6, 0x66, 0xb8, 0x23, 0xaa, 0x52, 0x9c, 0xb6, 0x8d,
-	0x06, 0x83, 0xb2, 0x8d, 0x50, 0x9c, 0x28, 0xaa, 0x61, 0xb8, 0x5a, 0xc6,
-	0x85, 0xd4, 0x87, 0xe2, 0xab, 0xf0, 0xb1, 0xfe, 0xd6, 0x0c, 0xd6, 0x1a,
-	0x04, 0x29, 0xf8, 0x36, 0x34, 0x45, 0x1a, 0x53, 0x66, 0x61, 0x43, 0x6f,
-	0x9c, 0x7c, 0x48, 0x75, 0x04, 0x66, 0x92, 0x58, 0x0e, 0x4a, 0x4f, 0x3c,
-	0xf3, 0x2d, 0x1f, 0x20, 0xcd, 0x11, 0xf6, 0x03, 0xa3, 0xf5, 0xcf, 0xe7,
-	0x76, 0xd9, 0xac, 0xcb, 0x44, 0xbd, 0x93, 0xaf, 0xff, 0xa0, 0x9c, 0x93,
-	0xa0, 0x84, 0xe4, 0x87, 0x93, 0x97, 0xc6, 0xa4, 0x75, 0xb3, 0x12, 0xc1,
-	0x8b, 0xcf, 0x46, 0xdd, 0xae, 0xeb, 0x71, 0xf9, 0xd6, 0x07, 0x9a, 0x15,
-	0x03, 0x24, 0xba, 0x31, 0x3b, 0x40, 0xc9, 0x4d, 0x8e, 0x5c, 0xa7, 0x69,
-	0x6f, 0x79, 0x91, 0x7a, 0xfc, 0x6a, 0xcc, 0x5d, 0x18, 0x4f, 0x7f, 0x41,
-	0x04, 0x33, 0x49, 0x25, 0xe2, 0x16, 0x1d, 0x09, 0xbb, 0xfa, 0xf3, 0xec,
-	0x91, 0xde, 0xce, 0xd0, 0x5e, 0xc2, 0xb9, 0xb4, 0x13, 0xa6, 0xd2, 0x98,
-	0x39, 0x89, 0xc2, 0x83, 0x37, 0x92, 0xc8, 0x9f, 0x40, 0xae, 0x06, 0xbc,
-	0x5b, 0xca, 0x37, 0xd8, 0x80, 0xe6, 0x62, 0xf4, 0xa8, 0x02, 0x8c, 0x10,
-	0xd0, 0x1e, 0xb3, 0x2c, 0xff, 0x3a, 0xd2, 0x48, 0x3a, 0x57, 0xd4, 0x64,
-	0xd3, 0x73, 0x02, 0x7d, 0xc4, 0x70, 0x8a, 0x62, 0x7c, 0x54, 0x66, 0x46,
-	0x52, 0x38, 0x3e, 0x2a, 0x28, 0x1c, 0x15, 0x0e, 0x01, 0x00, 0xea, 0xf1,
-	0xd8, 0xe3, 0xc2, 0xd5, 0xad, 0xc7, 0x9c, 0xb9, 0x82, 0xab, 0x7a, 0x9d,
-	0x32, 0x8f, 0x15, 0x83, 0x3d, 0x8c, 0x24, 0x9b, 0xcb, 0xa8, 0x2a, 0xb7,
-	0x05, 0xc5, 0x49, 0xd3, 0x34, 0xe1, 0x70, 0xef, 0x5c, 0xfd, 0x9b, 0x0b,
-	0x82, 0x19, 0xc7, 0x27, 0xa8, 0x35, 0xf5, 0x43, 0xc8, 0x51, 0x2c, 0x60,
-	0xde, 0x6d, 0xf8, 0x7b, 0xa5, 0x76, 0x3d, 0x67, 0xe4, 0x59, 0x4d, 0x4b,
-	0x9e, 0x3d, 0x35, 0x2f, 0x6b, 0x21, 0x13, 0x13, 0x3f, 0x05, 0xe8, 0xf6,
-	0x1a, 0xe9, 0xb9, 0xda, 0xfa, 0xcc, 0x86, 0xbe, 0xdf, 0xb0, 0x43, 0xa2,
-	0xea, 0x94, 0xba, 0x85, 0xcd, 0x86, 0x3f, 0x96, 0x83, 0xa3, 0x2c, 0xb2,
-	0xcb, 0xbf, 0x41, 0xce, 0x02, 0xdc, 0x62, 0xea, 0x2d, 0xf8, 0x8e, 0x06,
-	0x51, 0x14, 0xbb, 0x22, 0x75, 0x30, 0xed, 0x3e, 0x8e, 0x4c, 0x35, 0x5b,
-	0x78, 0x68, 0xf9, 0x77, 0x43, 0x7b, 0x6f, 0x6c, 0xfb, 0x5e, 0x72, 0x50,
-	0xb8, 0x42, 0x57, 0x34, 0x87, 0x26, 0x33, 0x18, 0x5c, 0x0a, 0x0b, 0xfc,
-	0x33, 0xee, 0xdf, 0xdf, 0x10, 0xd2, 0xae, 0xc3, 0xf3, 0xb5, 0x70, 0xa7,
-	0xf7, 0x99, 0xc5, 0x8a, 0x59, 0x83, 0xb4, 0x90, 0xa1, 0x9e, 0xe1, 0xac,
-	0xd2, 0xba, 0x01, 0xc9, 0x01, 0xd7, 0x27, 0xe5, 0x2b, 0xf3, 0x51, 0x01,
-	0x51, 0x0f, 0x7d, 0x1d, 0x78, 0x2b, 0xa9, 0x39, 0x9c, 0x47, 0xd8, 0x55,
-	0xb5, 0x63, 0x42, 0x72, 0x3b, 0x7d, 0x4d, 0x72, 0xad, 0x63, 0xdd, 0x55,
-	0x9b, 0x47, 0xa9, 0x39, 0x78, 0x2b, 0x7c, 0x1d, 0x52, 0x0f, 0x51, 0x01,
-	0x2b, 0xf3, 0x27, 0xe5, 0x00, 0xd7, 0x02, 0xc9, 0xd2, 0xba, 0xe1, 0xac,
-	0x9f, 0x9e, 0xbe, 0x90, 0x14, 0x83, 0xa8, 0x8a, 0x06, 0x9a, 0x67, 0xa7,
-	0xf9, 0xb5, 0xaa, 0xc3, 0x12, 0xd2, 0xdd, 0xdf, 0x37, 0xee, 0x06, 0xfc,
-	0x61, 0x0a, 0x2d, 0x18, 0x8d, 0x26, 0x51, 0x34, 0xbf, 0x42, 0x6b, 0x50,
-	0x02, 0x5f, 0x63, 0x6c, 0x74, 0x7b, 0x1a, 0x78, 0x6a, 0x68, 0x3e, 0x5b,
-	0x86, 0x4c, 0xf3, 0x3e, 0x71, 0x30, 0xbd, 0x22, 0x51, 0x14, 0x8e, 0x06,
-	0x2b, 0xf8, 0x65, 0xea, 0xff, 0xdb, 0x43, 0xce, 0xca, 0xbf, 0x2f, 0xb2,
-	0x7d, 0xa3, 0x49, 0x96, 0xb1, 0x86, 0xa2, 0x85, 0xf8, 0x94, 0x39, 0xa2,
-	0xe6, 0xb0, 0x82, 0xbe, 0xfc, 0xcc, 0xb7, 0xda, 0x1c, 0xe9, 0xe6, 0xf6,
-	0x43, 0x05, 0x0f, 0x13, 0x6d, 0x21, 0x32, 0x2f, 0xa2, 0x3d, 0x49, 0x4b,
-	0xe9, 0x59, 0x37, 0x67, 0xaf, 0x76, 0x01, 0x7c, 0xd5, 0x6d, 0x32, 0x60,
-	0xc5, 0x51, 0xf6, 0x43, 0xa7, 0x35, 0xc8, 0x27, 0x82, 0x19, 0x9b, 0x0b,
-	0x5c, 0xfd, 0x70, 0xef, 0x33, 0xe1, 0x4a, 0xd3, 0x04, 0xc5, 0x2c, 0xb7,
-	0xc8, 0xa8, 0x28, 0x9b, 0x35, 0x8c, 0x28, 0x83, 0x37, 0x8f, 0x77, 0x9d,
-	0x83, 0xab, 0x9b, 0xb9, 0xad, 0xc7, 0xc3, 0xd5, 0xd8, 0xe3, 0xea, 0xf1,
-	0x01, 0x00, 0x13, 0x0e, 0x2a, 0x1c, 0x3d, 0x2a, 0x53, 0x38, 0x66, 0x46,
-	0x7a, 0x54, 0x8b, 0x62, 0xc8, 0x70, 0xd9, 0x7c, 0xcb, 0x73, 0xd7, 0x64,
-	0x39, 0x57, 0xd3, 0x48, 0xfd, 0x3a, 0xb5, 0x2c, 0xce, 0x1e, 0x8f, 0x10,
-	0xa4, 0x02, 0x67, 0xf4, 0x7a, 0xe6, 0x3d, 0xd8, 0x54, 0xca, 0x0e, 0xbc,
-	0x38, 0xae, 0xd1, 0x9f, 0x28, 0x92, 0x01, 0x84, 0x51, 0x89, 0xc6, 0x98,
-	0x1c, 0xa6, 0xb1, 0xb4, 0x64, 0xc2, 0xca, 0xd0, 0x94, 0xde, 0xf1, 0xec,
-	0xbe, 0xfa, 0x18, 0x09, 0xe8, 0x16, 0x42, 0x25, 0x0c, 0x33, 0x78, 0x41,
-	0x1e, 0x4f, 0xc4, 0x5d, 0x0a, 0x6b, 0x5d, 0x7a, 0x50, 0x79, 0xb6, 0x69,
-	0x83, 0x5c, 0xd1, 0x4d, 0x37, 0x40, 0xbb, 0x31, 0x04, 0x24, 0x97, 0x15,
-	0xda, 0x07, 0x6d, 0xf9, 0xb2, 0xeb, 0x42, 0xdd, 0x8f, 0xcf, 0x0e, 0xc1,
-	0x79, 0xb3, 0xc3, 0xa4, 0x94, 0x97, 0xea, 0x87, 0x87, 0x84, 0xa1, 0x93,
-	0xfb, 0xa0, 0x97, 0xaf, 0x41, 0xbd, 0xae, 0xcb, 0x73, 0xd9, 0xd4, 0xe7,
-	0x9d, 0xf5, 0xfd, 0x03, 0xc5, 0x11, 0x27, 0x20, 0xeb, 0x2d, 0x58, 0x3c,
-	0x05, 0x4a, 0x9c, 0x58, 0xf8, 0x65, 0x59, 0x75, 0xec, 0x7c, 0x40, 0x6f,
-	0x65, 0x61, 0x1b, 0x53, 0x32, 0x45, 0xfa, 0x36, 0x04, 0x29, 0xd5, 0x1a,
-	0xd8, 0x0c, 0xae, 0xfe, 0xad, 0xf0, 0x86, 0xe2, 0x86, 0xd4, 0x59, 0xc6,
-	0x64, 0xb8, 0x23, 0xaa, 0x53, 0x9c, 0xb2, 0x8d, 0xc8, 0x82, 0xba, 0x8d,
-	0x4f, 0x9c, 0x25, 0xaa, 0x66, 0xb8, 0x54, 0xc6, 0x8c, 0xd4, 0x7f, 0xe2,
-	0xb3, 0xf0, 0xac, 0xfe, 0xd7, 0x0c, 0xd7, 0x1a, 0x01, 0x29, 0xfd, 0x36,
-	0x30, 0x45, 0x1d, 0x53, 0x62, 0x61, 0x49, 0x6f, 0xa8, 0x7c, 0x3c, 0x75,
-	0x07, 0x66, 0x91, 0x58, 0x0e, 0x4a, 0x4f, 0x3c, 0xf5, 0x2d, 0x1c, 0x20,
-	0xd1, 0x11, 0xf0, 0x03, 0xaa, 0xf5, 0xc9, 0xe7, 0x7b, 0xd9, 0xa8, 0xcb,
-	0x47, 0xbd, 0x90, 0xaf, 0x05, 0xa1, 0x8f, 0x93, 0xbf, 0x84, 0x06, 0x88,
-	0x88, 0x97, 0xcb, 0xa4, 0x73, 0xb3, 0x13, 0xc1, 0x8a, 0xcf, 0x47, 0xdd,
-	0xab, 0xeb, 0x77, 0xf9, 0xd0, 0x07, 0x9f, 0x15, 0xfe, 0x23, 0xbe, 0x31,
-	0x37, 0x40, 0xd1, 0x4d, 0x80, 0x5c, 0xbf, 0x69, 0x33, 0x79, 0x49, 0x7a,
-	0x11, 0x6b, 0xc2, 0x5d, 0x1d, 0x4f, 0x7c, 0x41, 0x06, 0x33, 0x47, 0x25,
-	0xe5, 0x16, 0x1a, 0x09, 0xbd, 0xfa, 0xf2, 0xec, 0x92, 0xde, 0xcc, 0xd0,
-	0x62, 0xc2, 0xb2, 0xb4, 0x1d, 0xa6, 0xc2, 0x98, 0x5d, 0x89, 0x05, 0x84,
-	0x25, 0x92, 0xd0, 0x9f, 0x3c, 0xae, 0x08, 0xbc, 0x59, 0xca, 0x3b, 0xd8,
-	0x79, 0xe6, 0x6b, 0xf4, 0x9f, 0x02, 0x92, 0x10, 0xcd, 0x1e, 0xb6, 0x2c,
-	0xfb, 0x3a, 0xd7, 0x48, 0x33, 0x57, 0xde, 0x64, 0xc2, 0x73, 0xed, 0x7c,
-	0xca, 0x70, 0x8a, 0x62, 0x7a, 0x54, 0x67, 0x46, 0x54, 0x38, 0x3a, 0x2a,
-	0x2b, 0x1c, 0x14, 0x0e, 0xff, 0xff, 0xee, 0xf1, 0xd5, 0xe3, 0xc3, 0xd5,
-	0xae, 0xc7, 0x9a, 0xb9, 0x85, 0xab, 0x74, 0x9d, 0x3f, 0x8f, 0xfa, 0x82,
-	0x32, 0x8c, 0x28, 0x9b, 0xc8, 0xa8, 0x2d, 0xb7, 0x02, 0xc5, 0x4b, 0xd3,
-	0x34, 0xe1, 0x6e, 0xef, 0x5f, 0xfd, 0x99, 0x0b, 0x82, 0x19, 0xc9, 0x27,
-	0xa4, 0x35, 0xfb, 0x43, 0xc0, 0x51, 0x38, 0x60, 0xc9, 0x6d, 0x3f, 0x7c,
-	0xc5, 0x76, 0x2f, 0x67, 0xee, 0x59, 0x44, 0x4b, 0xa7, 0x3d, 0x2d, 0x2f,
-	0x72, 0x21, 0x0c, 0x13, 0x44, 0x05, 0xe5, 0xf6, 0x1c, 0xe9, 0xb8, 0xda,
-	0xfc, 0xcc, 0x81, 0xbe, 0xe8, 0xb0, 0x34, 0xa2, 0x04, 0x95, 0x6e, 0x85,
-	0x94, 0x86, 0x54, 0x96, 0x78, 0xa3, 0x33, 0xb2, 0xc5, 0xbf, 0x49, 0xce,
-	0xf8, 0xdb, 0x6b, 0xea, 0x27, 0xf8, 0x90, 0x06, 0x52, 0x14, 0xba, 0x22,
-	0x74, 0x30, 0xf0, 0x3e, 0x88, 0x4c, 0x3d, 0x5b, 0x6b, 0x68, 0x1c, 0x78,
-	0x62, 0x7b, 0x61, 0x6c, 0x03, 0x5f, 0x6c, 0x50, 0xbc, 0x42, 0x56, 0x34,
-	0x87, 0x26, 0x34, 0x18, 0x58, 0x0a, 0x11, 0xfc, 0x2d, 0xee, 0xe5, 0xdf,
-	0x0a, 0xd2, 0xb3, 0xc3, 0xf0, 0xb5, 0x71, 0xa7, 0xf9, 0x99, 0xb9, 0x8a,
-	0x65, 0x83, 0xba, 0x90, 0x9d, 0x9e, 0xe4, 0xac, 0xcd, 0xba, 0x08, 0xc9,
-	0xfa, 0xd6, 0x2d, 0xe5, 0x26, 0xf3, 0x54, 0x01, 0x51, 0x0f, 0x7c, 0x1d,
-	0x78, 0x2b, 0xa9, 0x39, 0x9c, 0x47, 0xdb, 0x55, 0xaf, 0x63, 0x4c, 0x72,
-	0xfe, 0x7c, 0x44, 0x72, 0xb5, 0x63, 0xd7, 0x55, 0x9e, 0x47, 0xa8, 0x39,
-	0x77, 0x2b, 0x7e, 0x1d, 0x50, 0x0f, 0x54, 0x01, 0x27, 0xf3, 0x2b, 0xe5,
-	0xfd, 0xd6, 0x04, 0xc9, 0xd2, 0xba, 0xdf, 0xac, 0xa4, 0x9e, 0xaf, 0x90,
-	0x7f, 0x83, 0xc1, 0x8a, 0xfa, 0x99, 0x6f, 0xa7, 0xf2, 0xb5, 0xb0, 0xc3,
-	0x0d, 0xd2, 0xe2, 0xdf, 0x31, 0xee, 0x0d, 0xfc, 0x5a, 0x0a, 0x33, 0x18,
-	0x88, 0x26, 0x57, 0x34, 0xb8, 0x42, 0x72, 0x50, 0xf9, 0x5e, 0x72, 0x6c,
-	0x36, 0x7b, 0x00, 0x78, 0x77, 0x68, 0x35, 0x5b, 0x8e, 0x4c, 0xec, 0x3e,
-	0x76, 0x30, 0xb9, 0x22, 0x54, 0x14, 0x8c, 0x06, 0x2d, 0xf8, 0x64, 0xea,
-	0xff, 0xdb, 0x43, 0xce, 0xca, 0xbf, 0x2e, 0xb2, 0x80, 0xa3, 0x44, 0x96,
-	0xc7, 0x86, 0xa2, 0x85, 0xf3, 0x94, 0x3d, 0xa2, 0xe3, 0xb0, 0x85, 0xbe,
-	0xf8, 0xcc, 0xbb, 0xda, 0x1a, 0xe9, 0xe7, 0xf6, 0x42, 0x05, 0x0f, 0x13,
-	0x6d, 0x21, 0x34, 0x2f, 0x9f, 0x3d, 0x4c, 0x4b, 0xe7, 0x59, 0x38, 0x67,
-	0xae, 0x76, 0x2b, 0x7c, 0xd0, 0x6d, 0x36, 0x60, 0xc1, 0x51, 0xf9, 0x43,
-	0xa8, 0x35, 0xc4, 0x27, 0x86, 0x19, 0x98, 0x0b, 0x5d, 0xfd, 0x72, 0xef,
-	0x30, 0xe1, 0x4d, 0xd3, 0x01, 0xc5, 0x2e, 0xb7, 0xc7, 0xa8, 0x29, 0x9b,
-	0x34, 0x8c, 0xc8, 0x82, 0x3d, 0x8f, 0x75, 0x9d, 0x85, 0xab, 0x99, 0xb9,
-	0xaf, 0xc7, 0xc1, 0xd5, 0xd9, 0xe3, 0xea, 0xf1, 0x01, 0x00, 0x14, 0x0e,
-	0x28, 0x1c, 0x40, 0x2a, 0x50, 0x38, 0x67, 0x46, 0x7c, 0x54, 0x89, 0x62,
-	0xc6, 0x70, 0x36, 0x7d, 0xcc, 0x73, 0xd7, 0x64, 0x39, 0x57, 0xd3, 0x48,
-	0xfe, 0x3a, 0xb3, 0x2c, 0xcf, 0x1e, 0x8f, 0x10, 0xa4, 0x02, 0x66, 0xf4,
-	0x7d, 0xe6, 0x37, 0xd8, 0x5d, 0xca, 0x05, 0xbc, 0x3f, 0xae, 0xcb, 0x9f,
-	0x2e, 0x92, 0xd8, 0x83, 0x50, 0x89, 0xc9, 0x98, 0x18, 0xa6, 0xb5, 0xb4,
-	0x61, 0xc2, 0xcc, 0xd0, 0x94, 0xde, 0xef, 0xec, 0xc0, 0xfa, 0x18, 0x09,
-	0xe6, 0x16, 0x46, 0x25, 0x07, 0x33, 0x7b, 0x41, 0x1e, 0x4f, 0xc2, 0x5d,
-	0x0e, 0x6b, 0x5e, 0x7a, 0x38, 0x79, 0xbc, 0x69, 0x81, 0x5c, 0xd1, 0x4d,
-	0x38, 0x40, 0xbb, 0x31, 0x02, 0x24, 0x9b, 0x15, 0xd4, 0x07, 0x74, 0xf9,
-	0xac, 0xeb, 0x47, 0xdd, 0x8a, 0xcf, 0x13, 0xc1, 0x73, 0xb3, 0xcb, 0xa4,
-	0x88, 0x97, 0x02, 0x88, 0xc7, 0x84, 0x91, 0x93, 0x04, 0xa1, 0x91, 0xaf,
-	0x45, 0xbd, 0xac, 0xcb, 0x75, 0xd9, 0xd0, 0xe7, 0xa4, 0xf5, 0xf3, 0x03,
-	0xd1, 0x11, 0x1b, 0x20, 0xf6, 0x2d, 0x4e, 0x3c, 0x0f, 0x4a, 0x90, 0x58,
-	0x08, 0x66, 0x3e, 0x75, 0x80, 0x7c, 0x52, 0x6f, 0x5b, 0x61, 0x23, 0x53,
-	0x2b, 0x45, 0x00, 0x37, 0xfe, 0x28, 0xda, 0x1a, 0xd5, 0x0c, 0xaf, 0xfe,
-	0xad, 0xf0, 0x86, 0xe2, 0x85, 0xd4, 0x5b, 0xc6, 0x60, 0xb8, 0x29, 0xaa,
-	0x4d, 0x9c, 0xba, 0x8d, 0x04, 0x83, 0xb1, 0x8d, 0x53, 0x9c, 0x24, 0xaa,
-	0x65, 0xb8, 0x57, 0xc6, 0x87, 0xd4, 0x84, 0xe2, 0xb0, 0xf0, 0xab, 0xfe,
-	0xdb, 0x0c, 0xd2, 0x1a, 0x06, 0x29, 0xf9, 0x36, 0x31, 0x45, 0x1e, 0x53,
-	0x60, 0x61, 0x4a, 0x6f, 0x98, 0x7c, 0x49, 0x75, 0x05, 0x66, 0x90, 0x58,
-	0x0f, 0x4a, 0x50, 0x3c, 0xf2, 0x2d, 0x1f, 0x20, 0xcf, 0x11, 0xf2, 0x03,
-	0xa7, 0xf5, 0xcc, 0xe7, 0x78, 0xd9, 0xac, 0xcb, 0x42, 0xbd, 0x96, 0xaf,
-	0xfc, 0xa0, 0x9f, 0x93, 0x9d, 0x84, 0xe6, 0x87, 0x94, 0x97, 0xc3, 0xa4,
-	0x79, 0xb3, 0x0e, 0xc1, 0x8e, 0xcf, 0x44, 0xdd, 0xae, 0xeb, 0x72, 0xf9,
-	0xd6, 0x07, 0x99, 0x15, 0x04, 0x24, 0xb9, 0x31, 0x3a, 0x40, 0xcd, 0x4d,
-	0x89, 0x5c, 0xac, 0x69, 0x6b, 0x79, 0x93, 0x7a, 0xfb, 0x6a, 0xcd, 0x5d,
-	0x17, 0x4f, 0x80, 0x41, 0x03, 0x33, 0x49, 0x25, 0xe3, 0x16, 0x1c, 0x09,
-	0xbb, 0xfa, 0xf4, 0xec, 0x8f, 0xde, 0xd1, 0xd0, 0x5c, 0xc2, 0xb9, 0xb4,
-	0x14, 0xa6, 0xd0, 0x98, 0x3b, 0x89, 0xc2, 0x83, 0x36, 0x92, 0xc8, 0x9f,
-	0x40, 0xae, 0x05, 0xbc, 0x5d, 0xca, 0x36, 0xd8, 0x7f, 0xe6, 0x64, 0xf4,
-	0xa6, 0x02, 0x8e, 0x10, 0xce, 0x1e, 0xb5, 0x2c, 0xfd, 0x3a, 0xd4, 0x48,
-	0x38, 0x57, 0xd6, 0x64, 0xd2, 0x73, 0x03, 0x7d, 0xc2, 0x70, 0x8c, 0x62,
-	0x7a, 0x54, 0x68, 0x46, 0x50, 0x38, 0x3f, 0x2a, 0x28, 0x1c, 0x16, 0x0e,
-	0xfe, 0xff, 0xed, 0xf1, 0xd5, 0xe3, 0xc5, 0xd5, 0xad, 0xc7, 0x9a, 0xb9,
-	0x82, 0xab, 0x7c, 0x9d, 0x2f, 0x8f, 0x19, 0x83, 0x3a, 0x8c, 0x24, 0x9b,
-	0xcd, 0xa8, 0x27, 0xb7, 0x08, 0xc5, 0x47, 0xd3, 0x35, 0xe1, 0x6f, 0xef,
-	0x5d, 0xfd, 0x9a, 0x0b, 0x84, 0x19, 0xc5, 0x27, 0xa9, 0x35, 0xf5, 0x43,
-	0xc7, 0x51, 0x2e, 0x60, 0xdc, 0x6d, 0xfa, 0x7b, 0xa4, 0x76, 0x3c, 0x67,
-	0xe6, 0x59, 0x4b, 0x4b, 0xa0, 0x3d, 0x33, 0x2f, 0x6d, 0x21, 0x10, 0x13,
-	0x42, 0x05, 0xe6, 0xf6, 0x1b, 0xe9, 0xb9, 0xda, 0xfa, 0xcc, 0x84, 0xbe,
-	0xe3, 0xb0, 0x3d, 0xa2, 0xf1, 0x94, 0xb5, 0x85, 0xd0, 0x86, 0x3c, 0x96,
-	0x87, 0xa3, 0x27, 0xb2, 0xcf, 0xbf, 0x40, 0xce, 0x01, 0xdc, 0x64, 0xea,
-	0x2c, 0xf8, 0x8c, 0x06, 0x54, 0x14, 0xb9, 0x22, 0x77, 0x30, 0xeb, 0x3e,
-	0x8f, 0x4c, 0x33, 0x5b, 0x7a, 0x68, 0xf9, 0x77, 0x42, 0x7b, 0x70, 0x6c,
-	0xfb, 0x5e, 0x6f, 0x50, 0xbc, 0x42, 0x54, 0x34, 0x8a, 0x26, 0x30, 0x18,
-	0x5e, 0x0a, 0x08, 0xfc, 0x36, 0xee, 0xde, 0xdf, 0x10, 0xd2, 0xae, 0xc3,
-	0xf3, 0xb5, 0x70, 0xa7, 0xf7, 0x99, 0xc5, 0x8a, 0x59, 0x83, 0xb4, 0x90,
-	0xa2, 0x9e, 0xe1, 0xac, 0xcf, 0xba, 0x06, 0xc9, 0xfb, 0xd6, 0x2d, 0xe5,
-	0x27, 0xf3, 0x52, 0x01, 0x53, 0x0f, 0x7a, 0x1d, 0x7b, 0x2b, 0xa5, 0x39,
-	0xa0, 0x47, 0xd6, 0x55, 0xb5, 0x63, 0x44, 0x72, 0x38, 0x7d, 0x4f, 0x72,
-	0xad, 0x63, 0xdc, 0x55, 0x9d, 0x47, 0xa6, 0x39, 0x7c, 0x2b, 0x77, 0x1d,
-	0x58, 0x0f, 0x4c, 0x01, 0x2e, 0xf3, 0x25, 0xe5, 0x01, 0xd7, 0x03, 0xc9,
-	0xd1, 0xba, 0xe1, 0xac, 0x9f, 0x9e, 0xbd, 0x90, 0x17, 0x83, 0xa6, 0x8a,
-	0x06, 0x9a, 0x68, 0xa7, 0xf7, 0xb5, 0xac, 0xc3, 0x12, 0xd2, 0xdc, 0xdf,
-	0x36, 0xee, 0x09, 0xfc, 0x5d, 0x0a, 0x32, 0x18, 0x88, 0x26, 0x55, 0x34,
-	0xbc, 0x42, 0x6d, 0x50, 0x00, 0x5f, 0x64, 0x6c, 0x75, 0x7b, 0x19, 0x78,
-	0x6b, 0x68, 0x3b, 0x5b, 0x8a, 0x4c, 0xef, 0x3e, 0x75, 0x30, 0xba, 0x22,
-	0x53, 0x14, 0x8d, 0x06, 0x2b, 0xf8, 0x65, 0xea, 0xff, 0xdb, 0x44, 0xce,
-	0xca, 0xbf, 0x2d, 0xb2, 0x7f, 0xa3, 0x48, 0x96, 0xb1, 0x86, 0xa4, 0x85,
-	0xf4, 0x94, 0x3e, 0xa2, 0xe1, 0xb0, 0x86, 0xbe, 0xf8, 0xcc, 0xbb, 0xda,
-	0x1a, 0xe9, 0xe7, 0xf6, 0x41, 0x05, 0x10, 0x13, 0x6e, 0x21, 0x32, 0x2f,
-	0xa1, 0x3d, 0x49, 0x4b, 0xe9, 0x59, 0x38, 0x67, 0xb0, 0x76, 0xfe, 0x7b,
-	0xd7, 0x6d, 0x31, 0x60, 0xc6, 0x51, 0xf5, 0x43, 0xa8, 0x35, 0xc6, 0x27,
-	0x84, 0x19, 0x99, 0x0b, 0x5e, 0xfd, 0x6e, 0xef, 0x35, 0xe1, 0x48, 0xd3,
-	0x06, 0xc5, 0x29, 0xb7, 0xcc, 0xa8, 0x25, 0x9b, 0x36, 0x8c, 0x2a, 0x83,
-	0x32, 0x8f, 0x7c, 0x9d, 0x81, 0xab, 0x9b, 0xb9, 0xae, 0xc7, 0xc2, 0xd5,
-	0xd8, 0xe3, 0xea, 0xf1, 0x02, 0x00, 0x12, 0x0e, 0x2c, 0x1c, 0x3b, 0x2a,
-	0x54, 0x38, 0x64, 0x46, 0x7e, 0x54, 0x87, 0x62, 0xcb, 0x70, 0xd8, 0x7c,
-	0xc9, 0x73, 0xda, 0x64, 0x36, 0x57, 0xd6, 0x48, 0xfa, 0x3a, 0xb7, 0x2c,
-	0xcd, 0x1e, 0x90, 0x10, 0xa3, 0x02, 0x66, 0xf4, 0x7c, 0xe6, 0x3b, 0xd8,
-	0x58, 0xca, 0x09, 0xbc, 0x3c, 0xae, 0xcd, 0x9f, 0x2c, 0x92, 0xfe, 0x83,
-	0x53, 0x89, 0xc6, 0x98, 0x1a, 0xa6, 0xb5, 0xb4, 0x5e, 0xc2, 0xcf, 0xd0,
-	0x91, 0xde, 0xf3, 0xec, 0xbc, 0xfa, 0x1b, 0x09, 0xe4, 0x16, 0x47, 0x25,
-	0x07, 0x33, 0x7a, 0x41, 0x1f, 0x4f, 0xc3, 0x5d, 0x0b, 0x6b, 0x5c, 0x7a,
-	0x50, 0x79, 0xb6, 0x69, 0x84, 0x5c, 0xd0, 0x4d, 0x38, 0x40, 0xbb, 0x31,
-	0x02, 0x24, 0x9a, 0x15, 0xd6, 0x07, 0x73, 0xf9, 0xac, 0xeb, 0x47, 0xdd,
-	0x8b, 0xcf, 0x10, 0xc1, 0x7a, 0xb3, 0xc0, 0xa4, 0x97, 0x97, 0xe8, 0x87,
-	0x89, 0x84, 0x9f, 0x93, 0xfc, 0xa0, 0x97, 0xaf, 0x40, 0xbd, 0xb0, 0xcb,
-	0x72, 0xd9, 0xd3, 0xe7, 0x9f, 0xf5, 0xfb, 0x03, 0xc7, 0x11, 0x26, 0x20,
-	0xec, 0x2d, 0x56, 0x3c, 0x08, 0x4a, 0x97, 0x58, 0xfe, 0x65, 0x53, 0x75,
-	0xf2, 0x7c, 0x3b, 0x6f, 0x67, 0x61, 0x1a, 0x53, 0x33, 0x45, 0xfa, 0x36,
-	0x04, 0x29, 0xd4, 0x1a, 0xd9, 0x0c, 0xad, 0xfe, 0xae, 0xf0, 0x87, 0xe2,
-	0x84, 0xd4, 0x5b, 0xc6, 0x61, 0xb8, 0x26, 0xaa, 0x53, 0x9c, 0xb0, 0x8d,
-	0xca, 0x82, 0xb8, 0x8d, 0x51, 0x9c, 0x25, 0xaa, 0x63, 0xb8, 0x59, 0xc6,
-	0x86, 0xd4, 0x86, 0xe2, 0xac, 0xf0, 0xb1, 0xfe, 0xd4, 0x0c, 0xd9, 0x1a,
-	0x00, 0x29, 0xfd, 0x36, 0x30, 0x45, 0x1e, 0x53, 0x60, 0x61, 0x4b, 0x6f,
-	0xa7, 0x7c, 0x3b, 0x75, 0x0a, 0x66, 0x8e, 0x58, 0x10, 0x4a, 0x4e, 0x3c,
-	0xf4, 0x2d, 0x1f, 0x20, 0xcd, 0x11, 0xf5, 0x03, 0xa4, 0xf5, 0xce, 0xe7,
-	0x78, 0xd9, 0xab, 0xcb, 0x44, 0xbd, 0x91, 0xaf, 0x04, 0xa1, 0x91, 0x93,
-	0xbd, 0x84, 0x08, 0x88, 0x86, 0x97, 0xcd, 0xa4, 0x71, 0xb3, 0x13, 0xc1,
-	0x8c, 0xcf, 0x44, 0xdd, 0xb0, 0xeb, 0x71, 0xf9, 0xd5, 0x07, 0x9c, 0x15,
-	0xff, 0x23, 0xbf, 0x31, 0x34, 0x40, 0xd6, 0x4d, 0x7b, 0x5c, 0xc3, 0x69,
-	0x31, 0x79, 0x48, 0x7a, 0x14, 0x6b, 0xbe, 0x5d, 0x21, 0x4f, 0x79, 0x41,
-	0x08, 0x33, 0x45, 0x25, 0xe8, 0x16, 0x15, 0x09, 0xc3, 0xfa, 0xed, 0xec,
-	0x94, 0xde, 0xcd, 0xd0, 0x60, 0xc2, 0xb4, 0xb4, 0x1c, 0xa6, 0xc2, 0x98,
-	0x5d, 0x89, 0x06, 0x84, 0x24, 0x92, 0xd2, 0x9f, 0x39, 0xae, 0x0b, 0xbc,
-	0x57, 0xca, 0x3c, 0xd8, 0x7b, 0xe6, 0x66, 0xf4, 0xa5, 0x02, 0x8d, 0x10,
-	0xd0, 0x1e, 0xb4, 0x2c, 0xfc, 0x3a, 0xd7, 0x48, 0x33, 0x57, 0xde, 0x64,
-	0xc1, 0x73, 0xed, 0x7c, 0xcc, 0x70, 0x87, 0x62, 0x7d, 0x54, 0x65, 0x46,
-	0x54, 0x38, 0x3c, 0x2a, 0x29, 0x1c, 0x15, 0x0e, 0xff, 0xff, 0xed, 0xf1,
-	0xd7, 0xe3, 0xc1, 0xd5, 0xb0, 0xc7, 0x97, 0xb9, 0x88, 0xab, 0x72, 0x9d,
-	0x40, 0x8f, 0xfb, 0x82, 0x2f, 0x8c, 0x2a, 0x9b, 0xc8, 0xa8, 0x2c, 0xb7,
-	0x03, 0xc5, 0x4c, 0xd3, 0x30, 0xe1, 0x74, 0xef, 0x59, 0xfd, 0x9d, 0x0b,
-	0x81, 0x19, 0xc9, 0x27, 0xa4, 0x35, 0xfb, 0x43, 0xc0, 0x51, 0x38, 0x60,
-	0xca, 0x6d, 0x3d, 0x7c, 0xc7, 0x76, 0x2e, 0x67, 0xee, 0x59, 0x46, 0x4b,
-	0xa3, 0x3d, 0x32, 0x2f, 0x6c, 0x21, 0x13, 0x13, 0x3e, 0x05, 0xe9, 0xf6,
-	0x1a, 0xe9, 0xb9, 0xda, 0xfb, 0xcc, 0x82, 0xbe, 0xe7, 0xb0, 0x35, 0xa2,
-	0x03, 0x95, 0x6f, 0x85, 0x92, 0x86, 0x57, 0x96, 0x75, 0xa3, 0x35, 0xb2,
-	0xc4, 0xbf, 0x49, 0xce, 0xf9, 0xdb, 0x6a, 0xea, 0x28, 0xf8, 0x8f, 0x06,
-	0x52, 0x14, 0xba, 0x22, 0x75, 0x30, 0xef, 0x3e, 0x89, 0x4c, 0x3c, 0x5b,
-	0x6c, 0x68, 0x1b, 0x78, 0x63, 0x7b, 0x60, 0x6c, 0x05, 0x5f, 0x6a, 0x50,
-	0xbd, 0x42, 0x56, 0x34, 0x86, 0x26, 0x35, 0x18, 0x59, 0x0a, 0x0d, 0xfc,
-	0x32, 0xee, 0xe0, 0xdf, 0x10, 0xd2, 0xad, 0xc3, 0xf5, 0xb5, 0x6b, 0xa7,
-	0xff, 0x99, 0xb6, 0x8a, 0x67, 0x83, 0xb7, 0x90, 0xa0, 0x9e, 0xe1, 0xac,
-	0xd1, 0xba, 0x05, 0xc9, 0xfb, 0xd6, 0x2d, 0xe5, 0x26, 0xf3, 0x53, 0x01,
-	0x53, 0x0f, 0x7a, 0x1d, 0x79, 0x2b, 0xa9, 0x39, 0x9a, 0x47, 0xde, 0x55,
-	0xac, 0x63, 0x4f, 0x72, 0xfb, 0x7c, 0x46, 0x72, 0xb5, 0x63, 0xd5, 0x55,
-	0xa1, 0x47, 0xa5, 0x39, 0x7a, 0x2b, 0x7c, 0x1d, 0x51, 0x0f, 0x52, 0x01,
-	0x2a, 0xf3, 0x28, 0xe5, 0x00, 0xd7, 0x02, 0xc9, 0xd2, 0xba, 0xdf, 0xac,
-	0xa5, 0x9e, 0xae, 0x90, 0x7f, 0x83, 0xc3, 0x8a, 0xf6, 0x99, 0x74, 0xa7,
-	0xee, 0xb5, 0xb2, 0xc3, 0x0d, 0xd2, 0xe1, 0xdf, 0x32, 0xee, 0x0d, 0xfc,
-	0x58, 0x0a, 0x37, 0x18, 0x84, 0x26, 0x59, 0x34, 0xb8, 0x42, 0x70, 0x50,
-	0xfe, 0x5e, 0x6b, 0x6c, 0x3c, 0x7b, 0xfc, 0x77, 0x79, 0x68, 0x36, 0x5b,
-	0x8a, 0x4c, 0xf1, 0x3e, 0x72, 0x30, 0xbd, 0x22, 0x50, 0x14, 0x8e, 0x06,
-	0x2d, 0xf8, 0x63, 0xea, 0x01, 0xdc, 0x41, 0xce, 0xcb, 0xbf, 0x2e, 0xb2,
-	0x80, 0xa3, 0x43, 0x96, 0xc8, 0x86, 0xa1, 0x85, 0xf4, 0x94, 0x3d, 0xa2,
-	0xe2, 0xb0, 0x85, 0xbe, 0xf9, 0xcc, 0xb9, 0xda, 0x1c, 0xe9, 0xe6, 0xf6,
-	0x43, 0x05, 0x0e, 0x13, 0x6e, 0x21, 0x32, 0x2f, 0xa2, 0x3d, 0x4a, 0x4b,
-	0xe7, 0x59, 0x39, 0x67, 0xad, 0x76, 0x2b, 0x7c, 0xd1, 0x6d, 0x34, 0x60,
-	0xc2, 0x51, 0xfa, 0x43, 0xa4, 0x35, 0xca, 0x27, 0x7f, 0x19, 0x9f, 0x0b,
-	0x57, 0xfd, 0x76, 0xef, 0x2d, 0xe1, 0x4f, 0xd3, 0x01, 0xc5, 0x2e, 0xb7,
-	0xc6, 0xa8, 0x2b, 0x9b, 0x30, 0x8c, 0xce, 0x82, 0x37, 0x8f, 0x7b, 0x9d,
-	0x7f, 0xab, 0x9f, 0xb9, 0xa9, 0xc7, 0xc7, 0xd5, 0xd4, 0xe3, 0xed, 0xf1,
-	0x01, 0x00, 0x11, 0x0e, 0x2d, 0x1c, 0x3a, 0x2a, 0x54, 0x38, 0x65, 0x46,
-	0x7d, 0x54, 0x88, 0x62, 0xc7, 0x70, 0x33, 0x7d, 0xd1, 0x73, 0xd1, 0x64,
-	0x40, 0x57, 0xcc, 0x48, 0x03, 0x3b, 0xb1, 0x2c, 0xcf, 0x1e, 0x90, 0x10,
-	0xa2, 0x02, 0x68, 0xf4, 0x7b, 0xe6, 0x3b, 0xd8, 0x58, 0xca, 0x08, 0xbc,
-	0x3d, 0xae, 0xce, 0x9f, 0x2c, 0x92, 0xd9, 0x83, 0x4e, 0x89, 0xcb, 0x98,
-	0x17, 0xa6, 0xb7, 0xb4, 0x5e, 0xc2, 0xcf, 0xd0, 0x91, 0xde, 0xf2, 0xec,
-	0xbe, 0xfa, 0x18, 0x09, 0xe7, 0x16, 0x46, 0x25, 0x07, 0x33, 0x7b, 0x41,
-	0x1d, 0x4f, 0xc3, 0x5d, 0x0d, 0x6b, 0x5f, 0x7a, 0x37, 0x79, 0xbe, 0x69,
-	0x7e, 0x5c, 0xd4, 0x4d, 0x35, 0x40, 0xbd, 0x31, 0x02, 0x24, 0x99, 0x15,
-	0xd7, 0x07, 0x71, 0xf9, 0xae, 0xeb, 0x47, 0xdd, 0x89, 0xcf, 0x14, 0xc1,
-	0x72, 0xb3, 0xcb, 0xa4, 0x89, 0x97, 0x01, 0x88, 0xc8, 0x84, 0x8f, 0x93,
-	0x07, 0xa1, 0x8e, 0xaf, 0x47, 0xbd, 0xaa, 0xcb, 0x78, 0xd9, 0xce, 0xe7,
-	0xa3, 0xf5, 0xf6, 0x03, 0xcd, 0x11, 0x20, 0x20, 0xf2, 0x2d, 0x4f, 0x3c,
-	0x0f, 0x4a, 0x90, 0x58, 0x08, 0x66, 0x3e, 0x75, 0x80, 0x7c, 0x52, 0x6f,
-	0x5b, 0x61, 0x21, 0x53, 0x30, 0x45, 0xfa, 0x36, 0x05, 0x29, 0xd3, 0x1a,
-	0xdb, 0x0c, 0xaa, 0xfe, 0xb1, 0xf0, 0x83, 0xe2, 0x88, 0xd4, 0x58, 0xc6,
-	0x63, 0xb8, 0x26, 0xaa, 0x4f, 0x9c, 0xb9, 0x8d, 0x04, 0x83, 0xb3, 0x8d,
-	0x51, 0x9c, 0x25, 0xaa, 0x64, 0xb8, 0x58, 0xc6, 0x87, 0xd4, 0x86, 0xe2,
-	0xab, 0xf0, 0xb1, 0xfe, 0xd5, 0x0c, 0xd9, 0x1a, 0x00, 0x29, 0xfd, 0x36,
-	0x2f, 0x45, 0x1e, 0x53, 0x62, 0x61, 0x47, 0x6f, 0x9b, 0x7c, 0x47, 0x75,
-	0x05, 0x66, 0x91, 0x58, 0x0f, 0x4a, 0x4e, 0x3c, 0xf5, 0x2d, 0x1c, 0x20,
-	0xd1, 0x11, 0xf2, 0x03, 0xa6, 0xf5, 0xcd, 0xe7, 0x77, 0xd9, 0xad, 0xcb,
-	0x41, 0xbd, 0x98, 0xaf, 0xf9, 0xa0, 0xa1, 0x93, 0x9d, 0x84, 0xe5, 0x87,
-	0x95, 0x97, 0xc2, 0xa4, 0x79, 0xb3, 0x0f, 0xc1, 0x8d, 0xcf, 0x45, 0xdd,
-	0xae, 0xeb, 0x72, 0xf9, 0xd5, 0x07, 0x9b, 0x15, 0x01, 0x24, 0xbd, 0x31,
-	0x38, 0x40, 0xcc, 0x4d, 0x8c, 0x5c, 0xa7, 0x69, 0x70, 0x79, 0x8f, 0x7a,
-	0xfe, 0x6a, 0xcc, 0x5d, 0x16, 0x4f, 0x82, 0x41, 0xff, 0x32, 0x4e, 0x25,
-	0xe0, 0x16, 0x1c, 0x09, 0xbd, 0xfa, 0xf1, 0xec, 0x92, 0xde, 0xcf, 0xd0,
-	0x5c, 0xc2, 0xba, 0xb4, 0x14, 0xa6, 0xcf, 0x98, 0x3d, 0x89, 0xbe, 0x83,
-	0x3a, 0x92, 0xc7, 0x9f, 0x3f, 0xae, 0x07, 0xbc, 0x59, 0xca, 0x3b, 0xd8,
-	0x7b, 0xe6, 0x68, 0xf4, 0xa1, 0x02, 0x91, 0x10, 0xcf, 0x1e, 0xb2, 0x2c,
-	0x01, 0x3b, 0xcf, 0x48, 0x3d, 0x57, 0xd3, 0x64, 0xd2, 0x73, 0x05, 0x7d,
-	0xbe, 0x70, 0x93, 0x62, 0x72, 0x54, 0x6f, 0x46, 0x4b, 0x38, 0x42, 0x2a,
-	0x27, 0x1c, 0x15, 0x0e, 0x00, 0x00, 0xeb, 0xf1, 0xd7, 0xe3, 0xc4, 0xd5,
-	0xac, 0xc7, 0x9c, 0xb9, 0x81, 0xab, 0x7b, 0x9d, 0x31, 0x8f, 0x18, 0x83,
-	0x3a, 0x8c, 0x25, 0x9b, 0xcb, 0xa8, 0x29, 0xb7, 0x07, 0xc5, 0x47, 0xd3,
-	0x36, 0xe1, 0x6d, 0xef, 0x60, 0xfd, 0x96, 0x0b, 0x88, 0x19, 0xc1, 0x27,
-	0xad, 0x35, 0xf1, 0x43, 0xca, 0x51, 0x2c, 0x60, 0xde, 0x6d, 0xf8, 0x7b,
-	0xa5, 0x76, 0x3d, 0x67, 0xe3, 0x59, 0x4f, 0x4b, 0x9c, 0x3d, 0x37, 0x2f,
-	0x6a, 0x21, 0x12, 0x13, 0x40, 0x05, 0xe8, 0xf6, 0x19, 0xe9, 0xbb, 0xda,
-	0xf8, 0xcc, 0x86, 0xbe, 0xe1, 0xb0, 0x40, 0xa2, 0xed, 0x94, 0xba, 0x85,
-	0xc9, 0x86, 0x44, 0x96, 0x80, 0xa3, 0x2d, 0xb2, 0xcc, 0xbf, 0x40, 0xce,
-	0x01, 0xdc, 0x64, 0xea, 0x2c, 0xf8, 0x8d, 0x06, 0x53, 0x14, 0xb9, 0x22,
-	0x76, 0x30, 0xed, 0x3e, 0x8d, 0x4c, 0x35, 0x5b, 0x79, 0x68, 0xf7, 0x77,
-	0x46, 0x7b, 0x6c, 0x6c, 0xfe, 0x5e, 0x6f, 0x50, 0xba, 0x42, 0x57, 0x34,
-	0x86, 0x26, 0x35, 0x18, 0x59, 0x0a, 0x0e, 0xfc, 0x30, 0xee, 0xe2, 0xdf,
-	0x0d, 0xd2, 0xb1, 0xc3, 0xf1, 0xb5, 0x70, 0xa7, 0xf8, 0x99, 0xc4, 0x8a,
-	0x5a, 0x83, 0xb5, 0x90, 0x9f, 0x9e, 0xe3, 0xac, 0xce, 0xba, 0x07, 0xc9,
-	0xfb, 0xd6, 0x2e, 0xe5, 0x24, 0xf3, 0x55, 0x01, 0x51, 0x0f, 0x7b, 0x1d,
-	0x7a, 0x2b, 0xa7, 0x39, 0x9d, 0x47, 0xda, 0x55, 0xb2, 0x63, 0x43, 0x72,
-	0x3b, 0x7d, 0x4c, 0x72, 0xb0, 0x63, 0xda, 0x55, 0x9d, 0x47, 0xa6, 0x39,
-	0x7b, 0x2b, 0x7b, 0x1d, 0x52, 0x0f, 0x52, 0x01, 0x27, 0xf3, 0x2d, 0xe5,
-	0xfb, 0xd6, 0x06, 0xc9, 0xcf, 0xba, 0xe2, 0xac, 0x9e, 0x9e, 0xc0, 0x90,
-	0x12, 0x83, 0xaa, 0x8a, 0x04, 0x9a, 0x67, 0xa7, 0xfa, 0xb5, 0xa9, 0xc3,
-	0x13, 0xd2, 0xdc, 0xdf, 0x37, 0xee, 0x07, 0xfc, 0x5f, 0x0a, 0x30, 0x18,
-	0x8a, 0x26, 0x54, 0x34, 0xbd, 0x42, 0x6b, 0x50, 0x03, 0x5f, 0x61, 0x6c,
-	0x78, 0x7b, 0x17, 0x78, 0x6a, 0x68, 0x3f, 0x5b, 0x85, 0x4c, 0xf4, 0x3e,
-	0x70, 0x30, 0xbe, 0x22, 0x4f, 0x14, 0x90, 0x06, 0x29, 0xf8, 0x67, 0xea,
-	0xfd, 0xdb, 0x45, 0xce, 0xc8, 0xbf, 0x30, 0xb2, 0x7d, 0xa3, 0x49, 0x96,
-	0xb0, 0x86, 0xa3, 0x85, 0xf7, 0x94, 0x3a, 0xa2, 0xe5, 0xb0, 0x83, 0xbe,
-	0xfa, 0xcc, 0xb9, 0xda, 0x1b, 0xe9, 0xe6, 0xf6, 0x44, 0x05, 0x0c, 0x13,
-	0x71, 0x21, 0x30, 0x2f, 0xa2, 0x3d, 0x4b, 0x4b, 0xe6, 0x59, 0x38, 0x67,
-	0xb3, 0x76, 0xfa, 0x7b, 0xdc, 0x6d, 0x2d, 0x60, 0xc7, 0x51, 0xf6, 0x43,
-	0xa8, 0x35, 0xc5, 0x27, 0x85, 0x19, 0x98, 0x0b, 0x5e, 0xfd, 0x70, 0xef,
-	0x33, 0xe1, 0x49, 0xd3, 0x06, 0xc5, 0x28, 0xb7, 0xce, 0xa8, 0x22, 0x9b,
-	0x3a, 0x8c, 0x26, 0x83, 0x36, 0x8f, 0x79, 0x9d, 0x83, 0xab, 0x99, 0xb9,
-	0xb0, 0xc7, 0xc0, 0xd5, 0xda, 0xe3, 0xea, 0xf1, 0xff, 0xff, 0x17, 0x0e,
-	0x26, 0x1c, 0x41, 0x2a, 0x4f, 0x38, 0x68, 0x46, 0x7b, 0x54, 0x8a, 0x62,
-	0xc7, 0x70, 0xdc, 0x7c, 0xc6, 0x73, 0xdc, 0x64, 0x35, 0x57, 0xd5, 0x48,
-	0xfd, 0x3a, 0xb5, 0x2c, 0xcd, 0x1e, 0x8f, 0x10, 0xa5, 0x02, 0x66, 0xf4,
-	0x7b, 0xe6, 0x3c, 0xd8, 0x55, 0xca, 0x0d, 0xbc, 0x39, 0xae, 0xcf, 0x9f,
-	0x2a, 0x92, 0x00, 0x84, 0x51, 0x89, 0xc7, 0x98, 0x19, 0xa6, 0xb6, 0xb4,
-	0x5f, 0xc2, 0xcd, 0xd0, 0x92, 0xde, 0xf2, 0xec, 0xbd, 0xfa, 0x1b, 0x09,
-	0xe2, 0x16, 0x4a, 0x25, 0x04, 0x33, 0x7e, 0x41, 0x1a, 0x4f, 0xc6, 0x5d,
-	0x0a, 0x6b, 0x5d, 0x7a, 0x4f, 0x79, 0xb8, 0x69, 0x80, 0x5c, 0xd4, 0x4d,
-	0x34, 0x40, 0xbf, 0x31, 0x00, 0x24, 0x9b, 0x15, 0xd5, 0x07, 0x72, 0xf9,
-	0xae, 0xeb, 0x46, 0xdd, 0x8c, 0xcf, 0x0f, 0xc1, 0x79, 0xb3, 0xc3, 0xa4,
-	0x94, 0x97, 0xea, 0x87, 0x87, 0x84, 0xa0, 0x93, 0xfe, 0xa0, 0x93, 0xaf,
-	0x45, 0xbd, 0xaa, 0xcb, 0x78, 0xd9, 0xcf, 0xe7, 0xa1, 0xf5, 0xfa, 0x03,
-	0xc7, 0x11, 0x27, 0x20, 0xea, 0x2d, 0x58, 0x3c, 0x06, 0x4a, 0x9a, 0x58,
-	0xfb, 0x65, 0x56, 0x75, 0xee, 0x7c, 0x3f, 0x6f, 0x64, 0x61, 0x1d, 0x53,
-	0x30, 0x45, 0xfd, 0x36, 0x01, 0x29, 0xd7, 0x1a, 0xd6, 0x0c, 0xb0, 0xfe,
-	0xac, 0xf0, 0x87, 0xe2, 0x85, 0xd4, 0x5a, 0xc6, 0x62, 0xb8, 0x26, 0xaa,
-	0x51, 0x9c, 0xb2, 0x8d, 0xc9, 0x82, 0xb9, 0x8d, 0x50, 0x9c, 0x25, 0xaa,
-	0x64, 0xb8, 0x58, 0xc6, 0x87, 0xd4, 0x84, 0xe2, 0xb0, 0xf0, 0xac, 0xfe,
-	0xd9, 0x0c, 0xd4, 0x1a, 0x04, 0x29, 0xfc, 0x36, 0x2e, 0x45, 0x22, 0x53,
-	0x5b, 0x61, 0x50, 0x6f, 0xa4, 0x7c, 0x3c, 0x75, 0x09, 0x66, 0x90, 0x58,
-	0x0c, 0x4a, 0x54, 0x3c, 0xee, 0x2d, 0x24, 0x20, 0xca, 0x11, 0xf5, 0x03,
-	0xa6, 0xf5, 0xcb, 0xe7, 0x7b, 0xd9, 0xa8, 0xcb, 0x47, 0xbd, 0x8f, 0xaf,
-	0x06, 0xa1, 0x8f, 0x93, 0xbe, 0x84, 0x07, 0x88, 0x87, 0x97, 0xcd, 0xa4,
-	0x70, 0xb3, 0x16, 0xc1, 0x87, 0xcf, 0x49, 0xdd, 0xac, 0xeb, 0x73, 0xf9,
-	0xd6, 0x07, 0x99, 0x15, 0x02, 0x24, 0xbd, 0x31, 0x35, 0x40, 0xd5, 0x4d,
-	0x7c, 0x5c, 0xc2, 0x69, 0x32, 0x79, 0x48, 0x7a, 0x14, 0x6b, 0xbc, 0x5d,
-	0x25, 0x4f, 0x74, 0x41, 0x0d, 0x33, 0x41, 0x25, 0xea, 0x16, 0x16, 0x09,
-	0xc0, 0xfa, 0xef, 0xec, 0x93, 0xde, 0xcd, 0xd0, 0x62, 0xc2, 0xb2, 0xb4,
-	0x1c, 0xa6, 0xc3, 0x98, 0x5b, 0x89, 0x09, 0x84, 0x22, 0x92, 0xd2, 0x9f,
-	0x3a, 0xae, 0x0a, 0xbc, 0x58, 0xca, 0x3b, 0xd8, 0x7b, 0xe6, 0x66, 0xf4,
-	0xa5, 0x02, 0x8e, 0x10, 0xd0, 0x1e, 0xb3, 0x2c, 0xfd, 0x3a, 0xd5, 0x48,
-	0x34, 0x57, 0xe0, 0x64, 0xbf, 0x73, 0xee, 0x7c, 0xcb, 0x70, 0x87, 0x62,
-	0x7d, 0x54, 0x67, 0x46, 0x51, 0x38, 0x3e, 0x2a, 0x28, 0x1c, 0x15, 0x0e,
-	0xff, 0xff, 0xed, 0xf1, 0xd7, 0xe3, 0xc1, 0xd5, 0xb1, 0xc7, 0x95, 0xb9,
-	0x8a, 0xab, 0x71, 0x9d, 0x40, 0x8f, 0xfb, 0x82, 0x2f, 0x8c, 0x2b, 0x9b,
-	0xc7, 0xa8, 0x2c, 0xb7, 0x03, 0xc5, 0x4c, 0xd3, 0x31, 0xe1, 0x72, 0xef,
-	0x5b, 0xfd, 0x9b, 0x0b, 0x83, 0x19, 0xc7, 0x27, 0xa6, 0x35, 0xf9, 0x43,
-	0xc1, 0x51, 0x38, 0x60, 0xc9, 0x6d, 0x3f, 0x7c, 0xc5, 0x76, 0x2f, 0x67,
-	0xed, 0x59, 0x46, 0x4b, 0xa5, 0x3d, 0x2f, 0x2f, 0x6f, 0x21, 0x0f, 0x13,
-	0x41, 0x05, 0xe9, 0xf6, 0x19, 0xe9, 0xb9, 0xda, 0xfb, 0xcc, 0x82, 0xbe,
-	0xe8, 0xb0, 0x34, 0xa2, 0x04, 0x95, 0x6d, 0x85, 0x95, 0x86, 0x54, 0x96,
-	0x78, 0xa3, 0x33, 0xb2, 0xc5, 0xbf, 0x47, 0xce, 0xfb, 0xdb, 0x6a, 0xea,
-	0x27, 0xf8, 0x91, 0x06, 0x4e, 0x14, 0xbf, 0x22, 0x71, 0x30, 0xf2, 0x3e,
-	0x87, 0x4c, 0x3d, 0x5b, 0x6c, 0x68, 0x1b, 0x78, 0x63, 0x7b, 0x60, 0x6c,
-	0x05, 0x5f, 0x69, 0x50, 0xbf, 0x42, 0x54, 0x34, 0x88, 0x26, 0x33, 0x18,
-	0x5a, 0x0a, 0x0d, 0xfc, 0x32, 0xee, 0xe1, 0xdf, 0x0d, 0xd2, 0xb0, 0xc3,
-	0xf2, 0xb5, 0x70, 0xa7, 0xf9, 0x99, 0xbb, 0x8a, 0x62, 0x83, 0xbc, 0x90,
-	0x9c, 0x9e, 0xe4, 0xac, 0xcf, 0xba, 0x05, 0xc9, 0xfd, 0xd6, 0x2a, 0xe5,
-	0x29, 0xf3, 0x53, 0x01, 0x50, 0x0f, 0x7d, 0x1d, 0x78, 0x2b, 0xa8, 0x39,
-	0x9d, 0x47, 0xda, 0x55, 0xb0, 0x63, 0x4c, 0x72, 0xfe, 0x7c, 0x44, 0x72,
-	0xb3, 0x63, 0xda, 0x55, 0x9c, 0x47, 0xa9, 0x39, 0x77, 0x2b, 0x7e, 0x1d,
-	0x4f, 0x0f, 0x55, 0x01, 0x26, 0xf3, 0x2b, 0xe5, 0xfe, 0xd6, 0x03, 0xc9,
-	0xd3, 0xba, 0xdd, 0xac, 0xa5, 0x9e, 0xaf, 0x90, 0x7e, 0x83, 0xc5, 0x8a,
-	0xf4, 0x99, 0x74, 0xa7, 0xee, 0xb5, 0xb4, 0xc3, 0x0a, 0xd2, 0xe4, 0xdf,
-	0x2e, 0xee, 0x10, 0xfc, 0x59, 0x0a, 0x33, 0x18, 0x89, 0x26, 0x53, 0x34,
-	0xbd, 0x42, 0x6f, 0x50, 0xfb, 0x5e, 0x70, 0x6c, 0x37, 0x7b, 0x00, 0x78,
-	0x78, 0x68, 0x34, 0x5b, 0x8e, 0x4c, 0xed, 0x3e, 0x75, 0x30, 0xbb, 0x22,
-	0x51, 0x14, 0x90, 0x06, 0x28, 0xf8, 0x68, 0xea, 0xfc, 0xdb, 0x46, 0xce,
-	0xc8, 0xbf, 0x2e, 0xb2, 0x80, 0xa3, 0x44, 0x96, 0xc8, 0x86, 0xa0, 0x85,
-	0xf5, 0x94, 0x3b, 0xa2, 0xe5, 0xb0, 0x84, 0xbe, 0xf8, 0xcc, 0xbb, 0xda,
-	0x1a, 0xe9, 0xe6, 0xf6, 0x45, 0x05, 0x0a, 0x13, 0x73, 0x21, 0x2e, 0x2f,
-	0xa4, 0x3d, 0x49, 0x4b, 0xe8, 0x59, 0x37, 0x67, 0xb0, 0x76, 0x28, 0x7c,
-	0xd4, 0x6d, 0x32, 0x60, 0xc3, 0x51, 0xfa, 0x43, 0xa3, 0x35, 0xcb, 0x27,
-	0x7f, 0x19, 0x9e, 0x0b, 0x58, 0xfd, 0x75, 0xef, 0x2e, 0xe1, 0x4f, 0xd3,
-	0x00, 0xc5, 0x2e, 0xb7, 0xc8, 0xa8, 0x28, 0x9b, 0x34, 0x8c, 0xc9, 0x82,
-	0x3c, 0x8f, 0x77, 0x9d, 0x82, 0xab, 0x9c, 0xb9, 0xab, 0xc7, 0xc6, 0xd5,
-	0xd5, 0xe3, 0xec, 0xf1, 0x00, 0x00, 0x14, 0x0e, 0x29, 0x1c, 0x3e, 0x2a,
-	0x51, 0x38, 0x67, 0x46, 0x7b, 0x54, 0x8b, 0x62, 0xc3, 0x70, 0x38, 0x7d,
-	0xcc, 0x73, 0xd6, 0x64, 0x3b, 0x57, 0xd0, 0x48, 0x01, 0x3b, 0xb1, 0x2c,
-	0xd1, 0x1e, 0x8d, 0x10, 0xa5, 0x02, 0x66, 0xf4, 0x7c, 0xe6, 0x39, 0xd8,
-	0x5b, 0xca, 0x06, 0xbc, 0x3f, 0xae, 0xcb, 0x9f, 0x2f, 0x92, 0xd5, 0x83,
-	0x53, 0x89, 0xc7, 0x98, 0x19, 0xa6, 0xb6, 0xb4, 0x5e, 0xc2, 0xcf, 0xd0,
-	0x91, 0xde, 0xf2, 0xec, 0xbd, 0xfa, 0x1a, 0x09, 0xe5, 0x16, 0x47, 0x25,
-	0x06, 0x33, 0x7c, 0x41, 0x1d, 0x4f, 0xc3, 0x5d, 0x0d, 0x6b, 0x5f, 0x7a,
-	0x36, 0x79, 0xc0, 0x69, 0x7c, 0x5c, 0xd6, 0x4d, 0x34, 0x40, 0xbd, 0x31,
-	0x01, 0x24, 0x9c, 0x15, 0xd3, 0x07, 0x75, 0xf9, 0xab, 0xeb, 0x48, 0xdd,
-	0x88, 0xcf, 0x16, 0xc1, 0x6f, 0xb3, 0xcf, 0xa4, 0x85, 0x97, 0x03, 0x88,
-	0xc6, 0x84, 0x93, 0x93, 0x03, 0xa1, 0x90, 0xaf, 0x47, 0xbd, 0xa9, 0xcb,
-	0x79, 0xd9, 0xcd, 0xe7, 0xa5, 0xf5, 0xf3, 0x03, 0xd0, 0x11, 0x1d, 0x20,
-	0xf4, 0x2d, 0x4f, 0x3c, 0x0f, 0x4a, 0x90, 0x58, 0x07, 0x66, 0x3e, 0x75,
-	0x82, 0x7c, 0x4f, 0x6f, 0x5f, 0x61, 0x1d, 0x53, 0x32, 0x45, 0xf9, 0x36,
-	0x05, 0x29, 0xd4, 0x1a, 0xd9, 0x0c, 0xac, 0xfe, 0xb0, 0xf0, 0x83, 0xe2,
-	0x88, 0xd4, 0x59, 0xc6, 0x61, 0xb8, 0x29, 0xaa, 0x4c, 0x9c, 0xbb, 0x8d,
-	0x03, 0x83, 0xb3, 0x8d, 0x52, 0x9c, 0x24, 0xaa, 0x65, 0xb8, 0x56, 0xc6,
-	0x8a, 0xd4, 0x81, 0xe2, 0xb2, 0xf0, 0xab, 0xfe, 0xda, 0x0c, 0xd4, 0x1a,
-	0x04, 0x29, 0xfa, 0x36, 0x32, 0x45, 0x1c, 0x53, 0x62, 0x61, 0x48, 0x6f,
-	0x99, 0x7c, 0x4a, 0x75, 0x02, 0x66, 0x94, 0x58, 0x0b, 0x4a, 0x53, 0x3c,
-	0xef, 0x2d, 0x23, 0x20, 0xcb, 0x11, 0xf6, 0x03, 0xa4, 0xf5, 0xcd, 0xe7,
-	0x78, 0xd9, 0xac, 0xcb, 0x43, 0xbd, 0x94, 0xaf, 0xfe, 0xa0, 0x9d, 0x93,
-	0x9f, 0x84, 0xe5, 0x87, 0x93, 0x97, 0xc4, 0xa4, 0x78, 0xb3, 0x10, 0xc1,
-	0x8c, 0xcf, 0x45, 0xdd, 0xae, 0xeb, 0x72, 0xf9, 0xd6, 0x07, 0x98, 0x15,
-	0x06, 0x24, 0xb7, 0x31, 0x3d, 0x40, 0xca, 0x4d, 0x8b, 0x5c, 0xaa, 0x69,
-	0x6d, 0x79, 0x92, 0x7a, 0xfb, 0x6a, 0xce, 0x5d, 0x16, 0x4f, 0x80, 0x41,
-	0x04, 0x33, 0x48, 0x25, 0xe4, 0x16, 0x1c, 0x09, 0xba, 0xfa, 0xf5, 0xec,
-	0x8e, 0xde, 0xd3, 0xd0, 0x5a, 0xc2, 0xbb, 0xb4, 0x11, 0xa6, 0xd3, 0x98,
-	0x39, 0x89, 0xc3, 0x83, 0x35, 0x92, 0xc9, 0x9f, 0x3f, 0xae, 0x07, 0xbc,
-	0x59, 0xca, 0x3a, 0xd8, 0x7c, 0xe6, 0x66, 0xf4, 0xa5, 0x02, 0x8d, 0x10,
-	0xd1, 0x1e, 0xb2, 0x2c, 0xfe, 0x3a, 0xd4, 0x48, 0x37, 0x57, 0xd9, 0x64,
-	0xce, 0x73, 0x06, 0x7d, 0xc0, 0x70, 0x8d, 0x62, 0x7a, 0x54, 0x67, 0x46,
-	0x53, 0x38, 0x3b, 0x2a, 0x2c, 0x1c, 0x12, 0x0e, 0x01, 0x00, 0xec, 0xf1,
-	0xd6, 0xe3, 0xc3, 0xd5, 0xae, 0xc7, 0x9a, 0xb9, 0x84, 0xab, 0x77, 0x9d,
-	0x36, 0x8f, 0x11, 0x83, 0x41, 0x8c, 0x21, 0x9b, 0xcc, 0xa8, 0x2b, 0xb7,
-	0x02, 0xc5, 0x4d, 0xd3, 0x30, 0xe1, 0x72, 0xef, 0x5d, 0xfd, 0x98, 0x0b,
-	0x85, 0x19, 0xc6, 0x27, 0xa6, 0x35, 0xf9, 0x43, 0xc4, 0x51, 0x2f, 0x60,
-	0xdc, 0x6d, 0xf9, 0x7b, 0xa6, 0x76, 0x3b, 0x67, 0xe5, 0x59, 0x4d, 0x4b,
-	0x9d, 0x3d, 0x37, 0x2f, 0x69, 0x21, 0x14, 0x13, 0x3d, 0x05, 0xec, 0xf6,
-	0x15, 0xe9, 0xbf, 0xda, 0xf4, 0xcc, 0x8a, 0xbe, 0xde, 0xb0, 0x41, 0xa2,
-	0xee, 0x94, 0xb7, 0x85, 0xce, 0x86, 0x3f, 0x96, 0x83, 0xa3, 0x2b, 0xb2,
-	0xcd, 0xbf, 0x40, 0xce, 0x02, 0xdc, 0x62, 0xea, 0x2e, 0xf8, 0x8a, 0x06,
-	0x56, 0x14, 0xb8, 0x22, 0x77, 0x30, 0xeb, 0x3e, 0x8f, 0x4c, 0x32, 0x5b,
-	0x7c, 0x68, 0xf7, 0x77, 0x43, 0x7b, 0x70, 0x6c, 0xfa, 0x5e, 0x71, 0x50,
-	0xba, 0x42, 0x56, 0x34, 0x87, 0x26, 0x34, 0x18, 0x5a, 0x0a, 0x0c, 0xfc,
-	0x33, 0xee, 0xdf, 0xdf, 0x0f, 0xd2, 0xb0, 0xc3, 0xf1, 0xb5, 0x71, 0xa7,
-	0xf6, 0x99, 0xc6, 0x8a, 0x58, 0x83, 0xb7, 0x90, 0x9d, 0x9e, 0xe6, 0xac,
-	0xcb, 0xba, 0x09, 0xc9, 0xfa, 0xd6, 0x2c, 0xe5, 0x28, 0xf3, 0x52, 0x01,
-	0x52, 0x0f, 0x7b, 0x1d, 0x7a, 0x2b, 0xa6, 0x39, 0x9e, 0x47, 0xd9, 0x55,
-	0xb3, 0x63, 0x43, 0x72, 0x3c, 0x7d, 0x4a, 0x72, 0xb1, 0x63, 0xda, 0x55,
-	0x9c, 0x47, 0xaa, 0x39, 0x76, 0x2b, 0x7e, 0x1d, 0x50, 0x0f, 0x54, 0x01,
-	0x26, 0xf3, 0x2d, 0xe5, 0xfa, 0xd6, 0x09, 0xc9, 0xcc, 0xba, 0xe5, 0xac,
-	0x9b, 0x9e, 0xc1, 0x90, 0x13, 0x83, 0xaa, 0x8a, 0x03, 0x9a, 0x69, 0xa7,
-	0xf6, 0xb5, 0xae, 0xc3, 0x0e, 0xd2, 0xe2, 0xdf, 0x30, 0xee, 0x0e, 0xfc,
-	0x5a, 0x0a, 0x33, 0x18, 0x88, 0x26, 0x55, 0x34, 0xbc, 0x42, 0x6c, 0x50,
-	0x04, 0x5f, 0x5e, 0x6c, 0x7c, 0x7b, 0x11, 0x78, 0x70, 0x68, 0x3b, 0x5b,
-	0x87, 0x4c, 0xf4, 0x3e, 0x6f, 0x30, 0xbe, 0x22, 0x51, 0x14, 0x8d, 0x06,
-	0x2d, 0xf8, 0x63, 0xea, 0x00, 0xdc, 0x43, 0xce, 0xca, 0xbf, 0x2e, 0xb2,
-	0x7e, 0xa3, 0x49, 0x96, 0xb1, 0x86, 0xa3, 0x85, 0xf6, 0x94, 0x3b, 0xa2,
-	0xe4, 0xb0, 0x85, 0xbe, 0xf8, 0xcc, 0xbb, 0xda, 0x1a, 0xe9, 0xe7, 0xf6,
-	0x42, 0x05, 0x0f, 0x13, 0x6d, 0x21, 0x34, 0x2f, 0x9f, 0x3d, 0x4c, 0x4b,
-	0xe6, 0x59, 0x39, 0x67, 0xaf, 0x76, 0x00, 0x7c, 0xd5, 0x6d, 0x33, 0x60,
-	0xc3, 0x51, 0xf8, 0x43, 0xa7, 0x35, 0xc6, 0x27, 0x83, 0x19, 0x9b, 0x0b,
-	0x5b, 0xfd, 0x73, 0xef, 0x2f, 0xe1, 0x4e, 0xd3, 0x00, 0xc5, 0x2f, 0xb7,
-	0xc7, 0xa8, 0x28, 0x9b, 0x35, 0x8c, 0x28, 0x83, 0x36, 0x8f, 0x78, 0x9d,
-	0x84, 0xab, 0x99, 0xb9, 0xaf, 0xc7, 0xc1, 0xd5, 0xd8, 0xe3, 0xeb, 0xf1,
-	0x00, 0x00, 0x16, 0x0e, 0x26, 0x1c, 0x41, 0x2a, 0x4e, 0x38, 0x6a, 0x46,
-	0x7a, 0x54, 0x88, 0x62, 0xcb, 0x70, 0xd8, 0x7c, 0xc9, 0x73, 0xdb, 0x64,
-	0x35, 0x57, 0xd5, 0x48, 0xfd, 0x3a, 0xb4, 0x2c, 0xd0, 0x1e, 0x8d, 0x10,
-	0xa6, 0x02, 0x64, 0xf4, 0x7e, 0xe6, 0x39, 0xd8, 0x59, 0xca, 0x09, 0xbc,
-	0x3c, 0xae, 0xce, 0x9f, 0x29, 0x92, 0x02, 0x84, 0x4f, 0x89, 0xc9, 0x98,
-	0x18, 0xa6, 0xb6, 0xb4, 0x5e, 0xc2, 0xcf, 0xd0, 0x92, 0xde, 0xf1, 0xec,
-	0xbe, 0xfa, 0x19, 0x09, 0xe6, 0x16, 0x46, 0x25, 0x08, 0x33, 0x79, 0x41,
-	0x1f, 0x4f, 0xc3, 0x5d, 0x0b, 0x6b, 0x5d, 0x7a, 0x4f, 0x79, 0xb6, 0x69,
-	0x85, 0x5c, 0xcf, 0x4d, 0x38, 0x40, 0xbc, 0x31, 0x01, 0x24, 0x9b, 0x15,
-	0xd5, 0x07, 0x73, 0xf9, 0xad, 0xeb, 0x46, 0xdd, 0x8b, 0xcf, 0x10, 0xc1,
-	0x78, 0xb3, 0xc4, 0xa4, 0x93, 0x97, 0xeb, 0x87, 0x87, 0x84, 0x9f, 0x93,
-	0xfe, 0xa0, 0x94, 0xaf, 0x43, 0xbd, 0xad, 0xcb, 0x75, 0xd9, 0xd1, 0xe7,
-	0xa1, 0xf5, 0xf8, 0x03, 0xc9, 0x11, 0x25, 0x20, 0xed, 0x2d, 0x55, 0x3c,
-	0x08, 0x4a, 0x98, 0x58, 0xfc, 0x65, 0x56, 0x75, 0xee, 0x7c, 0x3e, 0x6f,
-	0x66, 0x61, 0x1a, 0x53, 0x33, 0x45, 0xfa, 0x36, 0x03, 0x29, 0xd7, 0x1a,
-	0xd5, 0x0c, 0xb0, 0xfe, 0xae, 0xf0, 0x84, 0xe2, 0x88, 0xd4, 0x58, 0xc6,
-	0x61, 0xb8, 0x29, 0xaa, 0x4f, 0x9c, 0xb4, 0x8d, 0xc6, 0x82, 0xbb, 0x8d,
-	0x4e, 0x9c, 0x28, 0xaa, 0x61, 0xb8, 0x5b, 0xc6, 0x84, 0xd4, 0x87, 0xe2,
-	0xad, 0xf0, 0xae, 0xfe, 0xd8, 0x0c, 0xd6, 0x1a, 0x01, 0x29, 0xfe, 0x36,
-	0x2d, 0x45, 0x22, 0x53, 0x5c, 0x61, 0x4f, 0x6f, 0xa3, 0x7c, 0x3e, 0x75,
-	0x08, 0x66, 0x8f, 0x58, 0x10, 0x4a, 0x4d, 0x3c, 0xf6, 0x2d, 0x1c, 0x20,
-	0xd1, 0x11, 0xf1, 0x03, 0xa7, 0xf5, 0xcd, 0xe7, 0x77, 0xd9, 0xac, 0xcb,
-	0x43, 0xbd, 0x93, 0xaf, 0x03, 0xa1, 0x91, 0x93, 0xbe, 0x84, 0x06, 0x88,
-	0x87, 0x97, 0xcd, 0xa4, 0x70, 0xb3, 0x17, 0xc1, 0x87, 0xcf, 0x49, 0xdd,
-	0xaa, 0xeb, 0x76, 0xf9, 0xd3, 0x07, 0x9b, 0x15, 0x01, 0x24, 0xbe, 0x31,
-	0x34, 0x40, 0xd5, 0x4d, 0x7d, 0x5c, 0xc0, 0x69, 0x34, 0x79, 0x47, 0x7a,
-	0x12, 0x6b, 0xc1, 0x5d, 0x1f, 0x4f, 0x79, 0x41, 0x09, 0x33, 0x44, 0x25,
-	0xe9, 0x16, 0x14, 0x09, 0xc4, 0xfa, 0xeb, 0xec, 0x98, 0xde, 0xc9, 0xd0,
-	0x62, 0xc2, 0xb4, 0xb4, 0x1b, 0xa6, 0xc4, 0x98, 0x5b, 0x89, 0x07, 0x84,
-	0x22, 0x92, 0xd5, 0x9f, 0x36, 0xae, 0x0e, 0xbc, 0x54, 0xca, 0x3d, 0xd8,
-	0x7a, 0xe6, 0x68, 0xf4, 0xa3, 0x02, 0x8f, 0x10, 0xce, 0x1e, 0xb5, 0x2c,
-	0xfd, 0x3a, 0xd5, 0x48, 0x35, 0x57, 0xdd, 0x64, 0xc1, 0x73, 0xee, 0x7c,
-	0xcb, 0x70, 0x87, 0x62, 0x7e, 0x54, 0x64, 0x46, 0x54, 0x38, 0x3c, 0x2a,
-	0x29, 0x1c, 0x16, 0x0e, 0xfe, 0xff, 0xec, 0xf1, 0xd8, 0xe3, 0xc0, 0xd5,
-	0xb3, 0xc7, 0x95, 0xb9, 0x87, 0xab, 0x74, 0x9d, 0x3d, 0x8f, 0xfe, 0x82,
-	0x2f, 0x8c, 0x28, 0x9b, 0xca, 0xa8, 0x2a, 0xb7, 0x05, 0xc5, 0x4a, 0xd3,
-	0x32, 0xe1, 0x72, 0xef, 0x5b, 0xfd, 0x9b, 0x0b, 0x83, 0x19, 0xc6, 0x27,
-	0xa8, 0x35, 0xf7, 0x43, 0xc3, 0x51, 0x36, 0x60, 0xcb, 0x6d, 0x3c, 0x7c,
-	0xc9, 0x76, 0x2c, 0x67, 0xef, 0x59, 0x45, 0x4b, 0xa4, 0x3d, 0x31, 0x2f,
-	0x6f, 0x21, 0x0e, 0x13, 0x43, 0x05, 0xe5, 0xf6, 0x1d, 0xe9, 0xb8, 0xda,
-	0xfa, 0xcc, 0x83, 0xbe, 0xe7, 0xb0, 0x35, 0xa2, 0x03, 0x95, 0x6f, 0x85,
-	0x92, 0x86, 0x58, 0x96, 0x73, 0xa3, 0x36, 0xb2, 0xc5, 0xbf, 0x46, 0xce,
-	0xfe, 0xdb, 0x64, 0xea, 0x2c, 0xf8, 0x8d, 0x06, 0x52, 0x14, 0xbc, 0x22,
-	0x72, 0x30, 0xf2, 0x3e, 0x87, 0x4c, 0x3c, 0x5b, 0x6d, 0x68, 0x1a, 0x78,
-	0x64, 0x7b, 0x60, 0x6c, 0x05, 0x5f, 0x68, 0x50, 0xc1, 0x42, 0x51, 0x34,
-	0x8b, 0x26, 0x32, 0x18, 0x5a, 0x0a, 0x0d, 0xfc, 0x31, 0xee, 0xe2, 0xdf,
-	0x0d, 0xd2, 0xb1, 0xc3, 0xf1, 0xb5, 0x6f, 0xa7, 0xfc, 0x99, 0xb7, 0x8a,
-	0x67, 0x83, 0xb7, 0x90, 0xa0, 0x9e, 0xe2, 0xac, 0xd0, 0xba, 0x05, 0xc9,
-	0xfc, 0xd6, 0x2b, 0xe5, 0x29, 0xf3, 0x51, 0x01, 0x53, 0x0f, 0x7b, 0x1d,
-	0x79, 0x2b, 0xa7, 0x39, 0x9e, 0x47, 0xd9, 0x55, 0xb1, 0x63, 0x4b, 0x72,
-	0xfd, 0x7c, 0x47, 0x72, 0xb1, 0x63, 0xdb, 0x55, 0x9a, 0x47, 0xaa, 0x39,
-	0x79, 0x2b, 0x7a, 0x1d, 0x54, 0x0f, 0x50, 0x01, 0x29, 0xf3, 0x2c, 0xe5,
-	0xfb, 0xd6, 0x06, 0xc9, 0xd0, 0xba, 0xe0, 0xac, 0xa3, 0x9e, 0xb1, 0x90,
-	0x7d, 0x83, 0xc4, 0x8a, 0xf6, 0x99, 0x72, 0xa7, 0xf0, 0xb5, 0xb2, 0xc3,
-	0x0c, 0xd2, 0xe2, 0xdf, 0x31, 0xee, 0x0d, 0xfc, 0x5a, 0x0a, 0x34, 0x18,
-	0x86, 0x26, 0x58, 0x34, 0xb9, 0x42, 0x6f, 0x50, 0xfe, 0x5e, 0x6c, 0x6c,
-	0x3b, 0x7b, 0xfd, 0x77, 0x79, 0x68, 0x35, 0x5b, 0x8c, 0x4c, 0xee, 0x3e,
-	0x76, 0x30, 0xb8, 0x22, 0x56, 0x14, 0x89, 0x06, 0x2f, 0xf8, 0x63, 0xea,
-	0xff, 0xdb, 0x44, 0xce, 0xc9, 0xbf, 0x2e, 0xb2, 0x81, 0xa3, 0x42, 0x96,
-	0xc9, 0x86, 0xa1, 0x85, 0xf3, 0x94, 0x3f, 0xa2, 0xe0, 0xb0, 0x86, 0xbe,
-	0xfa, 0xcc, 0xb8, 0xda, 0x1d, 0xe9, 0xe3, 0xf6, 0x45, 0x05, 0x0e, 0x13,
-	0x6e, 0x21, 0x33, 0x2f, 0x9f, 0x3d, 0x4b, 0x4b, 0xe9, 0x59, 0x35, 0x67,
-	0xb1, 0x76, 0x29, 0x7c, 0xd1, 0x6d, 0x35, 0x60, 0xc2, 0x51, 0xf8, 0x43,
-	0xa7, 0x35, 0xc7, 0x27, 0x82, 0x19, 0x9c, 0x0b, 0x5a, 0xfd, 0x73, 0xef,
-	0x30, 0xe1, 0x4c, 0xd3, 0x03, 0xc5, 0x2c, 0xb7, 0xc9, 0xa8, 0x27, 0x9b,
-	0x34, 0x8c, 0xca, 0x82, 0x3c, 0x8f, 0x75, 0x9d, 0x85, 0xab, 0x99, 0xb9,
-	0xae, 0xc7, 0xc4, 0xd5, 0xd5, 0xe3, 0xee, 0xf1, 0xfd, 0xff, 0x17, 0x0e,
-	0x27, 0x1c, 0x3f, 0x2a, 0x51, 0x38, 0x67, 0x46, 0x7b, 0x54, 0x89, 0x62,
-	0xc7, 0x70, 0x33, 0x7d, 0xd1, 0x73, 0xd3, 0x64, 0x3c, 0x57, 0xcf, 0x48,
-	0x02, 0x3b, 0xb0, 0x2c, 0xd3, 0x1e, 0x8b, 0x10, 0xa7, 0x02, 0x63, 0xf4,
-	0x7f, 0xe6, 0x37, 0xd8, 0x5b, 0xca, 0x08, 0xbc, 0x3c, 0xae, 0xcd, 0x9f,
-	0x2e, 0x92, 0xd6, 0x83, 0x51, 0x89, 0xcb, 0x98, 0x13, 0xa6, 0xbc, 0xb4,
-	0x5a, 0xc2, 0xd1, 0xd0, 0x92, 0xde, 0xee, 0xec, 0xc1, 0xfa, 0x18, 0x09,
-	0xe6, 0x16, 0x46, 0x25, 0x07, 0x33, 0x7a, 0x41, 0x20, 0x4f, 0xc0, 0x5d,
-	0x0f, 0x6b, 0x5d, 0x7a, 0x39, 0x79, 0xbd, 0x69, 0x7e, 0x5c, 0xd5, 0x4d,
-	0x34, 0x40, 0xbf, 0x31, 0xff, 0x23, 0x9d, 0x15, 0xd2, 0x07, 0x77, 0xf9,
-	0xa9, 0xeb, 0x4a, 0xdd, 0x87, 0xcf, 0x15, 0xc1, 0x72, 0xb3, 0xcb, 0xa4,
-	0x89, 0x97, 0x01, 0x88, 0xc7, 0x84, 0x93, 0x93, 0x00, 0xa1, 0x96, 0xaf,
-	0x41, 0xbd, 0xae, 0xcb, 0x76, 0xd9, 0xcd, 0xe7, 0xa7, 0xf5, 0xf1, 0x03,
-	0xd2, 0x11, 0x1b, 0x20, 0xf6, 0x2d, 0x4d, 0x3c, 0x10, 0x4a, 0x8f, 0x58,
-	0x09, 0x66, 0x3c, 0x75, 0x84, 0x7c, 0x4e, 0x6f, 0x5e, 0x61, 0x1f, 0x53,
-	0x30, 0x45, 0xfc, 0x36, 0x03, 0x29, 0xd4, 0x1a, 0xd9, 0x0c, 0xae, 0xfe,
-	0xae, 0xf0, 0x85, 0xe2, 0x85, 0xd4, 0x5b, 0xc6, 0x61, 0xb8, 0x28, 0xaa,
-	0x4e, 0x9c, 0xb9, 0x8d, 0x03, 0x83, 0xb5, 0x8d, 0x4f, 0x9c, 0x27, 0xaa,
-	0x63, 0xb8, 0x57, 0xc6, 0x8a, 0xd4, 0x80, 0xe2, 0xb3, 0xf0, 0xa9, 0xfe,
-	0xdc, 0x0c, 0xd3, 0x1a, 0x04, 0x29, 0xfa, 0x36, 0x31, 0x45, 0x1d, 0x53,
-	0x63, 0x61, 0x45, 0x6f, 0x9c, 0x7c, 0x47, 0x75, 0x06, 0x66, 0x90, 0x58,
-	0x0f, 0x4a, 0x4e, 0x3c, 0xf4, 0x2d, 0x1f, 0x20, 0xce, 0x11, 0xf3, 0x03,
-	0xa6, 0xf5, 0xcc, 0xe7, 0x7a, 0xd9, 0xa9, 0xcb, 0x45, 0xbd, 0x93, 0xaf,
-	0xfe, 0xa0, 0x9e, 0x93, 0x9f, 0x84, 0xe3, 0x87, 0x96, 0x97, 0xc2, 0xa4,
-	0x78, 0xb3, 0x12, 0xc1, 0x89, 0xcf, 0x49, 0xdd, 0xaa, 0xeb, 0x74, 0xf9,
-	0xd5, 0x07, 0x9b, 0x15, 0x02, 0x24, 0xbb, 0x31, 0x38, 0x40, 0xcd, 0x4d,
-	0x8b, 0x5c, 0xa9, 0x69, 0x6e, 0x79, 0x91, 0x7a, 0xfc, 0x6a, 0xcd, 0x5d,
-	0x15, 0x4f, 0x83, 0x41, 0x00, 0x33, 0x4c, 0x25, 0xe2, 0x16, 0x1b, 0x09,
-	0xbc, 0xfa, 0xf4, 0xec, 0x8f, 0xde, 0xd1, 0xd0, 0x5c, 0xc2, 0xb9, 0xb4,
-	0x14, 0xa6, 0xd1, 0x98, 0x3a, 0x89, 0xc1, 0x83, 0x38, 0x92, 0xc7, 0x9f,
-	0x40, 0xae, 0x06, 0xbc, 0x5a, 0xca, 0x3a, 0xd8, 0x7c, 0xe6, 0x66, 0xf4,
-	0xa3, 0x02, 0x90, 0x10, 0xce, 0x1e, 0xb5, 0x2c, 0xfc, 0x3a, 0xd5, 0x48,
-	0x37, 0x57, 0xd7, 0x64, 0xd0, 0x73, 0x04, 0x7d, 0xc2, 0x70, 0x8d, 0x62,
-	0x78, 0x54, 0x69, 0x46, 0x4f, 0x38, 0x41, 0x2a, 0x25, 0x1c, 0x19, 0x0e,
-	0xfc, 0xff, 0xee, 0xf1, 0xd6, 0xe3, 0xc3, 0xd5, 0xae, 0xc7, 0x9a, 0xb9,
-	0x83, 0xab, 0x79, 0x9d, 0x34, 0x8f, 0x13, 0x83, 0x3f, 0x8c, 0x22, 0x9b,
-	0xcc, 0xa8, 0x2a, 0xb7, 0x04, 0xc5, 0x4b, 0xd3, 0x32, 0xe1, 0x71, 0xef,
-	0x5b, 0xfd, 0x9c, 0x0b, 0x82, 0x19, 0xc6, 0x27, 0xaa, 0x35, 0xf2, 0x43,
-	0xcb, 0x51, 0x2b, 0x60, 0xdd, 0x6d, 0xfa, 0x7b, 0xa3, 0x76, 0x3e, 0x67,
-	0xe4, 0x59, 0x4d, 0x4b, 0x9e, 0x3d, 0x35, 0x2f, 0x6b, 0x21, 0x13, 0x13,
-	0x3d, 0x05, 0xec, 0xf6, 0x15, 0xe9, 0xc0, 0xda, 0xf3, 0xcc, 0x8b, 0xbe,
-	0xdc, 0xb0, 0x44, 0xa2, 0xea, 0x94, 0xbb, 0x85, 0xcb, 0x86, 0x41, 0x96,
-	0x83, 0xa3, 0x29, 0xb2, 0xcf, 0xbf, 0x3d, 0xce, 0x05, 0xdc, 0x61, 0xea,
-	0x2d, 0xf8, 0x8d, 0x06, 0x52, 0x14, 0xba, 0x22, 0x76, 0x30, 0xec, 0x3e,
-	0x8f, 0x4c, 0x32, 0x5b, 0x7b, 0x68, 0xf8, 0x77, 0x42, 0x7b, 0x72, 0x6c,
-	0xf7, 0x5e, 0x74, 0x50, 0xb8, 0x42, 0x57, 0x34, 0x87, 0x26, 0x33, 0x18,
-	0x5c, 0x0a, 0x0a, 0xfc, 0x34, 0xee, 0xdf, 0xdf, 0x10, 0xd2, 0xad, 0xc3,
-	0xf5, 0xb5, 0x6d, 0xa7, 0xf9, 0x99, 0xc5, 0x8a, 0x58, 0x83, 0xb6, 0x90,
-	0x9f, 0x9e, 0xe3, 0xac, 0xcf, 0xba, 0x05, 0xc9, 0xfd, 0xd6, 0x2a, 0xe5,
-	0x29, 0xf3, 0x52, 0x01, 0x51, 0x0f, 0x7d, 0x1d, 0x78, 0x2b, 0xa8, 0x39,
-	0x9c, 0x47, 0xdb, 0x55, 0xb0, 0x63, 0x48, 0x72, 0x35, 0x7d, 0x51, 0x72,
-	0xac, 0x63, 0xdd, 0x55, 0x9b, 0x47, 0xa8, 0x39, 0x7a, 0x2b, 0x7a, 0x1d,
-	0x54, 0x0f, 0x50, 0x01, 0x29, 0xf3, 0x2a, 0xe5, 0xfe, 0xd6, 0x04, 0xc9,
-	0xd0, 0xba, 0xe2, 0xac, 0x9d, 0x9e, 0xc0, 0x90, 0x14, 0x83, 0xa7, 0x8a,
-	0x06, 0x9a, 0x67, 0xa7, 0xf9, 0xb5, 0xaa, 0xc3, 0x12, 0xd2, 0xdd, 0xdf,
-	0x36, 0xee, 0x09, 0xfc, 0x5c, 0x0a, 0x33, 0x18, 0x87, 0x26, 0x57, 0x34,
-	0xba, 0x42, 0x6d, 0x50, 0x03, 0x5f, 0x5f, 0x6c, 0x7a, 0x7b, 0x15, 0x78,
-	0x6d, 0x68, 0x3c, 0x5b, 0x88, 0x4c, 0xf0, 0x3e, 0x75, 0x30, 0xb9, 0x22,
-	0x54, 0x14, 0x8c, 0x06, 0x2c, 0xf8, 0x66, 0xea, 0xfc, 0xdb, 0x47, 0xce,
-	0xc5, 0xbf, 0x33, 0xb2, 0x7b, 0xa3, 0x4a, 0x96, 0xb1, 0x86, 0xa0, 0x85,
-	0xfa, 0x94, 0x39, 0xa2, 0xe4, 0xb0, 0x85, 0xbe, 0xf8, 0xcc, 0xbb, 0xda,
-	0x1a, 0xe9, 0xe7, 0xf6, 0x41, 0x05, 0x10, 0x13, 0x6e, 0x21, 0x31, 0x2f,
-	0xa2, 0x3d, 0x49, 0x4b, 0xe8, 0x59, 0x39, 0x67, 0xaf, 0x76, 0xff, 0x7b,
-	0xd7, 0x6d, 0x30, 0x60, 0xc7, 0x51, 0xf4, 0x43, 0xab, 0x35, 0xc2, 0x27,
-	0x88, 0x19, 0x96, 0x0b, 0x5f, 0xfd, 0x6f, 0xef, 0x33, 0xe1, 0x4b, 0xd3,
-	0x03, 0xc5, 0x2c, 0xb7, 0xc8, 0xa8, 0x29, 0x9b, 0x34, 0x8c, 0x2a, 0x83,
-	0x33, 0x8f, 0x7b, 0x9d, 0x81, 0xab, 0x9c, 0xb9, 0xad, 0xc7, 0xc2, 0xd5,
-	0xd9, 0xe3, 0xe8, 0xf1, 0x04, 0x00, 0x11, 0x0e, 0x2b, 0x1c, 0x3d, 0x2a,
-	0x51, 0x38, 0x68, 0x46, 0x79, 0x54, 0x8d, 0x62, 0xc4, 0x70, 0xdf, 0x7c,
-	0xc3, 0x73, 0xdf, 0x64, 0x33, 0x57, 0xd6, 0x48, 0xfd, 0x3a, 0xb4, 0x2c,
-	0xcf, 0x1e, 0x8f, 0x10, 0xa3, 0x02, 0x67, 0xf4, 0x7c, 0xe6, 0x3b, 0xd8,
-	0x57, 0xca, 0x0b, 0xbc, 0x39, 0xae, 0xd1, 0x9f, 0x28, 0x92, 0x02, 0x84,
-	0x50, 0x89, 0xc7, 0x98, 0x19, 0xa6, 0xb6, 0xb4, 0x5e, 0xc2, 0xcf, 0xd0,
-	0x92, 0xde, 0xf0, 0xec, 0xc0, 0xfa, 0x16, 0x09, 0xe8, 0x16, 0x46, 0x25,
-	0x06, 0x33, 0x7d, 0x41, 0x1a, 0x4f, 0xc7, 0x5d, 0x09, 0x6b, 0x5d, 0x7a,
-	0x50, 0x79, 0xb6, 0x69, 0x83, 0x5c, 0xd1, 0x4d, 0x38, 0x40, 0xb9, 0x31,
-	0x07, 0x24, 0x93, 0x15, 0xdd, 0x07, 0x6c, 0xf9, 0xb3, 0xeb, 0x41, 0xdd,
-	0x8f, 0xcf, 0x0e, 0xc1, 0x78, 0xb3, 0xc5, 0xa4, 0x93, 0x97, 0xe9, 0x87,
-	0x8b, 0x84, 0x9b, 0x93, 0x01, 0xa1, 0x91, 0xaf, 0x46, 0xbd, 0xab, 0xcb,
-	0x77, 0xd9, 0xce, 0xe7, 0xa3, 0xf5, 0xf7, 0x03, 0xcc, 0x11, 0x21, 0x20,
-	0xef, 0x2d, 0x54, 0x3c, 0x09, 0x4a, 0x98, 0x58, 0xfc, 0x65, 0x56, 0x75,
-	0xed, 0x7c, 0x41, 0x6f, 0x62, 0x61, 0x1f, 0x53, 0x2e, 0x45, 0xfd, 0x36,
-	0x02, 0x29, 0xd7, 0x1a, 0xd6, 0x0c, 0xaf, 0xfe, 0xac, 0xf0, 0x88, 0xe2,
-	0x83, 0xd4, 0x5d, 0xc6, 0x5f, 0xb8, 0x28, 0xaa, 0x50, 0x9c, 0xb3, 0x8d,
-	0xc8, 0x82, 0xbb, 0x8d, 0x4d, 0x9c, 0x28, 0xaa, 0x61, 0xb8, 0x5b, 0xc6,
-	0x84, 0xd4, 0x88, 0xe2, 0xaa, 0xf0, 0xb3, 0xfe, 0xd3, 0x0c, 0xd8, 0x1a,
-	0x02, 0x29, 0xfc, 0x36, 0x2f, 0x45, 0x21, 0x53, 0x5b, 0x61, 0x51, 0x6f,
-	0xa2, 0x7c, 0x3f, 0x75, 0x06, 0x66, 0x90, 0x58, 0x10, 0x4a, 0x4e, 0x3c,
-	0xf5, 0x2d, 0x1c, 0x20, 0xd0, 0x11, 0xf3, 0x03, 0xa5, 0xf5, 0xcf, 0xe7,
-	0x76, 0xd9, 0xab, 0xcb, 0x46, 0xbd, 0x8f, 0xaf, 0x06, 0xa1, 0x90, 0x93,
-	0xbd, 0x84, 0x08, 0x88, 0x85, 0x97, 0xcf, 0xa4, 0x6f, 0xb3, 0x15, 0xc1,
-	0x8a, 0xcf, 0x47, 0xdd, 0xac, 0xeb, 0x75, 0xf9, 0xd1, 0x07, 0x9e, 0x15,
-	0x00, 0x24, 0xbe, 0x31, 0x34, 0x40, 0xd5, 0x4d, 0x7c, 0x5c, 0xc2, 0x69,
-	0x32, 0x79, 0x49, 0x7a, 0x11, 0x6b, 0xc1, 0x5d, 0x1f, 0x4f, 0x7a, 0x41,
-	0x07, 0x33, 0x47, 0x25, 0xe5, 0x16, 0x19, 0x09, 0xbf, 0xfa, 0xef, 0xec,
-	0x94, 0xde, 0xcd, 0xd0, 0x60, 0xc2, 0xb4, 0xb4, 0x1b, 0xa6, 0xc3, 0x98,
-	0x5d, 0x89, 0x06, 0x84, 0x23, 0x92, 0xd3, 0x9f, 0x38, 0xae, 0x0b, 0xbc,
-	0x58, 0xca, 0x3a, 0xd8, 0x7c, 0xe6, 0x67, 0xf4, 0xa2, 0x02, 0x91, 0x10,
-	0xcd, 0x1e, 0xb5, 0x2c, 0xfe, 0x3a, 0xd3, 0x48, 0x37, 0x57, 0xdb, 0x64,
-	0xc3, 0x73, 0xec, 0x7c, 0xcd, 0x70, 0x86, 0x62, 0x7d, 0x54, 0x67, 0x46,
-	0x4f, 0x38, 0x42, 0x2a, 0x25, 0x1c, 0x17, 0x0e, 0xfe, 0xff, 0xed, 0xf1,
-	0xd6, 0xe3, 0xc3, 0xd5, 0xb0, 0xc7, 0x95, 0xb9, 0x89, 0xab, 0x72, 0x9d,
-	0x3f, 0x8f, 0xfd, 0x82, 0x2e, 0x8c, 0x2a, 0x9b, 0xc7, 0xa8, 0x2e, 0xb7,
-	0x02, 0xc5, 0x4b, 0xd3, 0x33, 0xe1, 0x70, 0xef, 0x5c, 0xfd, 0x9c, 0x0b,
-	0x80, 0x19, 0xca, 0x27, 0xa5, 0x35, 0xf8, 0x43, 0xc3, 0x51, 0x36, 0x60,
-	0xcb, 0x6d, 0x3e, 0x7c, 0xc5, 0x76, 0x30, 0x67, 0xeb, 0x59, 0x48, 0x4b,
-	0xa4, 0x3d, 0x2f, 0x2f, 0x71, 0x21, 0x0b, 0x13, 0x45, 0x05, 0xe6, 0xf6,
-	0x1b, 0xe9, 0xb8, 0xda, 0xfc, 0xcc, 0x80, 0xbe, 0xea, 0xb0, 0x33, 0xa2,
-	0x04, 0x95, 0x6e, 0x85, 0x94, 0x86, 0x55, 0x96, 0x76, 0xa3, 0x35, 0xb2,
-	0xc3, 0xbf, 0x4a, 0xce, 0xfa, 0xdb, 0x68, 0xea, 0x29, 0xf8, 0x8f, 0x06,
-	0x51, 0x14, 0xbc, 0x22, 0x73, 0x30, 0xf0, 0x3e, 0x89, 0x4c, 0x3c, 0x5b,
-	0x6c, 0x68, 0x1c, 0x78, 0x60, 0x7b, 0x63, 0x6c, 0x03, 0x5f, 0x6b, 0x50,
-	0xbe, 0x42, 0x53, 0x34, 0x89, 0x26, 0x33, 0x18, 0x5a, 0x0a, 0x0d, 0xfc,
-	0x32, 0xee, 0xe0, 0xdf, 0x0e, 0xd2, 0xb1, 0xc3, 0xf0, 0xb5, 0x72, 0xa7,
-	0xf8, 0x99, 0xba, 0x8a, 0x64, 0x83, 0xba, 0x90, 0x9e, 0x9e, 0xe3, 0xac,
-	0xce, 0xba, 0x07, 0xc9, 0xfa, 0xd6, 0x2d, 0xe5, 0x27, 0xf3, 0x53, 0x01,
-	0x51, 0x0f, 0x7d, 0x1d, 0x76, 0x2b, 0xab, 0x39, 0x9a, 0x47, 0xdd, 0x55,
-	0xad, 0x63, 0x4f, 0x72, 0xfb, 0x7c, 0x46, 0x72, 0xb3, 0x63, 0xd9, 0x55,
-	0x9d, 0x47, 0xa8, 0x39, 0x78, 0x2b, 0x7c, 0x1d, 0x52, 0x0f, 0x52, 0x01,
-	0x28, 0xf3, 0x2a, 0xe5, 0xff, 0xd6, 0x02, 0xc9, 0xd3, 0xba, 0xde, 0xac,
-	0xa4, 0x9e, 0xb0, 0x90, 0x7e, 0x83, 0xc3, 0x8a, 0xf7, 0x99, 0x72, 0xa7,
-	0xef, 0xb5, 0xb3, 0xc3, 0x0a, 0xd2, 0xe4, 0xdf, 0x30, 0xee, 0x0d, 0xfc,
-	0x5b, 0x0a, 0x32, 0x18, 0x89, 0x26, 0x54, 0x34, 0xbc, 0x42, 0x6f, 0x50,
-	0xfb, 0x5e, 0x71, 0x6c, 0x36, 0x7b, 0x00, 0x78, 0x78, 0x68, 0x34, 0x5b,
-	0x8e, 0x4c, 0xed, 0x3e, 0x75, 0x30, 0xba, 0x22, 0x53, 0x14, 0x8d, 0x06,
-	0x2b, 0xf8, 0x66, 0xea, 0xfd, 0xdb, 0x46, 0xce, 0xc6, 0xbf, 0x31, 0xb2,
-	0x7e, 0xa3, 0x45, 0x96, 0xc7, 0x86, 0xa2, 0x85, 0xf2, 0x94, 0x3f, 0xa2,
-	0xe2, 0xb0, 0x83, 0xbe, 0xfd, 0xcc, 0xb6, 0xda, 0x1d, 0xe9, 0xe6, 0xf6,
-	0x41, 0x05, 0x11, 0x13, 0x6c, 0x21, 0x34, 0x2f, 0x9f, 0x3d, 0x4c, 0x4b,
-	0xe7, 0x59, 0x37, 0x67, 0xb0, 0x76, 0x28, 0x7c, 0xd4, 0x6d, 0x32, 0x60,
-	0xc3, 0x51, 0xf9, 0x43, 0xa5, 0x35, 0xca, 0x27, 0x7f, 0x19, 0x9e, 0x0b,
-	0x58, 0xfd, 0x75, 0xef, 0x2e, 0xe1, 0x4f, 0xd3, 0x00, 0xc5, 0x2e, 0xb7,
-	0xc7, 0xa8, 0x29, 0x9b, 0x33, 0x8c, 0xcb, 0x82, 0x3a, 0x8f, 0x76, 0x9d,
-	0x86, 0xab, 0x98, 0xb9, 0xaf, 0xc7, 0xc3, 0xd5, 0xd5, 0xe3, 0xee, 0xf1,
-	0xfe, 0xff, 0x16, 0x0e, 0x28, 0x1c, 0x3e, 0x2a, 0x51, 0x38, 0x67, 0x46,
-	0x7d, 0x54, 0x87, 0x62, 0xc8, 0x70, 0x33, 0x7d, 0xce, 0x73, 0xd9, 0x64,
-	0x36, 0x57, 0xd4, 0x48, 0xfd, 0x3a, 0xb5, 0x2c, 0xce, 0x1e, 0x90, 0x10,
-	0xa3, 0x02, 0x65, 0xf4, 0x7f, 0xe6, 0x37, 0xd8, 0x5b, 0xca, 0x08, 0xbc,
-	0x3c, 0xae, 0xcd, 0x9f, 0x2d, 0x92, 0xd8, 0x83, 0x50, 0x89, 0xca, 0x98,
-	0x17, 0xa6, 0xb6, 0xb4, 0x60, 0xc2, 0xcc, 0xd0, 0x95, 0xde, 0xef, 0xec,
-	0xbe, 0xfa, 0x1b, 0x09, 0xe2, 0x16, 0x4b, 0x25, 0x02, 0x33, 0x80, 0x41,
-	0x19, 0x4f, 0xc6, 0x5d, 0x0b, 0x6b, 0x5f, 0x7a, 0x38, 0x79, 0xbe, 0x69,
-	0x7d, 0x5c, 0xd6, 0x4d, 0x32, 0x40, 0xc0, 0x31, 0x00, 0x24, 0x9b, 0x15,
-	0xd5, 0x07, 0x72, 0xf9, 0xae, 0xeb, 0x47, 0xdd, 0x88, 0xcf, 0x16, 0xc1,
-	0x6f, 0xb3, 0xcf, 0xa4, 0x86, 0x97, 0x01, 0x88, 0xc9, 0x84, 0x90, 0x93,
-	0x04, 0xa1, 0x91, 0xaf, 0x45, 0xbd, 0xaa, 0xcb, 0x7a, 0xd9, 0xca, 0xe7,
-	0xa8, 0xf5, 0xf2, 0x03, 0xcf, 0x11, 0x1f, 0x20, 0xf3, 0x2d, 0x4e, 0x3c,
-	0x11, 0x4a, 0x8e, 0x58, 0x09, 0x66, 0x3d, 0x75, 0x82, 0x7c, 0x4f, 0x6f,
-	0x5f, 0x61, 0x1f, 0x53, 0x2e, 0x45, 0xff, 0x36, 0xfe, 0x28, 0xdb, 0x1a,
-	0xd3, 0x0c, 0xb1, 0xfe, 0xac, 0xf0, 0x87, 0xe2, 0x85, 0xd4, 0x59, 0xc6,
-	0x62, 0xb8, 0x28, 0xaa, 0x4d, 0x9c, 0xbb, 0x8d, 0x02, 0x83, 0xb4, 0x8d,
-	0x50, 0x9c, 0x27, 0xaa, 0x61, 0xb8, 0x5b, 0xc6, 0x85, 0xd4, 0x85, 0xe2,
-	0xaf, 0xf0, 0xac, 0xfe, 0xda, 0x0c, 0xd3, 0x1a, 0x06, 0x29, 0xf8, 0x36,
-	0x32, 0x45, 0x1e, 0x53, 0x60, 0x61, 0x49, 0x6f, 0x99, 0x7c, 0x49, 0x75,
-	0x03, 0x66, 0x94, 0x58, 0x0b, 0x4a, 0x53, 0x3c, 0xef, 0x2d, 0x22, 0x20,
-	0xcc, 0x11, 0xf6, 0x03, 0xa4, 0xf5, 0xcd, 0xe7, 0x78, 0xd9, 0xac, 0xcb,
-	0x43, 0xbd, 0x94, 0xaf, 0xfd, 0xa0, 0x9f, 0x93, 0x9d, 0x84, 0xe6, 0x87,
-	0x92, 0x97, 0xc6, 0xa4, 0x77, 0xb3, 0x0f, 0xc1, 0x8d, 0xcf, 0x45, 0xdd,
-	0xae, 0xeb, 0x73, 0xf9, 0xd4, 0x07, 0x9a, 0x15, 0x04, 0x24, 0xb9, 0x31,
-	0x3b, 0x40, 0xcb, 0x4d, 0x8b, 0x5c, 0xaa, 0x69, 0x6c, 0x79, 0x93, 0x7a,
-	0xfc, 0x6a, 0xcc, 0x5d, 0x18, 0x4f, 0x7f, 0x41, 0x02, 0x33, 0x4c, 0x25,
-	0xe1, 0x16, 0x1d, 0x09, 0xbb, 0xfa, 0xf3, 0xec, 0x90, 0xde, 0xd0, 0xd0,
-	0x5d, 0xc2, 0xb9, 0xb4, 0x13, 0xa6, 0xd2, 0x98, 0x39, 0x89, 0xc2, 0x83,
-	0x37, 0x92, 0xc7, 0x9f, 0x41, 0xae, 0x04, 0xbc, 0x5e, 0xca, 0x34, 0xd8,
-	0x82, 0xe6, 0x61, 0xf4, 0xa7, 0x02, 0x8e, 0x10, 0xcf, 0x1e, 0xb4, 0x2c,
-	0xfe, 0x3a, 0xd2, 0x48, 0x39, 0x57, 0xd8, 0x64, 0xce, 0x73, 0x08, 0x7d,
-	0xbd, 0x70, 0x8f, 0x62, 0x79, 0x54, 0x69, 0x46, 0x4f, 0x38, 0x40, 0x2a,
-	0x26, 0x1c, 0x17, 0x0e, 0xff, 0xff, 0xec, 0xf1, 0xd6, 0xe3, 0xc4, 0xd5,
-	0xad, 0xc7, 0x9b, 0xb9, 0x82, 0xab, 0x7a, 0x9d, 0x33, 0x8f, 0x15, 0x83,
-	0x3d, 0x8c, 0x23, 0x9b, 0xcc, 0xa8, 0x2a, 0xb7, 0x04, 0xc5, 0x4b, 0xd3,
-	0x32, 0xe1, 0x70, 0xef, 0x5e, 0xfd, 0x97, 0x0b, 0x88, 0x19, 0xc2, 0x27,
-	0xaa, 0x35, 0xf4, 0x43, 0xc8, 0x51, 0x2e, 0x60, 0xdb, 0x6d, 0xfc, 0x7b,
-	0xa0, 0x76, 0x41, 0x67, 0xe2, 0x59, 0x4d, 0x4b, 0x9f, 0x3d, 0x34, 0x2f,
-	0x6b, 0x21, 0x14, 0x13, 0x3c, 0x05, 0xed, 0xf6, 0x14, 0xe9, 0xc0, 0xda,
-	0xf4, 0xcc, 0x89, 0xbe, 0xdf, 0xb0, 0x41, 0xa2, 0xed, 0x94, 0xb9, 0x85,
-	0xcc, 0x86, 0x40, 0x96, 0x83, 0xa3, 0x2a, 0xb2, 0xce, 0xbf, 0x40, 0xce,
-	0x01, 0xdc, 0x64, 0xea, 0x2b, 0xf8, 0x8e, 0x06, 0x52, 0x14, 0xbb, 0x22,
-	0x74, 0x30, 0xef, 0x3e, 0x8b, 0x4c, 0x37, 0x5b, 0x76, 0x68, 0xfc, 0x77,
-	0x3f, 0x7b, 0x73, 0x6c, 0xfa, 0x5e, 0x70, 0x50, 0xba, 0x42, 0x56, 0x34,
-	0x87, 0x26, 0x34, 0x18, 0x5b, 0x0a, 0x0b, 0xfc, 0x33, 0xee, 0xe0, 0xdf,
-	0x0e, 0xd2, 0xb0, 0xc3, 0xf2, 0xb5, 0x70, 0xa7, 0xf8, 0x99, 0xc3, 0x8a,
-	0x5c, 0x83, 0xb2, 0x90, 0xa2, 0x9e, 0xe2, 0xac, 0xcd, 0xba, 0x09, 0xc9,
-	0xf8, 0xd6, 0x2f, 0xe5, 0x25, 0xf3, 0x55, 0x01, 0x4f, 0x0f, 0x7e, 0x1d,
-	0x76, 0x2b, 0xaa, 0x39, 0x9c, 0x47, 0xda, 0x55, 0xb2, 0x63, 0x45, 0x72,
-	0x38, 0x7d, 0x4e, 0x72, 0xaf, 0x63, 0xda, 0x55, 0x9d, 0x47, 0xa8, 0x39,
-	0x79, 0x2b, 0x7c, 0x1d, 0x51, 0x0f, 0x52, 0x01, 0x29, 0xf3, 0x29, 0xe5,
-	0xff, 0xd6, 0x04, 0xc9, 0xcf, 0xba, 0xe5, 0xac, 0x99, 0x9e, 0xc3, 0x90,
-	0x12, 0x83, 0xa9, 0x8a, 0x05, 0x9a, 0x68, 0xa7, 0xf7, 0xb5, 0xac, 0xc3,
-	0x11, 0xd2, 0xde, 0xdf, 0x34, 0xee, 0x0b, 0xfc, 0x5b, 0x0a, 0x33, 0x18,
-	0x88, 0x26, 0x55, 0x34, 0xbc, 0x42, 0x6c, 0x50, 0x03, 0x5f, 0x60, 0x6c,
-	0x79, 0x7b, 0x15, 0x78, 0x6d, 0x68, 0x3b, 0x5b, 0x8b, 0x4c, 0xed, 0x3e,
-	0x77, 0x30, 0xb8, 0x22, 0x52, 0x14, 0x90, 0x06, 0x28, 0xf8, 0x69, 0xea,
-	0xfb, 0xdb, 0x46, 0xce, 0xc7, 0xbf, 0x30, 0xb2, 0x7e, 0xa3, 0x48, 0x96,
-	0xb2, 0x86, 0xa1, 0x85, 0xf7, 0x94, 0x3c, 0xa2, 0xe3, 0xb0, 0x85, 0xbe,
-	0xf8, 0xcc, 0xbb, 0xda, 0x19, 0xe9, 0xe9, 0xf6, 0x40, 0x05, 0x0f, 0x13,
-	0x70, 0x21, 0x30, 0x2f, 0xa2, 0x3d, 0x4b, 0x4b, 0xe5, 0x59, 0x3b, 0x67,
-	0xaf, 0x76, 0xfe, 0x7b, 0xd8, 0x6d, 0x31, 0x60, 0xc3, 0x51, 0xfa, 0x43,
-	0xa5, 0x35, 0xc7, 0x27, 0x84, 0x19, 0x98, 0x0b, 0x5e, 0xfd, 0x71, 0xef,
-	0x31, 0xe1, 0x4b, 0xd3, 0x05, 0xc5, 0x29, 0xb7, 0xcc, 0xa8, 0x25, 0x9b,
-	0x36, 0x8c, 0x2a, 0x83, 0x33, 0x8f, 0x7a, 0x9d, 0x83, 0xab, 0x9a, 0xb9,
-	0xaf, 0xc7, 0xc0, 0xd5, 0xda, 0xe3, 0xe8, 0xf1, 0x04, 0x00, 0x12, 0x0e,
-	0x29, 0x1c, 0x3f, 0x2a, 0x50, 0x38, 0x67, 0x46, 0x7e, 0x54, 0x84, 0x62,
-	0xcf, 0x70, 0xd4, 0x7c, 0xcc, 0x73, 0xd9, 0x64, 0x36, 0x57, 0xd6, 0x48,
-	0xfa, 0x3a, 0xb8, 0x2c, 0xcb, 0x1e, 0x92, 0x10, 0xa2, 0x02, 0x66, 0xf4,
-	0x7d, 0xe6, 0x39, 0xd8, 0x59, 0xca, 0x0a, 0xbc, 0x3a, 0xae, 0xd0, 0x9f,
-	0x28, 0x92, 0x01, 0x84, 0x52, 0x89, 0xc5, 0x98, 0x1c, 0xa6, 0xb3, 0xb4,
-	0x61, 0xc2, 0xcd, 0xd0, 0x91, 0xde, 0xf3, 0xec, 0xbc, 0xfa, 0x1c, 0x09,
-	0xe2, 0x16, 0x4a, 0x25, 0x03, 0x33, 0x7f, 0x41, 0x1a, 0x4f, 0xc5, 0x5d,
-	0x0b, 0x6b, 0x5c, 0x7a, 0x51, 0x79, 0xb6, 0x69, 0x82, 0x5c, 0xd2, 0x4d,
-	0x36, 0x40, 0xbd, 0x31, 0x02, 0x24, 0x9a, 0x15, 0xd5, 0x07, 0x72, 0xf9,
-	0xaf, 0xeb, 0x44, 0xdd, 0x8d, 0xcf, 0x0f, 0xc1, 0x79, 0xb3, 0xc3, 0xa4,
-	0x94, 0x97, 0xe9, 0x87, 0x89, 0x84, 0xa0, 0x93, 0xfb, 0xa0, 0x97, 0xaf,
-	0x3f, 0xbd, 0xb1, 0xcb, 0x72, 0xd9, 0xd3, 0xe7, 0x9f, 0xf5, 0xfa, 0x03,
-	0xc8, 0x11, 0x25, 0x20, 0xec, 0x2d, 0x57, 0x3c, 0x06, 0x4a, 0x9b, 0x58,
-	0xf8, 0x65, 0x59, 0x75, 0xed, 0x7c, 0x3f, 0x6f, 0x65, 0x61, 0x1a, 0x53,
-	0x33, 0x45, 0xfa, 0x36, 0x04, 0x29, 0xd6, 0x1a, 0xd6, 0x0c, 0xaf, 0xfe,
-	0xae, 0xf0, 0x84, 0xe2, 0x88, 0xd4, 0x57, 0xc6, 0x65, 0xb8, 0x24, 0xaa,
-	0x52, 0x9c, 0xb3, 0x8d, 0xc5, 0x82, 0xbe, 0x8d, 0x4c, 0x9c, 0x28, 0xaa,
-	0x63, 0xb8, 0x57, 0xc6, 0x88, 0xd4, 0x84, 0xe2, 0xb0, 0xf0, 0xac, 0xfe,
-	0xd9, 0x0c, 0xd4, 0x1a, 0x04, 0x29, 0xfb, 0x36, 0x31, 0x45, 0x1e, 0x53,
-	0x5f, 0x61, 0x4c, 0x6f, 0xa6, 0x7c, 0x3d, 0x75, 0x07, 0x66, 0x91, 0x58,
-	0x0c, 0x4a, 0x53, 0x3c, 0xf0, 0x2d, 0x21, 0x20, 0xcc, 0x11, 0xf6, 0x03,
-	0xa4, 0xf5, 0xcd, 0xe7, 0x7a, 0xd9, 0xa7, 0xcb, 0x49, 0xbd, 0x8f, 0xaf,
-	0x03, 0xa1, 0x94, 0x93, 0xba, 0x84, 0x08, 0x88, 0x89, 0x97, 0xc8, 0xa4,
-	0x76, 0xb3, 0x11, 0xc1, 0x8b, 0xcf, 0x47, 0xdd, 0xac, 0xeb, 0x73, 0xf9,
-	0xd5, 0x07, 0x9b, 0x15, 0x01, 0x24, 0xbe, 0x31, 0x34, 0x40, 0xd4, 0x4d,
-	0x7e, 0x5c, 0xc0, 0x69, 0x34, 0x79, 0x47, 0x7a, 0x13, 0x6b, 0xbe, 0x5d,
-	0x23, 0x4f, 0x76, 0x41, 0x0c, 0x33, 0x41, 0x25, 0xea, 0x16, 0x15, 0x09,
-	0xc3, 0xfa, 0xec, 0xec, 0x97, 0xde, 0xc9, 0xd0, 0x63, 0xc2, 0xb2, 0xb4,
-	0x1d, 0xa6, 0xc2, 0x98, 0x5c, 0x89, 0x07, 0x84, 0x22, 0x92, 0xd5, 0x9f,
-	0x37, 0xae, 0x0a, 0xbc, 0x59, 0xca, 0x39, 0xd8, 0x7d, 0xe6, 0x68, 0xf4,
-	0xa0, 0x02, 0x92, 0x10, 0xcc, 0x1e, 0xb6, 0x2c, 0xfd, 0x3a, 0xd4, 0x48,
-	0x37, 0x57, 0xd9, 0x64, 0xc7, 0x73, 0xe8, 0x7c, 0xcf, 0x70, 0x86, 0x62,
-	0x7d, 0x54, 0x66, 0x46, 0x53, 0x38, 0x3b, 0x2a, 0x2c, 0x1c, 0x12, 0x0e,
-	0x01, 0x00, 0xeb, 0xf1, 0xd8, 0xe3, 0xc0, 0xd5, 0xb3, 0xc7, 0x93, 0xb9,
-	0x8b, 0xab, 0x70, 0x9d, 0x41, 0x8f, 0xfa, 0x82, 0x31, 0x8c, 0x28, 0x9b,
-	0xca, 0xa8, 0x29, 0xb7, 0x07, 0xc5, 0x47, 0xd3, 0x36, 0xe1, 0x6e, 0xef,
-	0x5d, 0xfd, 0x9a, 0x0b, 0x83, 0x19, 0xc8, 0x27, 0xa5, 0x35, 0xfa, 0x43,
-	0xbf, 0x51, 0x3a, 0x60, 0xc8, 0x6d, 0x3f, 0x7c, 0xc6, 0x76, 0x2d, 0x67,
-	0xef, 0x59, 0x46, 0x4b, 0xa3, 0x3d, 0x32, 0x2f, 0x6c, 0x21, 0x11, 0x13,
-	0x41, 0x05, 0xe8, 0xf6, 0x19, 0xe9, 0xba, 0xda, 0xfa, 0xcc, 0x83, 0xbe,
-	0xe7, 0xb0, 0x34, 0xa2, 0x04, 0x95, 0x6f, 0x85, 0x91, 0x86, 0x5a, 0x96,
-	0x71, 0xa3, 0x38, 0xb2, 0xc3, 0xbf, 0x47, 0xce, 0xfe, 0xdb, 0x64, 0xea,
-	0x2d, 0xf8, 0x8b, 0x06, 0x55, 0x14, 0xb8, 0x22, 0x76, 0x30, 0xef, 0x3e,
-	0x89, 0x4c, 0x3c, 0x5b, 0x6b, 0x68, 0x1c, 0x78, 0x62, 0x7b, 0x62, 0x6c,
-	0x02, 0x5f, 0x6c, 0x50, 0xbd, 0x42, 0x53, 0x34, 0x8b, 0x26, 0x30, 0x18,
-	0x5d, 0x0a, 0x0c, 0xfc, 0x30, 0xee, 0xe3, 0xdf, 0x0d, 0xd2, 0xb0, 0xc3,
-	0xf2, 0xb5, 0x6f, 0xa7, 0xfb, 0x99, 0xb8, 0x8a, 0x67, 0x83, 0xb6, 0x90,
-	0xa1, 0x9e, 0xe1, 0xac, 0xd0, 0xba, 0x05, 0xc9, 0xfc, 0xd6, 0x2c, 0xe5,
-	0x28, 0xf3, 0x52, 0x01, 0x51, 0x0f, 0x7c, 0x1d, 0x79, 0x2b, 0xa8, 0x39,
-	0x9d, 0x47, 0xd9, 0x55, 0xb1, 0x63, 0x4b, 0x72, 0xfe, 0x7c, 0x44, 0x72,
-	0xb5, 0x63, 0xd7, 0x55, 0x9e, 0x47, 0xa7, 0x39, 0x79, 0x2b, 0x7d, 0x1d,
-	0x51, 0x0f, 0x52, 0x01, 0x28, 0xf3, 0x2b, 0xe5, 0xfd, 0xd6, 0x05, 0xc9,
-	0xcf, 0xba, 0xe2, 0xac, 0xa2, 0x9e, 0xb0, 0x90, 0x7f, 0x83, 0xc1, 0x8a,
-	0xf9, 0x99, 0x70, 0xa7, 0xf1, 0xb5, 0xb2, 0xc3, 0x0b, 0xd2, 0xe3, 0xdf,
-	0x30, 0xee, 0x0e, 0xfc, 0x59, 0x0a, 0x35, 0x18, 0x85, 0x26, 0x58, 0x34,
-	0xba, 0x42, 0x6f, 0x50, 0xfc, 0x5e, 0x6f, 0x6c, 0x38, 0x7b, 0x00, 0x78,
-	0x77, 0x68, 0x34, 0x5b, 0x8f, 0x4c, 0xea, 0x3e, 0x7a, 0x30, 0xb5, 0x22,
-	0x58, 0x14, 0x88, 0x06, 0x2f, 0xf8, 0x63, 0xea, 0xff, 0xdb, 0x44, 0xce,
-	0xca, 0xbf, 0x2c, 0xb2, 0x83, 0xa3, 0x41, 0x96, 0xc8, 0x86, 0xa3, 0x85,
-	0xf0, 0x94, 0x42, 0xa2, 0xde, 0xb0, 0x89, 0xbe, 0xf4, 0xcc, 0xbf, 0xda,
-	0x16, 0xe9, 0xeb, 0xf6, 0x3f, 0x05, 0x11, 0x13, 0x6d, 0x21, 0x32, 0x2f,
-	0xa2, 0x3d, 0x49, 0x4b, 0xe9, 0x59, 0x38, 0x67, 0xac, 0x76, 0x2e, 0x7c,
-	0xcc, 0x6d, 0x3a, 0x60, 0xbe, 0x51, 0xfc, 0x43, 0xa4, 0x35, 0xc8, 0x27,
-	0x83, 0x19, 0x9a, 0x0b, 0x5b, 0xfd, 0x74, 0xef, 0x2e, 0xe1, 0x4f, 0xd3,
-	0x00, 0xc5, 0x2d, 0xb7, 0xc9, 0xa8, 0x27, 0x9b, 0x35, 0x8c, 0xc9, 0x82,
-	0x3c, 0x8f, 0x75, 0x9d, 0x86, 0xab, 0x98, 0xb9, 0xaf, 0xc7, 0xc2, 0xd5,
-	0xd7, 0xe3, 0xed, 0xf1, 0xfe, 0xff, 0x16, 0x0e, 0x28, 0x1c, 0x3d, 0x2a,
-	0x53, 0x38, 0x65, 0x46, 0x7e, 0x54, 0x87, 0x62, 0xc7, 0x70, 0x35, 0x7d,
-	0xcd, 0x73, 0xd8, 0x64, 0x37, 0x57, 0xd5, 0x48, 0xfc, 0x3a, 0xb5, 0x2c,
-	0xce, 0x1e, 0x90, 0x10, 0xa3, 0x02, 0x67, 0xf4, 0x7b, 0xe6, 0x3b, 0xd8,
-	0x59, 0xca, 0x08, 0xbc, 0x3c, 0xae, 0xce, 0x9f, 0x2d, 0x92, 0xd8, 0x83,
-	0x50, 0x89, 0xc8, 0x98, 0x1a, 0xa6, 0xb4, 0xb4, 0x61, 0xc2, 0xcd, 0xd0,
-	0x91, 0xde, 0xf3, 0xec, 0xbc, 0xfa, 0x1b, 0x09, 0xe4, 0x16, 0x47, 0x25,
-	0x08, 0x33, 0x79, 0x41, 0x20, 0x4f, 0xc0, 0x5d, 0x0e, 0x6b, 0x5f, 0x7a,
-	0x38, 0x79, 0xbd, 0x69, 0x7e, 0x5c, 0xd4, 0x4d, 0x35, 0x40, 0xbe, 0x31,
-	0x00, 0x24, 0x9c, 0x15, 0xd3, 0x07, 0x75, 0xf9, 0xab, 0xeb, 0x48, 0xdd,
-	0x89, 0xcf, 0x15, 0xc1, 0x70, 0xb3, 0xcd, 0xa4, 0x87, 0x97, 0x01, 0x88,
-	0xca, 0x84, 0x8e, 0x93, 0x07, 0xa1, 0x8e, 0xaf, 0x46, 0xbd, 0xab, 0xcb,
-	0x78, 0xd9, 0xce, 0xe7, 0xa5, 0xf5, 0xf2, 0x03, 0xd0, 0x11, 0x1e, 0x20,
-	0xf4, 0x2d, 0x4e, 0x3c, 0x11, 0x4a, 0x8d, 0x58, 0x0b, 0x66, 0x3a, 0x75,
-	0x85, 0x7c, 0x4d, 0x6f, 0x61, 0x61, 0x1c, 0x53, 0x32, 0x45, 0xfa, 0x36,
-	0x04, 0x29, 0xd4, 0x1a, 0xda, 0x0c, 0xab, 0xfe, 0xb1, 0xf0, 0x82, 0xe2,
-	0x89, 0xd4, 0x57, 0xc6, 0x64, 0xb8, 0x26, 0xaa, 0x4d, 0x9c, 0xbc, 0x8d,
-	0x01, 0x83, 0xb6, 0x8d, 0x4e, 0x9c, 0x28, 0xaa, 0x61, 0xb8, 0x59, 0xc6,
-	0x89, 0xd4, 0x81, 0xe2, 0xb2, 0xf0, 0xab, 0xfe, 0xd8, 0x0c, 0xd7, 0x1a,
-	0x02, 0x29, 0xfc, 0x36, 0x30, 0x45, 0x1d, 0x53, 0x62, 0x61, 0x47, 0x6f,
-	0x9c, 0x7c, 0x46, 0x75, 0x06, 0x66, 0x90, 0x58, 0x0f, 0x4a, 0x50, 0x3c,
-	0xf1, 0x2d, 0x22, 0x20, 0xca, 0x11, 0xf8, 0x03, 0xa1, 0xf5, 0xd1, 0xe7,
-	0x75, 0xd9, 0xae, 0xcb, 0x40, 0xbd, 0x98, 0xaf, 0xfa, 0xa0, 0xa0, 0x93,
-	0x9e, 0x84, 0xe3, 0x87, 0x98, 0x97, 0xbe, 0xa4, 0x7e, 0xb3, 0x0b, 0xc1,
-	0x8f, 0xcf, 0x44, 0xdd, 0xad, 0xeb, 0x74, 0xf9, 0xd5, 0x07, 0x99, 0x15,
-	0x04, 0x24, 0xb8, 0x31, 0x3d, 0x40, 0xc9, 0x4d, 0x8e, 0x5c, 0xa5, 0x69,
-	0x72, 0x79, 0x8e, 0x7a, 0xfe, 0x6a, 0xcc, 0x5d, 0x16, 0x4f, 0x82, 0x41,
-	0x01, 0x33, 0x4b, 0x25, 0xe2, 0x16, 0x1b, 0x09, 0xbe, 0xfa, 0xf1, 0xec,
-	0x91, 0xde, 0xd0, 0xd0, 0x5b, 0xc2, 0xbc, 0xb4, 0x10, 0xa6, 0xd4, 0x98,
-	0x38, 0x89, 0xc4, 0x83, 0x35, 0x92, 0xc8, 0x9f, 0x40, 0xae, 0x06, 0xbc,
-	0x5c, 0xca, 0x37, 0xd8, 0x7e, 0xe6, 0x64, 0xf4, 0xa7, 0x02, 0x8b, 0x10,
-	0xd4, 0x1e, 0xae, 0x2c, 0x02, 0x3b, 0xd2, 0x48, 0x37, 0x57, 0xda, 0x64,
-	0xcd, 0x73, 0x06, 0x7d, 0xc2, 0x70, 0x8a, 0x62, 0x7c, 0x54, 0x67, 0x46,
-	0x51, 0x38, 0x3e, 0x2a, 0x28, 0x1c, 0x15, 0x0e, 0x00, 0x00, 0xec, 0xf1,
-	0xd6, 0xe3, 0xc4, 0xd5, 0xac, 0xc7, 0x9c, 0xb9, 0x82, 0xab, 0x79, 0x9d,
-	0x35, 0x8f, 0x13, 0x83, 0x3e, 0x8c, 0x23, 0x9b, 0xcb, 0xa8, 0x2b, 0xb7,
-	0x04, 0xc5, 0x4a, 0xd3, 0x33, 0xe1, 0x70, 0xef, 0x5e, 0xfd, 0x97, 0x0b,
-	0x86, 0x19, 0xc4, 0x27, 0xa9, 0x35, 0xf7, 0x43, 0xc4, 0x51, 0x30, 0x60,
-	0xdb, 0x6d, 0xfb, 0x7b, 0xa3, 0x76, 0x3d, 0x67, 0xe4, 0x59, 0x4d, 0x4b,
-	0x9f, 0x3d, 0x35, 0x2f, 0x6a, 0x21, 0x13, 0x13, 0x3e, 0x05, 0xea, 0xf6,
-	0x19, 0xe9, 0xbb, 0xda, 0xf7, 0xcc, 0x87, 0xbe, 0xe1, 0xb0, 0x3f, 0xa2,
-	0xf0, 0x94, 0xb5, 0x85, 0xcf, 0x86, 0x3f, 0x96, 0x82, 0xa3, 0x2d, 0xb2,
-	0xca, 0xbf, 0x43, 0xce, 0x00, 0xdc, 0x63, 0xea, 0x2d, 0xf8, 0x8c, 0x06,
-	0x54, 0x14, 0xb9, 0x22, 0x76, 0x30, 0xec, 0x3e, 0x8f, 0x4c, 0x33, 0x5b,
-	0x7a, 0x68, 0xf8, 0x77, 0x43, 0x7b, 0x70, 0x6c, 0xfb, 0x5e, 0x70, 0x50,
-	0xb9, 0x42, 0x58, 0x34, 0x85, 0x26, 0x36, 0x18, 0x59, 0x0a, 0x0c, 0xfc,
-	0x33, 0xee, 0xe0, 0xdf, 0x0d, 0xd2, 0xb2, 0xc3, 0xf0, 0xb5, 0x71, 0xa7,
-	0xf8, 0x99, 0xc3, 0x8a, 0x5b, 0x83, 0xb3, 0x90, 0xa1, 0x9e, 0xe3, 0xac,
-	0xcd, 0xba, 0x08, 0xc9, 0xfa, 0xd6, 0x2c, 0xe5, 0x29, 0xf3, 0x50, 0x01,
-	0x54, 0x0f, 0x79, 0x1d, 0x7d, 0x2b, 0xa3, 0x39, 0xa1, 0x47, 0xd7, 0x55,
-	0xb2, 0x63, 0x47, 0x72, 0x36, 0x7d, 0x50, 0x72, 0xad, 0x63, 0xdc, 0x55,
-	0x9b, 0x47, 0xaa, 0x39, 0x76, 0x2b, 0x7f, 0x1d, 0x4e, 0x0f, 0x55, 0x01,
-	0x27, 0xf3, 0x2b, 0xe5, 0xfd, 0xd6, 0x05, 0xc9, 0xce, 0xba, 0xe4, 0xac,
-	0x9c, 0x9e, 0xc1, 0x90, 0x12, 0x83, 0xab, 0x8a, 0x02, 0x9a, 0x69, 0xa7,
-	0xf8, 0xb5, 0xaa, 0xc3, 0x14, 0xd2, 0xdc, 0xdf, 0x35, 0xee, 0x0a, 0xfc,
-	0x5c, 0x0a, 0x33, 0x18, 0x87, 0x26, 0x57, 0x34, 0xba, 0x42, 0x6e, 0x50,
-	0x01, 0x5f, 0x63, 0x6c, 0x75, 0x7b, 0x19, 0x78, 0x69, 0x68, 0x40, 0x5b,
-	0x85, 0x4c, 0xf4, 0x3e, 0x6f, 0x30, 0xbe, 0x22, 0x51, 0x14, 0x8d, 0x06,
-	0x2d, 0xf8, 0x63, 0xea, 0x00, 0xdc, 0x43, 0xce, 0xca, 0xbf, 0x2e, 0xb2,
-	0x7e, 0xa3, 0x49, 0x96, 0xb1, 0x86, 0xa2, 0x85, 0xf7, 0x94, 0x3b, 0xa2,
-	0xe3, 0xb0, 0x87, 0xbe, 0xf5, 0xcc, 0xbe, 0xda, 0x17, 0xe9, 0xe9, 0xf6,
-	0x42, 0x05, 0x0d, 0x13, 0x71, 0x21, 0x2f, 0x2f, 0xa4, 0x3d, 0x48, 0x4b,
-	0xe9, 0x59, 0x37, 0x67, 0xb0, 0x76, 0x01, 0x7c, 0xd3, 0x6d, 0x36, 0x60,
-	0xc0, 0x51, 0xfb, 0x43, 0xa4, 0x35, 0xc9, 0x27, 0x82, 0x19, 0x9b, 0x0b,
-	0x5b, 0xfd, 0x71, 0xef, 0x32, 0xe1, 0x4b, 0xd3, 0x05, 0xc5, 0x28, 0xb7,
-	0xce, 0xa8, 0x22, 0x9b, 0x39, 0x8c, 0x27, 0x83, 0x36, 0x8f, 0x78, 0x9d,
-	0x85, 0xab, 0x98, 0xb9, 0xaf, 0xc7, 0xc2, 0xd5, 0xd8, 0xe3, 0xeb, 0xf1,
-	0x00, 0x00, 0x15, 0x0e, 0x27, 0x1c, 0x41, 0x2a, 0x4e, 0x38, 0x69, 0x46,
-	0x7a, 0x54, 0x8a, 0x62, 0xc9, 0x70, 0xd9, 0x7c, 0xc9, 0x73, 0xd9, 0x64,
-	0x37, 0x57, 0xd5, 0x48, 0xfc, 0x3a, 0xb6, 0x2c, 0xcd, 0x1e, 0x90, 0x10,
-	0xa3, 0x02, 0x67, 0xf4, 0x7c, 0xe6, 0x3a, 0xd8, 0x59, 0xca, 0x09, 0xbc,
-	0x3b, 0xae, 0xd0, 0x9f, 0x27, 0x92, 0x04, 0x84, 0x4e, 0x89, 0xc8, 0x98,
-	0x1a, 0xa6, 0xb4, 0xb4, 0x60, 0xc2, 0xce, 0xd0, 0x91, 0xde, 0xf3, 0xec,
-	0xbc, 0xfa, 0x1a, 0x09, 0xe5, 0x16, 0x47, 0x25, 0x07, 0x33, 0x7b, 0x41,
-	0x1d, 0x4f, 0xc4, 0x5d, 0x0a, 0x6b, 0x5d, 0x7a, 0x50, 0x79, 0xb7, 0x69,
-	0x83, 0x5c, 0xcf, 0x4d, 0x39, 0x40, 0xbb, 0x31, 0x03, 0x24, 0x9a, 0x15,
-	0xd5, 0x07, 0x72, 0xf9, 0xaf, 0xeb, 0x44, 0xdd, 0x8d, 0xcf, 0x0f, 0xc1,
-	0x7a, 0xb3, 0xc1, 0xa4, 0x96, 0x97, 0xe8, 0x87, 0x89, 0x84, 0x9f, 0x93,
-	0xfe, 0xa0, 0x94, 0xaf, 0x43, 0xbd, 0xac, 0xcb, 0x77, 0xd9, 0xce, 0xe7,
-	0xa5, 0xf5, 0xf4, 0x03, 0xcd, 0x11, 0x21, 0x20, 0xef, 0x2d, 0x55, 0x3c,
-	0x07, 0x4a, 0x99, 0x58, 0xfb, 0x65, 0x58, 0x75, 0xeb, 0x7c, 0x42, 0x6f,
-	0x61, 0x61, 0x1f, 0x53, 0x30, 0x45, 0xfb, 0x36, 0x03, 0x29, 0xd6, 0x1a,
-	0xd8, 0x0c, 0xac, 0xfe, 0xb1, 0xf0, 0x82, 0xe2, 0x89, 0xd4, 0x57, 0xc6,
-	0x64, 0xb8, 0x25, 0xaa, 0x52, 0x9c, 0xb2, 0x8d, 0xc7, 0x82, 0xbc, 0x8d,
-	0x4c, 0x9c, 0x2a, 0xaa, 0x5f, 0xb8, 0x5c, 0xc6, 0x85, 0xd4, 0x84, 0xe2,
-	0xb0, 0xf0, 0xac, 0xfe, 0xd8, 0x0c, 0xd7, 0x1a, 0x00, 0x29, 0xff, 0x36,
-	0x2d, 0x45, 0x21, 0x53, 0x5d, 0x61, 0x4e, 0x6f, 0xa4, 0x7c, 0x3e, 0x75,
-	0x07, 0x66, 0x90, 0x58, 0x0f, 0x4a, 0x4f, 0x3c, 0xf3, 0x2d, 0x1f, 0x20,
-	0xce, 0x11, 0xf4, 0x03, 0xa6, 0xf5, 0xcb, 0xe7, 0x7a, 0xd9, 0xaa, 0xcb,
-	0x45, 0xbd, 0x91, 0xaf, 0x04, 0xa1, 0x91, 0x93, 0xbd, 0x84, 0x07, 0x88,
-	0x87, 0x97, 0xcc, 0xa4, 0x72, 0xb3, 0x14, 0xc1, 0x89, 0xcf, 0x48, 0xdd,
-	0xab, 0xeb, 0x76, 0xf9, 0xd0, 0x07, 0xa1, 0x15, 0xfb, 0x23, 0xc2, 0x31,
-	0x32, 0x40, 0xd6, 0x4d, 0x7c, 0x5c, 0xc1, 0x69, 0x33, 0x79, 0x47, 0x7a,
-	0x14, 0x6b, 0xbe, 0x5d, 0x21, 0x4f, 0x78, 0x41, 0x09, 0x33, 0x46, 0x25,
-	0xe5, 0x16, 0x1a, 0x09, 0xbd, 0xfa, 0xf1, 0xec, 0x94, 0xde, 0xcb, 0xd0,
-	0x62, 0xc2, 0xb3, 0xb4, 0x1b, 0xa6, 0xc5, 0x98, 0x5a, 0x89, 0x08, 0x84,
-	0x22, 0x92, 0xd4, 0x9f, 0x37, 0xae, 0x0d, 0xbc, 0x56, 0xca, 0x3b, 0xd8,
-	0x7c, 0xe6, 0x66, 0xf4, 0xa3, 0x02, 0x91, 0x10, 0xcc, 0x1e, 0xb7, 0x2c,
-	0xfb, 0x3a, 0xd6, 0x48, 0x34, 0x57, 0xde, 0x64, 0xc2, 0x73, 0xeb, 0x7c,
-	0xce, 0x70, 0x85, 0x62, 0x7e, 0x54, 0x66, 0x46, 0x52, 0x38, 0x3d, 0x2a,
-	0x2a, 0x1c, 0x13, 0x0e, 0x01, 0x00, 0xeb, 0xf1, 0xd8, 0xe3, 0xc1, 0xd5,
-	0xb0, 0xc7, 0x98, 0xb9, 0x86, 0xab, 0x74, 0x9d, 0x3d, 0x8f, 0xfe, 0x82,
-	0x2d, 0x8c, 0x2c, 0x9b, 0xc5, 0xa8, 0x2f, 0xb7, 0x01, 0xc5, 0x4d, 0xd3,
-	0x30, 0xe1, 0x72, 0xef, 0x5b, 0xfd, 0x9c, 0x0b, 0x82, 0x19, 0xc7, 0x27,
-	0xa7, 0x35, 0xf7, 0x43, 0xc3, 0x51, 0x37, 0x60, 0xc8, 0x6d, 0x42, 0x7c,
-	0xc1, 0x76, 0x32, 0x67, 0xec, 0x59, 0x47, 0x4b, 0xa3, 0x3d, 0x31, 0x2f,
-	0x6d, 0x21, 0x11, 0x13, 0x42, 0x05, 0xe4, 0xf6, 0x1f, 0xe9, 0xb4, 0xda,
-	0xff, 0xcc, 0x7f, 0xbe, 0xea, 0xb0, 0x32, 0xa2, 0x06, 0x95, 0x6c, 0x85,
-	0x94, 0x86, 0x57, 0x96, 0x74, 0xa3, 0x36, 0xb2, 0xc4, 0xbf, 0x48, 0xce,
-	0xfa, 0xdb, 0x6a, 0xea, 0x26, 0xf8, 0x92, 0x06, 0x50, 0x14, 0xbb, 0x22,
-	0x74, 0x30, 0xf0, 0x3e, 0x87, 0x4c, 0x3f, 0x5b, 0x69, 0x68, 0x1e, 0x78,
-	0x60, 0x7b, 0x62, 0x6c, 0x04, 0x5f, 0x6a, 0x50, 0xbf, 0x42, 0x52, 0x34,
-	0x8b, 0x26, 0x30, 0x18, 0x5d, 0x0a, 0x0b, 0xfc, 0x32, 0xee, 0xe2, 0xdf,
-	0x0c, 0xd2, 0xb1, 0xc3, 0xf2, 0xb5, 0x6e, 0xa7, 0xfc, 0x99, 0xb8, 0x8a,
-	0x65, 0x83, 0xba, 0x90, 0x9c, 0x9e, 0xe6, 0xac, 0xcb, 0xba, 0x0a, 0xc9,
-	0xf8, 0xd6, 0x30, 0xe5, 0x23, 0xf3, 0x56, 0x01, 0x4f, 0x0f, 0x7c, 0x1d,
-	0x7c, 0x2b, 0xa3, 0x39, 0xa2, 0x47, 0xd5, 0x55, 0xb3, 0x63, 0x4c, 0x72,
-	0xfc, 0x7c, 0x47, 0x72, 0xb2, 0x63, 0xd8, 0x55, 0x9f, 0x47, 0xa6, 0x39,
-	0x7b, 0x2b, 0x7a, 0x1d, 0x53, 0x0f, 0x50, 0x01, 0x2a, 0xf3, 0x2a, 0xe5,
-	0xfe, 0xd6, 0x03, 0xc9, 0xd3, 0xba, 0xdd, 0xac, 0xa5, 0x9e, 0xb0, 0x90,
-	0x7c, 0x83, 0xc7, 0x8a, 0xf3, 0x99, 0x74, 0xa7, 0xef, 0xb5, 0xb2, 0xc3,
-	0x0c, 0xd2, 0xe2, 0xdf, 0x32, 0xee, 0x0b, 0xfc, 0x5c, 0x0a, 0x31, 0x18,
-	0x8a, 0x26, 0x55, 0x34, 0xba, 0x42, 0x70, 0x50, 0xfb, 0x5e, 0x70, 0x6c,
-	0x38, 0x7b, 0xfe, 0x77, 0x79, 0x68, 0x34, 0x5b, 0x8e, 0x4c, 0xec, 0x3e,
-	0x77, 0x30, 0xb8, 0x22, 0x54, 0x14, 0x8d, 0x06, 0x2b, 0xf8, 0x65, 0xea,
-	0xff, 0xdb, 0x42, 0xce, 0xcc, 0xbf, 0x2b, 0xb2, 0x83, 0xa3, 0x41, 0x96,
-	0xc9, 0x86, 0xa1, 0x85, 0xf2, 0x94, 0x40, 0xa2, 0xe0, 0xb0, 0x87, 0xbe,
-	0xf7, 0xcc, 0xbb, 0xda, 0x1a, 0xe9, 0xe6, 0xf6, 0x44, 0x05, 0x0d, 0x13,
-	0x70, 0x21, 0x30, 0x2f, 0xa2, 0x3d, 0x4a, 0x4b, 0xe8, 0x59, 0x38, 0x67,
-	0xae, 0x76, 0x2a, 0x7c, 0xd2, 0x6d, 0x33, 0x60, 0xc4, 0x51, 0xf8, 0x43,
-	0xa6, 0x35, 0xc8, 0x27, 0x80, 0x19, 0x9f, 0x0b, 0x56, 0xfd, 0x79, 0xef,
-	0x29, 0xe1, 0x52, 0xd3, 0xfe, 0xc4, 0x2f, 0xb7, 0xc8, 0xa8, 0x28, 0x9b,
-	0x34, 0x8c, 0xc8, 0x82, 0x3e, 0x8f, 0x73, 0x9d, 0x88, 0xab, 0x96, 0xb9,
-	0xb2, 0xc7, 0xbf, 0xd5, 0xda, 0xe3, 0xe9, 0xf1, 0x02, 0x00, 0x13, 0x0e,
-	0x2b, 0x1c, 0x3b, 0x2a, 0x54, 0x38, 0x65, 0x46, 0x7d, 0x54, 0x88, 0x62,
-	0xc7, 0x70, 0x34, 0x7d, 0xce, 0x73, 0xd7, 0x64, 0x38, 0x57, 0xd3, 0x48,
-	0xff, 0x3a, 0xb2, 0x2c, 0xd1, 0x1e, 0x8d, 0x10, 0xa5, 0x02, 0x65, 0xf4,
-	0x7d, 0xe6, 0x3a, 0xd8, 0x59, 0xca, 0x08, 0xbc, 0x3c, 0xae, 0xce, 0x9f,
-	0x2c, 0x92, 0xd9, 0x83, 0x50, 0x89, 0xc8, 0x98, 0x19, 0xa6, 0xb5, 0xb4,
-	0x5f, 0xc2, 0xd0, 0xd0, 0x8f, 0xde, 0xf3, 0xec, 0xbd, 0xfa, 0x19, 0x09,
-	0xe7, 0x16, 0x45, 0x25, 0x07, 0x33, 0x7c, 0x41, 0x1c, 0x4f, 0xc4, 0x5d,
-	0x0c, 0x6b, 0x60, 0x7a, 0x36, 0x79, 0xc0, 0x69, 0x7b, 0x5c, 0xd7, 0x4d,
-	0x33, 0x40, 0xbf, 0x31, 0x00, 0x24, 0x9c, 0x15, 0xd3, 0x07, 0x75, 0xf9,
-	0xac, 0xeb, 0x46, 0xdd, 0x8c, 0xcf, 0x11, 0xc1, 0x74, 0xb3, 0xcb, 0xa4,
-	0x87, 0x97, 0x02, 0x88, 0xc8, 0x84, 0x90, 0x93, 0x06, 0xa1, 0x8d, 0xaf,
-	0x49, 0xbd, 0xa8, 0xcb, 0x7a, 0xd9, 0xcc, 0xe7, 0xa5, 0xf5, 0xf5, 0x03,
-	0xcc, 0x11, 0x22, 0x20, 0xef, 0x2d, 0x53, 0x3c, 0x0c, 0x4a, 0x92, 0x58,
-	0x06, 0x66, 0x3f, 0x75, 0x80, 0x7c, 0x53, 0x6f, 0x5a, 0x61, 0x22, 0x53,
-	0x2d, 0x45, 0xfe, 0x36, 0x01, 0x29, 0xd8, 0x1a, 0xd4, 0x0c, 0xb2, 0xfe,
-	0xa9, 0xf0, 0x8a, 0xe2, 0x81, 0xd4, 0x5e, 0xc6, 0x5f, 0xb8, 0x29, 0xaa,
-	0x4c, 0x9c, 0xbb, 0x8d, 0x03, 0x83, 0xb4, 0x8d, 0x50, 0x9c, 0x25, 0xaa,
-	0x65, 0xb8, 0x57, 0xc6, 0x89, 0xd4, 0x82, 0xe2, 0xb0, 0xf0, 0xad, 0xfe,
-	0xd9, 0x0c, 0xd4, 0x1a, 0x04, 0x29, 0xfa, 0x36, 0x31, 0x45, 0x1f, 0x53,
-	0x5f, 0x61, 0x4a, 0x6f, 0x96, 0x7c, 0x4d, 0x75, 0x01, 0x66, 0x94, 0x58,
-	0x0c, 0x4a, 0x51, 0x3c, 0xf1, 0x2d, 0x21, 0x20, 0xcc, 0x11, 0xf7, 0x03,
-	0xa1, 0xf5, 0xd1, 0xe7, 0x75, 0xd9, 0xad, 0xcb, 0x43, 0xbd, 0x93, 0xaf,
-	0x00, 0xa1, 0x9c, 0x93, 0x9f, 0x84, 0xe5, 0x87, 0x93, 0x97, 0xc5, 0xa4,
-	0x77, 0xb3, 0x10, 0xc1, 0x8c, 0xcf, 0x46, 0xdd, 0xae, 0xeb, 0x71, 0xf9,
-	0xd6, 0x07, 0x99, 0x15, 0x05, 0x24, 0xb8, 0x31, 0x3c, 0x40, 0xcb, 0x4d,
-	0x8a, 0x5c, 0xab, 0x69, 0x6c, 0x79, 0x92, 0x7a, 0xfd, 0x6a, 0xca, 0x5d,
-	0x1a, 0x4f, 0x7d, 0x41, 0x05, 0x33, 0x49, 0x25, 0xe2, 0x16, 0x1d, 0x09,
-	0xba, 0xfa, 0xf5, 0xec, 0x8d, 0xde, 0xd4, 0xd0, 0x59, 0xc2, 0xbc, 0xb4,
-	0x12, 0xa6, 0xd0, 0x98, 0x3d, 0x89, 0xbe, 0x83, 0x3b, 0x92, 0xc5, 0x9f,
-	0x40, 0xae, 0x07, 0xbc, 0x5a, 0xca, 0x39, 0xd8, 0x7d, 0xe6, 0x66, 0xf4,
-	0xa3, 0x02, 0x8f, 0x10, 0xd0, 0x1e, 0xb3, 0x2c, 0xfd, 0x3a, 0xd5, 0x48,
-	0x36, 0x57, 0xd9, 0x64, 0xcf, 0x73, 0x04, 0x7d, 0xc2, 0x70, 0x8c, 0x62,
-	0x7a, 0x54, 0x69, 0x46, 0x4f, 0x38, 0x3f, 0x2a, 0x29, 0x1c, 0x13, 0x0e,
-	0x03, 0x00, 0xe8, 0xf1, 0xda, 0xe3, 0xc1, 0xd5, 0xae, 0xc7, 0x9b, 0xb9,
-	0x81, 0xab, 0x7b, 0x9d, 0x33, 0x8f, 0x13, 0x83, 0x40, 0x8c, 0x20, 0x9b,
-	0xcd, 0xa8, 0x2b, 0xb7, 0x02, 0xc5, 0x4e, 0xd3, 0x2e, 0xe1, 0x74, 0xef,
-	0x5b, 0xfd, 0x99, 0x0b, 0x87, 0x19, 0xc1, 0x27, 0xad, 0x35, 0xf2, 0x43,
-	0xc8, 0x51, 0x2e, 0x60, 0xdb, 0x6d, 0xfb, 0x7b, 0xa3, 0x76, 0x3e, 0x67,
-	0xe3, 0x59, 0x4e, 0x4b, 0x9d, 0x3d, 0x36, 0x2f, 0x6b, 0x21, 0x12, 0x13,
-	0x3f, 0x05, 0xe9, 0xf6, 0x19, 0xe9, 0xbc, 0xda, 0xf6, 0xcc, 0x88, 0xbe,
-	0xde, 0xb0, 0x43, 0xa2, 0xec, 0x94, 0xb9, 0x85, 0xcd, 0x86, 0x3e, 0x96,
-	0x84, 0xa3, 0x2c, 0xb2, 0xca, 0xbf, 0x45, 0xce, 0xfd, 0xdb, 0x65, 0xea,
-	0x2c, 0xf8, 0x8d, 0x06, 0x53, 0x14, 0xba, 0x22, 0x75, 0x30, 0xed, 0x3e,
-	0x8e, 0x4c, 0x33, 0x5b, 0x7b, 0x68, 0xf6, 0x77, 0x47, 0x7b, 0x6b, 0x6c,
-	0xff, 0x5e, 0x6d, 0x50, 0xbc, 0x42, 0x56, 0x34, 0x86, 0x26, 0x36, 0x18,
-	0x57, 0x0a, 0x0f, 0xfc, 0x31, 0xee, 0xe0, 0xdf, 0x10, 0xd2, 0xad, 0xc3,
-	0xf4, 0xb5, 0x6f, 0xa7, 0xf8, 0x99, 0xc4, 0x8a, 0x5b, 0x83, 0xb2, 0x90,
-	0xa4, 0x9e, 0xdd, 0xac, 0xd4, 0xba, 0x02, 0xc9, 0xfe, 0xd6, 0x2b, 0xe5,
-	0x27, 0xf3, 0x53, 0x01, 0x52, 0x0f, 0x7a, 0x1d, 0x7b, 0x2b, 0xa5, 0x39,
-	0xa0, 0x47, 0xd7, 0x55, 0xb4, 0x63, 0x44, 0x72, 0x38, 0x7d, 0x4f, 0x72,
-	0xad, 0x63, 0xdd, 0x55, 0x9b, 0x47, 0xa9, 0x39, 0x77, 0x2b, 0x7d, 0x1d,
-	0x51, 0x0f, 0x53, 0x01, 0x28, 0xf3, 0x2b, 0xe5, 0xfc, 0xd6, 0x06, 0xc9,
-	0xce, 0xba, 0xe4, 0xac, 0x9d, 0x9e, 0xbf, 0x90, 0x14, 0x83, 0xa9, 0x8a,
-	0x03, 0x9a, 0x6b, 0xa7, 0xf5, 0xb5, 0xad, 0xc3, 0x10, 0xd2, 0xdf, 0xdf,
-	0x34, 0xee, 0x0b, 0xfc, 0x5b, 0x0a, 0x32, 0x18, 0x8a, 0x26, 0x53, 0x34,
-	0xbe, 0x42, 0x6a, 0x50, 0x04, 0x5f, 0x61, 0x6c, 0x77, 0x7b, 0x18, 0x78,
-	0x69, 0x68, 0x40, 0x5b, 0x85, 0x4c, 0xf3, 0x3e, 0x72, 0x30, 0xbb, 0x22,
-	0x52, 0x14, 0x8f, 0x06, 0x29, 0xf8, 0x67, 0xea, 0xfd, 0xdb, 0x45, 0xce,
-	0xc9, 0xbf, 0x2f, 0xb2, 0x7d, 0xa3, 0x49, 0x96, 0xb2, 0x86, 0xa2, 0x85,
-	0xf6, 0x94, 0x3b, 0xa2, 0xe4, 0xb0, 0x84, 0xbe, 0xfb, 0xcc, 0xb7, 0xda,
-	0x1c, 0xe9, 0xe5, 0xf6, 0x45, 0x05, 0x0c, 0x13, 0x71, 0x21, 0x2f, 0x2f,
-	0xa2, 0x3d, 0x4b, 0x4b, 0xe6, 0x59, 0x39, 0x67, 0xb1, 0x76, 0xfc, 0x7b,
-	0xdb, 0x6d, 0x2d, 0x60, 0xc7, 0x51, 0xf6, 0x43, 0xa8, 0x35, 0xc5, 0x27,
-	0x86, 0x19, 0x98, 0x0b, 0x5c, 0xfd, 0x73, 0xef, 0x2e, 0xe1, 0x50, 0xd3,
-	0xff, 0xc4, 0x2f, 0xb7, 0xc7, 0xa8, 0x28, 0x9b, 0x36, 0x8c, 0x27, 0x83,
-	0x38, 0x8f, 0x75, 0x9d, 0x87, 0xab, 0x97, 0xb9, 0xaf, 0xc7, 0xc4, 0xd5,
-	0xd4, 0xe3, 0xef, 0xf1, 0xfd, 0xff, 0x17, 0x0e, 0x27, 0x1c, 0x3f, 0x2a,
-	0x50, 0x38, 0x69, 0x46, 0x79, 0x54, 0x8d, 0x62, 0xc4, 0x70, 0xdd, 0x7c,
-	0xc6, 0x73, 0xdc, 0x64, 0x36, 0x57, 0xd5, 0x48, 0xfb, 0x3a, 0xb6, 0x2c,
-	0xce, 0x1e, 0x8e, 0x10, 0xa6, 0x02, 0x64, 0xf4, 0x7e, 0xe6, 0x39, 0xd8,
-	0x58, 0xca, 0x0a, 0xbc, 0x3b, 0xae, 0xcf, 0x9f, 0x29, 0x92, 0x02, 0x84,
-	0x4f, 0x89, 0xc9, 0x98, 0x17, 0xa6, 0xb6, 0xb4, 0x61, 0xc2, 0xcc, 0xd0,
-	0x93, 0xde, 0xf0, 0xec, 0xbe, 0xfa, 0x1b, 0x09, 0xe4, 0x16, 0x47, 0x25,
-	0x06, 0x33, 0x7c, 0x41, 0x1d, 0x4f, 0xc3, 0x5d, 0x0c, 0x6b, 0x5b, 0x7a,
-	0x52, 0x79, 0xb4, 0x69, 0x85, 0x5c, 0xcf, 0x4d, 0x38, 0x40, 0xbd, 0x31,
-	0xff, 0x23, 0x9e, 0x15, 0xd2, 0x07, 0x74, 0xf9, 0xae, 0xeb, 0x43, 0xdd,
-	0x8f, 0xcf, 0x0e, 0xc1, 0x78, 0xb3, 0xc5, 0xa4, 0x92, 0x97, 0xeb, 0x87,
-	0x88, 0x84, 0x9f, 0x93, 0xfd, 0xa0, 0x95, 0xaf, 0x43, 0xbd, 0xac, 0xcb,
-	0x77, 0xd9, 0xce, 0xe7, 0xa4, 0xf5, 0xf5, 0x03, 0xce, 0x11, 0x1e, 0x20,
-	0xf3, 0x2d, 0x52, 0x3c, 0x0a, 0x4a, 0x97, 0x58, 0xfb, 0x65, 0x57, 0x75,
-	0xef, 0x7c, 0x3d, 0x6f, 0x66, 0x61, 0x1b, 0x53, 0x31, 0x45, 0xfd, 0x36,
-	0x00, 0x29, 0xd9, 0x1a, 0xd3, 0x0c, 0xb3, 0xfe, 0xaa, 0xf0, 0x88, 0xe2,
-	0x84, 0xd4, 0x5b, 0xc6, 0x61, 0xb8, 0x27, 0xaa, 0x50, 0x9c, 0xb4, 0x8d,
-	0xc5, 0x82, 0xbf, 0x8d, 0x49, 0x9c, 0x2b, 0xaa, 0x5f, 0xb8, 0x5b, 0xc6,
-	0x86, 0xd4, 0x84, 0xe2, 0xb0, 0xf0, 0xab, 0xfe, 0xdb, 0x0c, 0xd2, 0x1a,
-	0x05, 0x29, 0xfb, 0x36, 0x31, 0x45, 0x1d, 0x53, 0x61, 0x61, 0x49, 0x6f,
-	0xaa, 0x7c, 0x38, 0x75, 0x0d, 0x66, 0x8a, 0x58, 0x13, 0x4a, 0x4c, 0x3c,
-	0xf5, 0x2d, 0x1f, 0x20, 0xcd, 0x11, 0xf5, 0x03, 0xa4, 0xf5, 0xce, 0xe7,
-	0x77, 0xd9, 0xac, 0xcb, 0x44, 0xbd, 0x92, 0xaf, 0x03, 0xa1, 0x91, 0x93,
-	0xbd, 0x84, 0x07, 0x88, 0x88, 0x97, 0xcb, 0xa4, 0x72, 0xb3, 0x14, 0xc1,
-	0x8a, 0xcf, 0x46, 0xdd, 0xad, 0xeb, 0x74, 0xf9, 0xd3, 0x07, 0x9e, 0x15,
-	0xfd, 0x23, 0xc0, 0x31, 0x34, 0x40, 0xd5, 0x4d, 0x7d, 0x5c, 0xc0, 0x69,
-	0x34, 0x79, 0x47, 0x7a, 0x14, 0x6b, 0xbd, 0x5d, 0x23, 0x4f, 0x77, 0x41,
-	0x0a, 0x33, 0x44, 0x25, 0xe7, 0x16, 0x17, 0x09, 0xc1, 0xfa, 0xef, 0xec,
-	0x93, 0xde, 0xcd, 0xd0, 0x60, 0xc2, 0xb4, 0xb4, 0x1c, 0xa6, 0xc3, 0x98,
-	0x5b, 0x89, 0x08, 0x84, 0x22, 0x92, 0xd3, 0x9f, 0x3a, 0xae, 0x09, 0xbc,
-	0x59, 0xca, 0x39, 0xd8, 0x7d, 0xe6, 0x67, 0xf4, 0xa3, 0x02, 0x8f, 0x10,
-	0xce, 0x1e, 0xb5, 0x2c, 0xfd, 0x3a, 0xd5, 0x48, 0x34, 0x57, 0xde, 0x64,
-	0xc1, 0x73, 0xee, 0x7c, 0xca, 0x70, 0x89, 0x62, 0x7b, 0x54, 0x67, 0x46,
-	0x52, 0x38, 0x3d, 0x2a, 0x2a, 0x1c, 0x13, 0x0e, 0x01, 0x00, 0xeb, 0xf1,
-	0xd8, 0xe3, 0xc1, 0xd5, 0xb0, 0xc7, 0x97, 0xb9, 0x87, 0xab, 0x74, 0x9d,
-	0x3d, 0x8f, 0xfe, 0x82, 0x2d, 0x8c, 0x2b, 0x9b, 0xc8, 0xa8, 0x2a, 0xb7,
-	0x06, 0xc5, 0x49, 0xd3, 0x33, 0xe1, 0x71, 0xef, 0x5c, 0xfd, 0x99, 0x0b,
-	0x86, 0x19, 0xc4, 0x27, 0xa8, 0x35, 0xf8, 0x43, 0xc1, 0x51, 0x39, 0x60,
-	0xc9, 0x6d, 0x3d, 0x7c, 0xc7, 0x76, 0x2e, 0x67, 0xed, 0x59, 0x49, 0x4b,
-	0x9f, 0x3d, 0x34, 0x2f, 0x6e, 0x21, 0x0d, 0x13, 0x46, 0x05, 0xe2, 0xf6,
-	0x1e, 0xe9, 0xb7, 0xda, 0xfd, 0xcc, 0x7f, 0xbe, 0xeb, 0xb0, 0x31, 0xa2,
-	0x06, 0x95, 0x6d, 0x85, 0x94, 0x86, 0x56, 0x96, 0x74, 0xa3, 0x37, 0xb2,
-	0xc2, 0xbf, 0x4a, 0xce, 0xfa, 0xdb, 0x68, 0xea, 0x29, 0xf8, 0x8e, 0x06,
-	0x53, 0x14, 0xba, 0x22, 0x75, 0x30, 0xee, 0x3e, 0x8a, 0x4c, 0x3c, 0x5b,
-	0x6a, 0x68, 0x1f, 0x78, 0x5e, 0x7b, 0x65, 0x6c, 0x02, 0x5f, 0x6a, 0x50,
-	0xbf, 0x42, 0x52, 0x34, 0x8b, 0x26, 0x30, 0x18, 0x5e, 0x0a, 0x09, 0xfc,
-	0x35, 0xee, 0xdd, 0xdf, 0x12, 0xd2, 0xac, 0xc3, 0xf6, 0xb5, 0x6b, 0xa7,
-	0xff, 0x99, 0xb5, 0x8a, 0x68, 0x83, 0xb7, 0x90, 0x9f, 0x9e, 0xe4, 0xac,
-	0xcc, 0xba, 0x0a, 0xc9, 0xf7, 0xd6, 0x30, 0xe5, 0x24, 0xf3, 0x55, 0x01,
-	0x50, 0x0f, 0x7c, 0x1d, 0x7a, 0x2b, 0xa5, 0x39, 0xa1, 0x47, 0xd5, 0x55,
-	0xb5, 0x63, 0x47, 0x72, 0x01, 0x7d, 0x44, 0x72, 0xb3, 0x63, 0xd8, 0x55,
-	0x9f, 0x47, 0xa5, 0x39, 0x7c, 0x2b, 0x79, 0x1d, 0x53, 0x0f, 0x52, 0x01,
-	0x28, 0xf3, 0x2b, 0xe5, 0xfd, 0xd6, 0x05, 0xc9, 0xcf, 0xba, 0xe2, 0xac,
-	0xa2, 0x9e, 0xb1, 0x90, 0x7d, 0x83, 0xc3, 0x8a, 0xf9, 0x99, 0x6f, 0xa7,
-	0xf3, 0xb5, 0xae, 0xc3, 0x0f, 0xd2, 0xe1, 0xdf, 0x31, 0xee, 0x0e, 0xfc,
-	0x58, 0x0a, 0x36, 0x18, 0x85, 0x26, 0x58, 0x34, 0xb9, 0x42, 0x71, 0x50,
-	0xfa, 0x5e, 0x71, 0x6c, 0x36, 0x7b, 0x01, 0x78, 0x76, 0x68, 0x36, 0x5b,
-	0x8d, 0x4c, 0xec, 0x3e, 0x78, 0x30, 0xb6, 0x22, 0x56, 0x14, 0x8c, 0x06,
-	0x2a, 0xf8, 0x69, 0xea, 0xfa, 0xdb, 0x47, 0xce, 0xc7, 0xbf, 0x30, 0xb2,
-	0x7f, 0xa3, 0x43, 0x96, 0xca, 0x86, 0x9d, 0x85, 0xf9, 0x94, 0x38, 0xa2,
-	0xe6, 0xb0, 0x83, 0xbe, 0xf9, 0xcc, 0xbb, 0xda, 0x19, 0xe9, 0xe9, 0xf6,
-	0x40, 0x05, 0x10, 0x13, 0x6d, 0x21, 0x33, 0x2f, 0xa1, 0x3d, 0x4b, 0x4b,
-	0xe6, 0x59, 0x39, 0x67, 0xae, 0x76, 0x2a, 0x7c, 0xd3, 0x6d, 0x31, 0x60,
-	0xc5, 0x51, 0xf8, 0x43, 0xa5, 0x35, 0xca, 0x27, 0x7f, 0x19, 0x9d, 0x0b,
-	0x5b, 0xfd, 0x71, 0xef, 0x32, 0xe1, 0x4c, 0xd3, 0x01, 0xc5, 0x2f, 0xb7,
-	0xc5, 0xa8, 0x2b, 0x9b, 0x33, 0x8c, 0xc9, 0x82, 0x3c, 0x8f, 0x75, 0x9d,
-	0x86, 0xab, 0x97, 0xb9, 0xb2, 0xc7, 0xbe, 0xd5, 0xdb, 0xe3, 0xe8, 0xf1
-};